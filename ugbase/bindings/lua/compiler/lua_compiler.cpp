@@ -275,6 +275,22 @@ bool LUACompiler::call(double *ret, const double *in) const
 	}
 }
 
+bool LUACompiler::call(double *ret, const double *in, size_t n) const
+{
+	if(bVM)
+	{
+		const_cast<LUACompiler*>(this)->vm->execute(ret, in, n);
+		return true;
+	}
+	else
+	{
+		UG_ASSERT(m_f != NULL, "function " << m_name << " not valid");
+		for(size_t k=0; k<n; k++)
+			m_f(ret + k*m_iOut, in + k*m_iIn);
+		return true;
+	}
+}
+
 
 }
 }
@@ -98,6 +98,9 @@ public:
 	bool createC(const char *functionName, LuaFunctionHandle* pHandle = NULL);
 	
 	bool call(double *ret, const double *in) const;
+
+	/// evaluates the function for n points (in: n*num_in() values, ret: n*num_out() values)
+	bool call(double *ret, const double *in, size_t n) const;
 	virtual ~LUACompiler();
 };
 
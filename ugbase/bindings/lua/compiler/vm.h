@@ -54,6 +54,15 @@ private:
 	size_t m_nrOut, m_nrIn;
 	std::vector<SmartPtr<VMAdd> > subfunctions;
 
+	/// number of points processed at once by the vectorized execute
+	static const size_t VEC_BLOCK = 64;
+
+	/// stack and variables of the vectorized execute (value of point l at [i*VEC_BLOCK+l])
+	std::vector<double> vecStack, vecVariables;
+
+	/// 1 if code has no jumps and calls, 0 if it has, -1 if not yet checked
+	int m_straightLine;
+
 	enum VMInstruction
 	{
 		PUSH_CONSTANT=0,
@@ -86,6 +95,7 @@ private:
 	inline void serializeChar(char c)
 	{
 		vmBuf.push_back(c);
+		m_straightLine = -1;
 	}
 
 	inline void serializeInt(int d)
@@ -165,6 +175,7 @@ public:
 	VMAdd()
 	{
 			m_name = "unknown";
+			m_straightLine = -1;
 	}
 	void set_name(std::string name)
 	{
@@ -509,6 +520,155 @@ public:
 		return 1;
 	}
 
+	/// returns true if the code contains no jumps and no calls to subfunctions
+	bool is_straight_line()
+	{
+		if(m_straightLine >= 0) return m_straightLine == 1;
+
+		m_straightLine = 1;
+		for(size_t i=0; i<vmBuf.size(); )
+		{
+			VMInstruction instr;
+			deserializeVMInstr(i, instr);
+			switch(instr)
+			{
+				case PUSH_CONSTANT: i += sizeof(double); break;
+				case PUSH_VAR:
+				case OP_UNARY:
+				case OP_BINARY:
+				case ASSIGN: i += sizeof(int); break;
+				case OP_RETURN: break;
+				default: m_straightLine = 0; return false;
+			}
+		}
+		return true;
+	}
+
+	inline void execute_unary_vec(size_t &i, double *v, size_t n)
+	{
+		int op;
+		deserializeInt(i, op);
+		switch(op)
+		{
+			case LUAPARSER_MATH_COS: for(size_t l=0; l<n; l++) v[l] = cos(v[l]); break;
+			case LUAPARSER_MATH_SIN: for(size_t l=0; l<n; l++) v[l] = sin(v[l]); break;
+			case LUAPARSER_MATH_EXP: for(size_t l=0; l<n; l++) v[l] = exp(v[l]); break;
+			case LUAPARSER_MATH_ABS: for(size_t l=0; l<n; l++) v[l] = fabs(v[l]); break;
+			case LUAPARSER_MATH_LOG: for(size_t l=0; l<n; l++) v[l] = log(v[l]); break;
+			case LUAPARSER_MATH_LOG10: for(size_t l=0; l<n; l++) v[l] = log10(v[l]); break;
+			case LUAPARSER_MATH_SQRT: for(size_t l=0; l<n; l++) v[l] = sqrt(v[l]); break;
+			case LUAPARSER_MATH_FLOOR: for(size_t l=0; l<n; l++) v[l] = floor(v[l]); break;
+			case LUAPARSER_MATH_CEIL: for(size_t l=0; l<n; l++) v[l] = ceil(v[l]); break;
+		}
+	}
+
+	inline void execute_binary_vec(size_t &i, double *a, const double *b, size_t n)
+	{
+		int op;
+		deserializeInt(i, op);
+		switch(op)
+		{
+			case '+': 	for(size_t l=0; l<n; l++) a[l] = b[l]+a[l]; break;
+			case '-': 	for(size_t l=0; l<n; l++) a[l] = b[l]-a[l]; break;
+			case '*': 	for(size_t l=0; l<n; l++) a[l] = b[l]*a[l]; break;
+			case '/': 	for(size_t l=0; l<n; l++) a[l] = b[l]/a[l]; break;
+			case '<': 	for(size_t l=0; l<n; l++) a[l] = (b[l] < a[l]) ? 1.0 : 0.0; break;
+			case '>': 	for(size_t l=0; l<n; l++) a[l] = (b[l] > a[l]) ? 1.0 : 0.0; break;
+			case LUAPARSER_GE: 	for(size_t l=0; l<n; l++) a[l] = (b[l] >= a[l]) ? 1.0 : 0.0; break;
+			case LUAPARSER_LE: 	for(size_t l=0; l<n; l++) a[l] = (b[l] <= a[l]) ? 1.0 : 0.0; break;
+			case LUAPARSER_NE: 	for(size_t l=0; l<n; l++) a[l] = (b[l] != a[l]) ? 1.0 : 0.0; break;
+			case LUAPARSER_EQ: 	for(size_t l=0; l<n; l++) a[l] = (b[l] == a[l]) ? 1.0 : 0.0; break;
+			case LUAPARSER_AND: 	for(size_t l=0; l<n; l++) a[l] = (a[l] != 0.0 && b[l] != 0.0) ? 1.0 : 0.0; break;
+			case LUAPARSER_OR: 	for(size_t l=0; l<n; l++) a[l] = (a[l] != 0 || b[l] != 0) ? 1.0 : 0.0; break;
+			case LUAPARSER_MATH_POW: 	for(size_t l=0; l<n; l++) a[l] = pow(b[l], a[l]); break;
+			case LUAPARSER_MATH_MIN: 	for(size_t l=0; l<n; l++) a[l] = (b[l] < a[l]) ? a[l] : b[l]; break;
+			case LUAPARSER_MATH_MAX: 	for(size_t l=0; l<n; l++) a[l] = (b[l] > a[l]) ? a[l] : b[l]; break;
+		}
+	}
+
+	/// executes straight-line code for n <= VEC_BLOCK points, each op over all points
+	void execute_block(double *ret, const double *in, size_t n)
+	{
+		const size_t B = VEC_BLOCK;
+		vecStack.resize(255*B);
+		vecVariables.resize(variables.size()*B);
+		double *stack = &vecStack[0];
+		double *vars = vecVariables.empty() ? NULL : &vecVariables[0];
+
+		for(size_t v=0; v<m_nrIn; v++)
+			for(size_t l=0; l<n; l++)
+				vars[v*B+l] = in[l*m_nrIn+v];
+
+		double varD;
+		int varI;
+		int SP=0;
+		size_t i=0;
+		VMInstruction instr;
+		while(i < vmBuf.size())
+		{
+			deserializeVMInstr(i, instr);
+			if(instr == OP_RETURN) break;
+
+			switch(instr)
+			{
+				case PUSH_CONSTANT:
+					deserializeDouble(i, varD);
+					for(size_t l=0; l<n; l++) stack[SP*B+l] = varD;
+					SP++;
+					break;
+
+				case PUSH_VAR:
+					deserializeInt(i, varI);
+					for(size_t l=0; l<n; l++) stack[SP*B+l] = vars[(varI-1)*B+l];
+					SP++;
+					break;
+
+				case OP_UNARY:
+					UG_ASSERT(SP>0, SP);
+					execute_unary_vec(i, &stack[(SP-1)*B], n);
+					break;
+
+				case OP_BINARY:
+					UG_ASSERT(SP>1, SP);
+					execute_binary_vec(i, &stack[(SP-2)*B], &stack[(SP-1)*B], n);
+					SP--;
+					break;
+
+				case ASSIGN:
+					deserializeInt(i, varI);
+					SP--;
+					for(size_t l=0; l<n; l++) vars[(varI-1)*B+l] = stack[SP*B+l];
+					break;
+
+				default:
+					UG_ASSERT(0, "IP: " << i << " op " << ((int)instr) << " ?\n");
+			}
+		}
+		UG_ASSERT(SP == (int)m_nrOut, SP << " != " << m_nrOut);
+
+		for(size_t o=0; o<m_nrOut; o++)
+			for(size_t l=0; l<n; l++)
+				ret[l*m_nrOut+o] = stack[o*B+l];
+	}
+
+	/// executes the function for n points (in: n*num_in() values, ret: n*num_out() values)
+	int execute(double *ret, const double *in, size_t n)
+	{
+		if(!is_straight_line())
+		{
+			for(size_t k=0; k<n; k++)
+				execute(ret + k*m_nrOut, in + k*m_nrIn);
+			return 1;
+		}
+
+		for(size_t k=0; k<n; k+=VEC_BLOCK)
+		{
+			const size_t nb = (n-k < VEC_BLOCK) ? n-k : VEC_BLOCK;
+			execute_block(ret + k*m_nrOut, in + k*m_nrIn, nb);
+		}
+		return 1;
+	}
+
 	double call()
 	{
 		double stack[255];
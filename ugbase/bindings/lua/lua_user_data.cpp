@@ -134,6 +134,7 @@ void RegisterLuaUserDataType(Registry& reg, string type, string grp)
 		reg.add_class_<T, TBase>(name, grp)
 			.template add_constructor<void (*)(const char*)>("Callback")
 			.template add_constructor<void (*)(LuaFunctionHandle)>("handle")
+			.add_method("set_vector_callback", &T::set_vector_callback, "", "VectorCallback")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, string("LuaUser").append(type), tag);
 	}
@@ -146,6 +147,7 @@ void RegisterLuaUserDataType(Registry& reg, string type, string grp)
 		reg.add_class_<T, TBase>(name, grp)
 			.template add_constructor<void (*)(const char*)>("Callback")
 			.template add_constructor<void (*)(LuaFunctionHandle)>("handle")
+			.add_method("set_vector_callback", &T::set_vector_callback, "", "VectorCallback")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, string("LuaCondUser").append(type), tag);
 	}
@@ -135,6 +135,33 @@ class LuaUserData
 	///	evaluates the data at a given point and time
 		inline TRet evaluate(TData& D, const MathVector<dim>& x, number time, int si) const;
 
+	///	evaluates the data at all given points with one call
+	/**
+	 * If LUA2C is used, the compiled function is evaluated for all points at
+	 * once. Else, if a vector callback is set, the points are passed as one
+	 * call to the vector callback. Otherwise, the callback is called point
+	 * by point.
+	 */
+		inline void evaluate_at_ips(TData vValue[], const MathVector<dim> vGlobIP[],
+		                            number time, int si, const size_t nip) const;
+
+	///	sets a lua callback evaluating the data at arrays of points
+	/**
+	 * The callback is called with one table for each coordinate holding the
+	 * coordinates of all points, the time and the subset index. It must
+	 * return one table for each value that the (pointwise) callback returns,
+	 * holding the values of all points, e.g. for a conditional number in 2d:
+	 *
+	 * function name(vx, vy, t, si)
+	 *    ...
+	 *    return vbCond, vValue
+	 * end
+	 */
+		void set_vector_callback(const char* luaCallback);
+
+	///	returns string of required vector callback signature
+		static std::string vector_signature();
+
 	protected:
 	///	sets that LuaUserData is created by LuaUserDataFactory
 		void set_created_from_factory(bool bFromFactory) {m_bFromFactory = bFromFactory;}
@@ -145,6 +172,17 @@ class LuaUserData
 
 	///	reference to lua function
 		int m_callbackRef;
+
+	///	reference to lua function for arrays of points (LUA_NOREF if not used)
+		int m_vecCallbackRef;
+
+	///	name of lua function for arrays of points
+		std::string m_vecCallbackName;
+		
+		#ifdef USE_LUA2C
+	///	buffers for input and output of the compiled function
+			mutable std::vector<double> m_vLuaCompIn, m_vLuaCompOut;
+		#endif
 		
 		#ifdef USE_LUA2C
     	/// LUACompiler type for compiled LUA code
@@ -78,6 +78,23 @@ std::string LuaUserData<TData,dim,TRet>::signature()
 }
 
 
+template <typename TData, int dim, typename TRet>
+std::string LuaUserData<TData,dim,TRet>::vector_signature()
+{
+	std::stringstream ss;
+	ss << "function name(";
+	if(dim >= 1) ss << "vx";
+	if(dim >= 2) ss << ", vy";
+	if(dim >= 3) ss << ", vz";
+	ss << ", t, si)\n   ... \n   return ";
+	for(int i = 0; i < lua_traits<TRet>::size + lua_traits<TData>::size; ++i){
+		if(i != 0) ss << ", ";
+		ss << "Table";
+	}
+	ss << "\nend";
+	return ss.str();
+}
+
 template <typename TData, int dim, typename TRet>
 std::string LuaUserData<TData,dim,TRet>::name()
 {
@@ -90,7 +107,7 @@ std::string LuaUserData<TData,dim,TRet>::name()
 
 template <typename TData, int dim, typename TRet>
 LuaUserData<TData,dim,TRet>::LuaUserData(const char* luaCallback)
-	: m_callbackName(luaCallback), m_bFromFactory(false)
+	: m_callbackName(luaCallback), m_vecCallbackRef(LUA_NOREF), m_bFromFactory(false)
 {
 //	get lua state
 	m_L = ug::script::GetDefaultLuaState();
@@ -117,7 +134,8 @@ LuaUserData<TData,dim,TRet>::LuaUserData(const char* luaCallback)
 
 template <typename TData, int dim, typename TRet>
 LuaUserData<TData,dim,TRet>::LuaUserData(LuaFunctionHandle handle)
-	: m_callbackName("__anonymous__lua__function__"), m_bFromFactory(false)
+	: m_callbackName("__anonymous__lua__function__"), m_vecCallbackRef(LUA_NOREF),
+	  m_bFromFactory(false)
 {
 //	get lua state
 	m_L = ug::script::GetDefaultLuaState();
@@ -349,11 +367,152 @@ evaluate(TData& D, const MathVector<dim>& x, number time, int si) const
 	}
 }
 
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::
+set_vector_callback(const char* luaCallback)
+{
+//	obtain a reference
+	lua_getglobal(m_L, luaCallback);
+
+//	make sure that the reference is valid
+	if(lua_isnil(m_L, -1)){
+		lua_pop(m_L, 1);
+		UG_THROW(name() << ": Specified lua vector callback "
+						"does not exist: " << luaCallback);
+	}
+
+//	store reference to lua function
+	if(m_vecCallbackRef != LUA_NOREF)
+		luaL_unref(m_L, LUA_REGISTRYINDEX, m_vecCallbackRef);
+	m_vecCallbackRef = luaL_ref(m_L, LUA_REGISTRYINDEX);
+	m_vecCallbackName = luaCallback;
+
+//	make a test run with one point
+	TData D;
+	MathVector<dim> x; x = 0.0;
+	evaluate_at_ips(&D, &x, 0.0, 0, 1);
+}
+
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::
+evaluate_at_ips(TData vValue[], const MathVector<dim> vGlobIP[],
+                number time, int si, const size_t nip) const
+{
+	PROFILE_CALLBACK()
+	#ifdef USE_LUA2C
+	if(useLuaCompiler && m_luaComp.is_valid())
+	{
+		const size_t numIn = dim+2;
+		const size_t numOut = m_luaComp.num_out();
+		m_vLuaCompIn.resize(nip*numIn);
+		m_vLuaCompOut.resize(nip*numOut);
+		if(nip == 0) return;
+
+		for(size_t ip = 0; ip < nip; ++ip)
+		{
+			double* d = &m_vLuaCompIn[ip*numIn];
+			for(int i=0; i<dim; i++)
+				d[i] = vGlobIP[ip][i];
+			d[dim] = time;
+			d[dim+1] = si;
+		}
+
+		m_luaComp.call(&m_vLuaCompOut[0], &m_vLuaCompIn[0], nip);
+
+		TRet *t=NULL;
+		for(size_t ip = 0; ip < nip; ++ip)
+			lua_traits<TData>::read(vValue[ip], &m_vLuaCompOut[ip*numOut], t);
+		return;
+	}
+	#endif
+
+//	evaluate point by point, if no vector callback given
+	if(m_vecCallbackRef == LUA_NOREF)
+	{
+		for(size_t ip = 0; ip < nip; ++ip)
+			evaluate(vValue[ip], vGlobIP[ip], time, si);
+		return;
+	}
+
+//	remember the stack size, in order to clean up on errors
+	const int top = lua_gettop(m_L);
+
+//	push the callback function on the stack
+	lua_rawgeti(m_L, LUA_REGISTRYINDEX, m_vecCallbackRef);
+
+//  push one table per space coordinate on stack
+	for(int d = 0; d < dim; ++d)
+	{
+		lua_createtable(m_L, (int)nip, 0);
+		for(size_t ip = 0; ip < nip; ++ip)
+		{
+			lua_pushnumber(m_L, vGlobIP[ip][d]);
+			lua_rawseti(m_L, -2, (int)ip+1);
+		}
+	}
+
+//	push time and subset index on stack
+	lua_traits<number>::push(m_L, time);
+	lua_traits<int>::push(m_L, si);
+
+//	compute total args size
+	const int argSize = dim + lua_traits<number>::size + lua_traits<int>::size;
+
+//	compute total return size (one table per returned value)
+	const int retSize = lua_traits<TData>::size + lua_traits<TRet>::size;
+
+//	call lua function
+	if(lua_pcall(m_L, argSize, retSize, 0) != 0)
+	{
+		const char* msg = lua_tostring(m_L, -1);
+		const std::string luaMsg(msg ? msg : "");
+		lua_settop(m_L, top);
+		UG_THROW(name() << "::evaluate_at_ips(...): Error while "
+						"running vector callback '" << m_vecCallbackName << "',"
+						" lua message: "<< luaMsg <<".\n"
+						"Use signature as follows:\n"
+						<< vector_signature());
+	}
+
+	try{
+		try{
+			for(int i = 0; i < retSize; ++i)
+				if(!lua_istable(m_L, i - retSize))
+					UG_THROW("Return value " << i+1 << " is not a table.");
+
+		//	push the values of each point in pointwise order and read them
+			for(size_t ip = 0; ip < nip; ++ip)
+			{
+			//	(each push shifts the tables by one, so the next table is at -retSize)
+				for(int i = 0; i < retSize; ++i)
+					lua_rawgeti(m_L, -retSize, (int)ip+1);
+
+				bool res = false;
+				lua_traits<TData>::read(m_L, vValue[ip]);
+				lua_traits<TRet>::read(m_L, res, -retSize);
+
+				lua_pop(m_L, retSize);
+			}
+		}
+	//	pop the returned tables and the values read so far
+		catch(...) {lua_settop(m_L, top); throw;}
+	}
+	UG_CATCH_THROW(name() << "::evaluate_at_ips(...): Error while running "
+					"vector callback '" << m_vecCallbackName << "'.\n"
+					"Use signature as follows:\n"
+					<< vector_signature());
+
+//	pop tables
+	lua_pop(m_L, retSize);
+}
+
 template <typename TData, int dim, typename TRet>
 LuaUserData<TData,dim,TRet>::~LuaUserData()
 {
 //	free reference to callback
 	luaL_unref(m_L, LUA_REGISTRYINDEX, m_callbackRef);
+	if(m_vecCallbackRef != LUA_NOREF)
+		luaL_unref(m_L, LUA_REGISTRYINDEX, m_vecCallbackRef);
 
 	if(m_bFromFactory)
 		LuaUserDataFactory<TData,dim,TRet>::remove(m_callbackName);
@@ -197,6 +197,8 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_<matrix_type>(name, grp)
 			.add_constructor()
 			.add_method("print|hide=true", &matrix_type::p)
+			.add_method("freeze", &matrix_type::freeze, "", "",
+						"defragments the matrix and uses a plain CRS kernel until the sparsity pattern changes")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "Matrix", tag);
 	}
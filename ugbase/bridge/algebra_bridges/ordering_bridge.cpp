@@ -124,6 +124,18 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "NativeCuthillMcKeeOrdering", tag);
 	}
 
+//	Native Nested Dissection
+	{
+		typedef NativeNestedDissectionOrdering<TAlgebra, ordering_container_type> T;
+		typedef IOrderingAlgorithm<TAlgebra, ordering_container_type> TBase;
+		string name = string("NativeNestedDissectionOrdering").append(suffix);
+		reg.add_class_<T, TBase>(name, grp, "NativeNestedDissectionOrdering")
+			.add_constructor()
+			.add_method("set_leaf_size", &T::set_leaf_size)
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "NativeNestedDissectionOrdering", tag);
+	}
+
 //	Topological - for cycle-free matrices only
 	{
 		typedef TopologicalOrdering<TAlgebra, ordering_container_type> T;
@@ -167,10 +167,30 @@ static void Algebra(Registry& reg, string grp)
 			.add_constructor()
 			.template add_constructor<void (*)(number)>("DampingFactor")
 			//.add_method("set_block", &T::set_block, "", "block", "if true, use block smoothing (default), else diagonal smoothing")
+			.add_method("enable_reduced_precision", &T::enable_reduced_precision, "", "enable", "stores the inverse diagonal in reduced precision (float)")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "Jacobi", tag);
 	}
 
+//	Chebyshev
+	{
+		typedef Chebyshev<TAlgebra> T;
+		typedef IPreconditioner<TAlgebra> TBase;
+		string name = string("Chebyshev").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Chebyshev polynomial smoother")
+			.add_constructor()
+			.template add_constructor<void (*)(size_t)>("Degree")
+			.add_method("set_degree", &T::set_degree, "", "degree", "degree of the polynomial (matrix-vector products per step)")
+			.add_method("set_eigenvalue_ratio", &T::set_eigenvalue_ratio, "", "ratio", "ratio of largest and smallest eigenvalue of the smoothed interval")
+			.add_method("set_safety_factor", &T::set_safety_factor, "", "factor", "enlargement of the estimated largest eigenvalue")
+			.add_method("set_max_eigenvalue", &T::set_max_eigenvalue, "", "lambda", "largest eigenvalue of D^{-1}A (0 = estimate by power iteration)")
+			.add_method("set_power_method", &T::set_power_method, "", "maxIter#precision", "settings of the eigenvalue estimate")
+			.add_method("set_dirichlet_mask", &T::set_dirichlet_mask, "", "mask", "dofs with zero entries are excluded from the eigenvalue estimate")
+			.add_method("max_eigenvalue", &T::max_eigenvalue, "largest eigenvalue used")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "Chebyshev", tag);
+	}
+
 //	GaussSeidelBase
 	{
 		typedef GaussSeidelBase<TAlgebra> T;
@@ -179,6 +199,9 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_<T,TBase>(name, grp, "Gauss-Seidel Base")
 			.add_method("enable_consistent_interfaces", &T::enable_consistent_interfaces, "", "enable", "makes the matrix and defect consistent at the proc. interfaces")
 			.add_method("enable_overlap", &T::enable_overlap, "", "enable", "Enables matrix overlap. This also means that interfaces are consistent.")
+			.add_method("enable_level_scheduling", &T::enable_level_scheduling, "", "enable", "processes independent rows in parallel (threads), same results as sequential")
+			.add_method("enable_multicoloring", &T::enable_multicoloring, "", "enable", "processes the rows in a multicolor ordering in parallel (threads)")
+			.add_method("enable_reduced_precision", &T::enable_reduced_precision, "", "enable", "performs the sweeps with a copy of the matrix in reduced precision (float)")
 			//.add_method("set_ordering_algorithm", &T::set_ordering_algorithm, "", "",
 			//			"sets an ordering algorithm")
 			.add_method("set_sor_relax", &T::set_sor_relax,
@@ -252,6 +275,9 @@ static void Algebra(Registry& reg, string grp)
 						"set whether preprocessing (notably, LU factorization) is to be disabled - usable when the operator has not changed; use with care")
 			.add_method("enable_consistent_interfaces", &T::enable_consistent_interfaces, "", "enable", "Make Matrix consistent for connections in interfaces.")
 			.add_method("enable_overlap", &T::enable_overlap, "", "enable", "Enables matrix overlap. This also means that interfaces are consistent.")
+			.add_method("enable_level_scheduling", &T::enable_level_scheduling, "", "enable", "solves the triangular systems level by level in parallel (threads)")
+			.add_method("enable_symbolic_reuse", &T::enable_symbolic_reuse, "", "enable", "reuses the ordering if the sparsity pattern is unchanged")
+			.add_method("enable_reduced_precision", &T::enable_reduced_precision, "", "enable", "stores L and U in reduced precision (float)")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "ILU", tag);
 	}
@@ -271,6 +297,8 @@ static void Algebra(Registry& reg, string grp)
 			.add_method("set_ordering_algorithm", &T::set_ordering_algorithm, "", "",
 						"sets an ordering algorithm")
 			.add_method("set_sort", &T::set_sort, "", "bSort", "if bSort=true, use a cuthill-mckey sorting to reduce fill-in. default true")
+			.add_method("enable_symbolic_reuse", &T::enable_symbolic_reuse, "", "enable", "reuses ordering and pattern of L and U if the sparsity pattern is unchanged")
+			.add_method("enable_reduced_precision", &T::enable_reduced_precision, "", "enable", "stores L and U in reduced precision (float)")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "ILUT", tag);
 	}
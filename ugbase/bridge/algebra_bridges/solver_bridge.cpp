@@ -48,7 +48,10 @@
 #include "lib_algebra/operator/linear_solver/analyzing_solver.h"
 #include "lib_algebra/operator/linear_solver/cg.h"
 #include "lib_algebra/operator/linear_solver/bicgstab.h"
+#include "lib_algebra/operator/linear_solver/pipelined_cg.h"
+#include "lib_algebra/operator/linear_solver/pipelined_bicgstab.h"
 #include "lib_algebra/operator/linear_solver/gmres.h"
+#include "lib_algebra/operator/linear_solver/ca_gmres.h"
 #include "lib_algebra/operator/linear_solver/lu.h"
 #include "lib_algebra/operator/linear_solver/agglomerating_solver.h"
 #include "lib_algebra/operator/linear_solver/debug_iterator.h"
@@ -234,6 +237,34 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "BiCGStab", tag);
 	}
 
+// 	Pipelined CG Solver
+	{
+		typedef PipelinedCG<vector_type> T;
+		typedef IPreconditionedLinearOperatorInverse<vector_type> TBase;
+		string name = string("PipelinedCG").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Pipelined Conjugate Gradient Solver (one hidden reduction per iteration)")
+			.add_constructor()
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> > ) )("precond")
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> >, SmartPtr<IConvergenceCheck<vector_type> >) )("precond#convCheck")
+			.add_method("set_residual_replacement", &T::set_residual_replacement, "", "numSteps", "recomputes the defect every numSteps iterations (<= 0: never)")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "PipelinedCG", tag);
+	}
+
+// 	Pipelined BiCGStab Solver
+	{
+		typedef PipelinedBiCGStab<vector_type> T;
+		typedef IPreconditionedLinearOperatorInverse<vector_type> TBase;
+		string name = string("PipelinedBiCGStab").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Pipelined BiCGStab Solver (two hidden reductions per iteration)")
+			.add_constructor()
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> > ) )("precond")
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> >, SmartPtr<IConvergenceCheck<vector_type> >) )("precond#convCheck")
+			.add_method("set_residual_replacement", &T::set_residual_replacement, "", "numSteps", "recomputes the defect every numSteps iterations (<= 0: never)")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "PipelinedBiCGStab", tag);
+	}
+
 // 	GMRES Solver
 	{
 		typedef GMRES<vector_type> T;
@@ -247,6 +278,18 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "GMRES", tag);
 	}
 
+// 	CAGMRES Solver
+	{
+		typedef CAGMRES<vector_type> T;
+		typedef IPreconditionedLinearOperatorInverse<vector_type> TBase;
+		string name = string("CAGMRES").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Communication-avoiding (s-step) GMRES Solver")
+			.ADD_CONSTRUCTOR( (size_t restar, size_t s) )("restart#s")
+			.add_method("set_reorthogonalization", &T::set_reorthogonalization, "", "bReorth", "if true, a second block Gram-Schmidt pass is done. default true")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "CAGMRES", tag);
+	}
+
 // 	LU Solver
 	{
 		typedef LU<TAlgebra> T;
@@ -258,6 +301,8 @@ static void Algebra(Registry& reg, string grp)
 			.add_method("set_sort_sparse", &T::set_sort_sparse, "", "bSort", "if bSort=true, use a cuthill-mckey sorting to reduce fill-in in sparse LU. default true")
 			.add_method("set_info", &T::set_info, "", "bInfo", "if true, sparse LU prints some fill-in info")
 			.add_method("set_show_progress", &T::set_show_progress, "", "onoff", "switches the progress indicator on/off")
+			.add_method("set_supernodal", &T::set_supernodal, "", "bSupernodal", "if true, the sparse LU is a supernodal direct factorization instead of ILUT(0). default false")
+			.add_method("set_ordering_algorithm", &T::set_ordering_algorithm, "", "orderingAlgo", "fill reducing ordering of the supernodal LU. default: nested dissection")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "LU", tag);
 	}
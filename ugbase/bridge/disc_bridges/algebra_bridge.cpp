@@ -56,7 +56,9 @@
 #include "lib_disc/time_disc/time_integrator_observers/time_integrator_observer_interface.h"
 #include "lib_disc/time_disc/time_integrator_observers/lua_callback_observer.hpp"
 #include "lib_disc/time_disc/time_integrator_subject.hpp"
+#include "lib_disc/time_disc/adaptive_bdf_integrator.h"
 #include "lib_disc/operator/linear_operator/assembled_linear_operator.h"
+#include "lib_disc/operator/linear_operator/matrix_free_linear_operator.h"
 #include "lib_disc/operator/non_linear_operator/assembled_non_linear_operator.h"
 #include "lib_disc/operator/non_linear_operator/line_search.h"
 #include "lib_disc/operator/linear_operator/nested_iteration/nested_iteration.h"
@@ -265,6 +267,26 @@ static void Algebra(Registry& reg, string parentGroup)
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "AssembledLinearOperator", tag);
 	}
+
+//	MatrixFreeLinearOperator
+	{
+		std::string grp = parentGroup; grp.append("/Discretization");
+		typedef MatrixFreeLinearOperator<TAlgebra> T;
+		typedef MatrixOperator<matrix_type, vector_type> TBase;
+		string name = string("MatrixFreeLinearOperator").append(suffix);
+		reg.add_class_<T, TBase>(name, grp)
+			.add_constructor()
+			.template add_constructor<void (*)(SmartPtr<IAssemble<TAlgebra> >)>("Assembling Routine")
+			.template add_constructor<void (*)(SmartPtr<IAssemble<TAlgebra> >, const GridLevel&)>("AssemblingRoutine#GridLevel")
+			.add_method("set_discretization", &T::set_discretization)
+			.add_method("set_level", &T::set_level)
+			.add_method("set_dirichlet_values", &T::set_dirichlet_values)
+			.add_method("init_op_and_rhs", &T::init_op_and_rhs)
+			.add_method("level", &T::level)
+			.add_method("dirichlet_mask", &T::dirichlet_mask, "mask", "", "zero for the Dirichlet dofs, updated in init")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MatrixFreeLinearOperator", tag);
+	}
 	
 
 //	NewtonSolver
@@ -284,6 +306,8 @@ static void Algebra(Registry& reg, string parentGroup)
 			.add_method("disable_line_search", &T::disable_line_search)
 			.add_method("line_search", &T::line_search, "lineSeach", "")
 			.add_method("set_reassemble_J_freq", &T::set_reassemble_J_freq, "reassemble freq. for Jacobian")
+			.add_method("set_reuse_jacobian", &T::set_reuse_jacobian, "", "bReuse", "reuse Jacobian and linear solver of last call in first step")
+			.add_method("invalidate_jacobian", &T::invalidate_jacobian)
 			.add_method("init", &T::init, "success", "op")
 			.add_method("prepare", &T::prepare, "success", "u")
 			.add_method("apply", &T::apply, "success", "u")
@@ -650,6 +674,37 @@ static void DomainAlgebra(Registry& reg, string parentGroup)
 
 	}
 
+	{
+		std::string grp = parentGroup; grp.append("/Discretization/TimeDisc");
+		typedef AdaptiveBDFIntegrator<TDomain, TAlgebra> T;
+		typedef TimeIntegratorSubject<TDomain, TAlgebra> TBase;
+		typedef typename TAlgebra::vector_type vector_type;
+
+		string name = string("AdaptiveBDFIntegrator").append(suffix);
+		reg.add_class_<T, TBase>(name, grp)
+				  .template add_constructor<void (*)(SmartPtr<BDF<TAlgebra> >, SmartPtr<IOperatorInverse<vector_type> >) >("TimeDisc#Solver")
+				  .add_method("set_max_order", &T::set_max_order, "", "order")
+				  .add_method("set_tolerance", &T::set_tolerance, "", "relTol#absTol")
+				  .add_method("set_dt_start", &T::set_dt_start, "", "dt")
+				  .add_method("set_dt_min", &T::set_dt_min, "", "dt")
+				  .add_method("set_dt_max", &T::set_dt_max, "", "dt")
+				  .add_method("set_safety", &T::set_safety, "", "safety")
+				  .add_method("set_step_factors", &T::set_step_factors, "", "minFac#maxFac")
+				  .add_method("set_failure_factor", &T::set_failure_factor, "", "fac")
+				  .add_method("set_pi_parameters", &T::set_pi_parameters, "", "kI#kP")
+				  .add_method("set_jacobian_reuse_tolerance", &T::set_jacobian_reuse_tolerance, "", "tol")
+				  .add_method("apply", &T::apply, "success", "u#t0#tEnd")
+				  .add_method("num_accepted_steps", &T::num_accepted_steps)
+				  .add_method("num_rejected_steps", &T::num_rejected_steps)
+				  .add_method("num_failed_steps", &T::num_failed_steps)
+				  .add_method("num_jacobian_reuses", &T::num_jacobian_reuses)
+				  .add_method("print_statistics", &T::print_statistics)
+				  .add_method("last_dt", &T::last_dt)
+				  .add_method("config_string", &T::config_string)
+				  .set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "AdaptiveBDFIntegrator", tag);
+	}
+
 
 	{
 		std::string grp = parentGroup; grp.append("/Discretization/TimeIntegratorObservers");
@@ -44,6 +44,7 @@
 #include "lib_disc/domain.h"
 #include "lib_disc/spatial_disc/domain_disc.h"
 #include "lib_disc/spatial_disc/dom_disc_embb.h"
+#include "lib_disc/spatial_disc/domain_disc_threaded.h"
 #include "lib_disc/parallelization/domain_distribution.h"
 #include "lib_disc/function_spaces/grid_function.h"
 
@@ -118,6 +119,28 @@ static void DomainAlgebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "DomainDiscretization", tag);
 	}
 
+//	ThreadedDomainDiscretization
+	{
+		typedef IDomainDiscretization<TAlgebra> TBase;
+		typedef ThreadedDomainDiscretization<TDomain, TAlgebra> T;
+		string name = string("ThreadedDomainDiscretization").append(suffix);
+		reg.add_class_<T, TBase>(name, domDiscGrp)
+			.template add_constructor<void (*)(SmartPtr<ApproximationSpace<TDomain> >)>("ApproximationSpace")
+			.add_method("add", static_cast<void (T::*)(SmartPtr<IDomainConstraint<TDomain, TAlgebra> >)>(&T::add), "", "Post Process")
+			.add_method("remove", static_cast<void (T::*)(SmartPtr<IDomainConstraint<TDomain, TAlgebra> >)>(&T::remove), "", "Post Process")
+			.add_method("add", static_cast<void (T::*)(SmartPtr<IElemDisc<TDomain> >)>(&T::add), "", "Element Discretization")
+			.add_method("remove", static_cast<void (T::*)(SmartPtr<IElemDisc<TDomain> >)>(&T::remove), "", "Element Discretization")
+			.add_method("add", static_cast<void (T::*)(SmartPtr<IDiscretizationItem<TDomain, TAlgebra> >)>(&T::add), "", "DiscItem")
+			.add_method("assemble_linear", static_cast<void (T::*)(typename TAlgebra::matrix_type&, GridFunction<TDomain, TAlgebra>&)>(&T::assemble_linear))
+			.add_method("assemble_rhs", static_cast<void (T::*)(typename TAlgebra::vector_type&, GridFunction<TDomain, TAlgebra>&)>(&T::assemble_rhs))
+			.add_method("assemble_rhs", static_cast<void (T::*)(GridFunction<TDomain, TAlgebra>&)>(&T::assemble_rhs))
+			.add_method("adjust_solution", static_cast<void (T::*)(GridFunction<TDomain, TAlgebra>&)>(&T::adjust_solution))
+			.add_method("ass_tuner", static_cast<SmartPtr<AssemblingTuner<TAlgebra> > (T::*) ()> (&T::ass_tuner), "assembling tuner", "", "get this domain discretization's assembling tuner")
+			.add_method("approximation_space", static_cast<SmartPtr<ApproximationSpace<TDomain> > (T::*) ()> (&T::approximation_space), "approximation space", "", "get this domain discretization's approximation space")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "ThreadedDomainDiscretization", tag);
+	}
+
 //	IDiscretizationItem
 	{
 		typedef IDiscretizationItem<TDomain, TAlgebra> T;
@@ -250,6 +273,10 @@ static void Algebra(Registry& reg, string grp)
 				"whether matrix is constant in time", "")
 			.add_method("set_matrix_structure_is_const", &T::set_matrix_structure_is_const, "",
 				"whether matrix has constant in time structure", "")
+			.add_method("set_incremental_jacobian", &T::set_incremental_jacobian, "",
+				"Enable#Tolerance", "reassemble only elements with changed local solution")
+			.add_method("invalidate_incremental_jacobian", &T::invalidate_incremental_jacobian, "",
+				"", "forces a full reassembling of the Jacobian")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name+suffix, name, tag);
 	}
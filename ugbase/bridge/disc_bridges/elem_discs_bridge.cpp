@@ -155,6 +155,7 @@ static void Domain(Registry& reg, string grp)
 		string name = string("NeumannBoundaryFV1").append(suffix);
 		reg.add_class_<T, TBase >(name, elemGrp)
 			.template add_constructor<void (*)(const char*)>("Function")
+			.add_method("set_geometry_cache", &T::set_geometry_cache, "", "Cache#MaxMemory")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "NeumannBoundaryFV1", tag);
 	}
@@ -37,6 +37,7 @@
 #include "common/util/file_util.h"
 #include "common/util/path_provider.h"
 #include "common/util/table.h"
+#include "common/util/thread_util.h"
 #include "common/util/variant.h"
 #include "registry/registry.h"
 #if defined (__APPLE__) || defined (__linux__)
@@ -170,6 +171,15 @@ void RegisterBridge_Util(Registry& reg, string parentGroup)
 
 	reg.add_function("FindFileInStandardPaths", FindFileInStandardPaths);
 
+	reg.add_function("ThreadingAvailable", &ThreadingAvailable, grp,
+	                 "available", "", "Returns true if ug was compiled with OpenMP support");
+	reg.add_function("SetNumThreads", &SetNumThreads, grp,
+	                 "", "numThreads", "Sets the number of threads used by the shared-memory algebra kernels");
+	reg.add_function("NumThreads", &NumThreads, grp,
+	                 "numThreads", "", "Returns the number of threads used by the shared-memory algebra kernels");
+	reg.add_function("SetThreadingMinLoopSize", &SetThreadingMinLoopSize, grp,
+	                 "", "minSize", "Loops shorter than minSize are always executed sequentially");
+
 	{
 		typedef Variant T;
 		reg.add_class_<T>("Variant", grp)
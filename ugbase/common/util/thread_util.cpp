@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include "thread_util.h"
+#include "common/error.h"
+
+namespace ug
+{
+
+static size_t g_threadingMinLoopSize = 4096;
+
+bool ThreadingAvailable()
+{
+#ifdef UG_OPENMP
+	return true;
+#else
+	return false;
+#endif
+}
+
+void SetNumThreads(int numThreads)
+{
+	UG_COND_THROW(numThreads < 1, "SetNumThreads: number of threads must be "
+				  "positive, but " << numThreads << " requested.");
+#ifdef UG_OPENMP
+	omp_set_num_threads(numThreads);
+#else
+	UG_COND_THROW(numThreads != 1, "SetNumThreads: ug has been compiled "
+				  "without OpenMP support, only one thread available. "
+				  "Use cmake -DOPENMP=ON to enable threading.");
+#endif
+}
+
+int NumThreads()
+{
+#ifdef UG_OPENMP
+	return omp_get_max_threads();
+#else
+	return 1;
+#endif
+}
+
+void SetThreadingMinLoopSize(size_t minSize)
+{
+	g_threadingMinLoopSize = minSize;
+}
+
+size_t ThreadingMinLoopSize()
+{
+	return g_threadingMinLoopSize;
+}
+
+bool UseThreads(size_t loopSize)
+{
+#ifdef UG_OPENMP
+	return loopSize >= g_threadingMinLoopSize && omp_get_max_threads() > 1
+			&& !omp_in_parallel();
+#else
+	return false;
+#endif
+}
+
+}//	end of namespace
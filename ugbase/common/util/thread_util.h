@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__thread_util__
+#define __H__UG__thread_util__
+
+#include <cstddef>
+#include "common/ug_config.h"
+
+#ifdef UG_OPENMP
+	#include <omp.h>
+#endif
+
+///	storage class specifier for data of which each thread needs its own instance
+/**	Used e.g. for singletons holding element-wise data that are accessed in
+ * the threaded assembling. Without OpenMP support all data is shared by the
+ * (only) thread.*/
+#ifdef UG_OPENMP
+	#define UG_THREAD_LOCAL thread_local
+#else
+	#define UG_THREAD_LOCAL
+#endif
+
+namespace ug
+{
+
+/// \addtogroup ugbase_common_util
+/// \{
+
+///	returns true if ug has been compiled with shared-memory threading (OPENMP=ON)
+UG_API bool ThreadingAvailable();
+
+///	sets the number of threads used by the shared-memory kernels of this process
+/**	Without OpenMP support only numThreads == 1 is accepted. The initial value
+ * is taken from the OpenMP runtime, i.e. from the environment variable
+ * OMP_NUM_THREADS if set.*/
+UG_API void SetNumThreads(int numThreads);
+
+///	returns the number of threads used by the shared-memory kernels
+UG_API int NumThreads();
+
+///	sets the minimal loop length for which shared-memory kernels are executed in parallel
+/**	Shorter loops are always executed by the calling thread only, since
+ * the costs for starting a parallel region would dominate there.*/
+UG_API void SetThreadingMinLoopSize(size_t minSize);
+
+///	returns the minimal loop length for which shared-memory kernels are executed in parallel
+UG_API size_t ThreadingMinLoopSize();
+
+///	returns true if a loop of the given length should be executed multithreaded
+UG_API bool UseThreads(size_t loopSize);
+
+// end group ugbase_common_util
+/// \}
+
+}//	end of namespace
+
+#endif
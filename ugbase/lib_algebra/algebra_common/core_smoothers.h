@@ -34,6 +34,8 @@
 #define __H__UG__CPU_ALGEBRA__CORE_SMOOTHERS__
 ////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "level_scheduling.h"
+
 namespace ug
 {
 
@@ -205,6 +207,50 @@ void sgs_step(const Matrix_type &A, Vector_type &c, const Vector_type &d, const
 	gs_step_UR(A, c, c, relaxFactor);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////
+//	level scheduled variants
+/**
+ * \brief Performs a forward gauss-seidel-step on a level scheduled lower triangle.
+ * The rows of each level are processed in parallel. If L has been created by
+ * LevelScheduledTriangularMatrix::init, the result is identical to gs_step_LL(A, ...).
+ * \param L lower triangular part of A, created with bLower = true
+ * \sa gs_step_LL, LevelScheduledTriangularMatrix
+ */
+template<typename TBlock, typename Vector_type>
+void gs_step_LL(const LevelScheduledTriangularMatrix<TBlock> &L, Vector_type &c, const Vector_type &d, const number relaxFactor)
+{
+	L.apply(c, d, relaxFactor, false);
+}
+
+/**
+ * \brief Performs a backward gauss-seidel-step on a level scheduled upper triangle.
+ * \param U upper triangular part of A, created with bLower = false
+ * \sa gs_step_UR, LevelScheduledTriangularMatrix
+ */
+template<typename TBlock, typename Vector_type>
+void gs_step_UR(const LevelScheduledTriangularMatrix<TBlock> &U, Vector_type &c, const Vector_type &d, const number relaxFactor)
+{
+	U.apply(c, d, relaxFactor, false);
+}
+
+/**
+ * \brief Performs a symmetric gauss-seidel step on level scheduled triangles.
+ * \sa sgs_step, LevelScheduledTriangularMatrix
+ */
+template<typename TBlock, typename Vector_type>
+void sgs_step(const LevelScheduledTriangularMatrix<TBlock> &L, const LevelScheduledTriangularMatrix<TBlock> &U,
+              Vector_type &c, const Vector_type &d, const number relaxFactor)
+{
+	// c1 = (D-L)^{-1} d
+	L.apply(c, d, relaxFactor, false);
+
+	// c2 = D c1
+	L.apply_diag(c);
+
+	// c3 = (D-U)^{-1} c2
+	U.apply(c, c, relaxFactor, false);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////
 //	diag_step
 /**
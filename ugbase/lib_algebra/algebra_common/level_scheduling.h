@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__LEVEL_SCHEDULING__
+#define __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__LEVEL_SCHEDULING__
+
+#include <vector>
+#include <algorithm>
+#include "common/common.h"
+#include "common/profiler/profiler.h"
+#include "common/util/thread_util.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+
+namespace ug{
+
+/// \addtogroup lib_algebra
+///	@{
+
+/**
+ * Computes a greedy coloring of the rows of a matrix, such that no two rows
+ * of the same color are coupled, i.e. A(i,j) == 0 and A(j,i) == 0 for all
+ * i != j of the same color.
+ * @param[in]	A		the matrix
+ * @param[out]	vColor	vColor[i] is the color of row i
+ * @return number of colors used
+ */
+template<typename TMatrix>
+size_t ComputeMatrixColoring(const TMatrix &A, std::vector<size_t> &vColor)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	typedef typename TMatrix::const_row_iterator const_row_iterator;
+	const size_t n = A.num_rows();
+
+//	pattern of A^T, so that both couplings (i,j) and (j,i) are respected
+	std::vector<size_t> vTStart(n+1, 0);
+	for(size_t i=0; i<n; i++)
+		for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+			if(it.index() < n) vTStart[it.index()+1]++;
+	for(size_t i=0; i<n; i++) vTStart[i+1] += vTStart[i];
+	std::vector<size_t> vTRow(vTStart[n]), vPos(vTStart.begin(), vTStart.end()-1);
+	for(size_t i=0; i<n; i++)
+		for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+			if(it.index() < n) vTRow[vPos[it.index()]++] = i;
+
+	const size_t noColor = (size_t)-1;
+	vColor.clear(); vColor.resize(n, noColor);
+	std::vector<size_t> vMark;
+	size_t numColors = 0;
+	for(size_t i=0; i<n; i++)
+	{
+	//	mark colors of the already colored neighbors with i
+		for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+			if(it.index() < n && vColor[it.index()] != noColor)
+				vMark[vColor[it.index()]] = i;
+		for(size_t k=vTStart[i]; k<vTStart[i+1]; k++)
+			if(vColor[vTRow[k]] != noColor)
+				vMark[vColor[vTRow[k]]] = i;
+
+	//	smallest unmarked color
+		size_t c = 0;
+		while(c < numColors && vMark[c] == i) c++;
+		if(c == numColors) { numColors++; vMark.push_back(noColor); }
+		vColor[i] = c;
+	}
+	return numColors;
+}
+
+/**
+ * The strict lower or upper triangular part of a matrix (plus its diagonal),
+ * with the rows grouped into levels of mutually independent rows, so that
+ * the forward/backward substitution can process each level in parallel.
+ *
+ * Two kinds of schedules can be created:
+ * - init(A, bLower): level scheduling of the triangular part in the natural
+ *   ordering. Row i is on level 1 + max(level(j)) of all rows j it depends on.
+ *   Since every row is computed with the same operations in the same order as
+ *   in the sequential substitution, the results are identical to the
+ *   sequential ones.
+ * - init_colored(A, bLower, vColor, numColors): multicolor ordering. Row i
+ *   depends on all coupled rows of lower (bLower) resp. higher color. This
+ *   corresponds to the substitution in the ordering by colors, i.e. the results
+ *   differ from the natural ordering, but there are only numColors levels.
+ *
+ * The entries are copied, so that each level is stored contiguously. The
+ * schedule has to be recreated when the matrix changes.
+ *
+ * Note that a level is only processed multithreaded if it has at least
+ * ThreadingMinLoopSize() rows (see common/util/thread_util.h).
+ */
+template<typename TBlock>
+class LevelScheduledTriangularMatrix
+{
+	public:
+		typedef TBlock value_type;
+
+	public:
+		LevelScheduledTriangularMatrix() {}
+
+	///	creates the level schedule for the natural ordering of the rows
+		template<typename TMatrix>
+		void init(const TMatrix &A, bool bLower)
+		{
+			PROFILE_FUNC_GROUP("algebra");
+			const size_t n = A.num_rows();
+			std::vector<size_t> vKey(n);
+			for(size_t i=0; i<n; i++) vKey[i] = i;
+
+		//	level of row i: one more than all rows it depends on
+			std::vector<size_t> vLevel(n, 0);
+			size_t numLevels = 0;
+			for(size_t k=0; k<n; k++)
+			{
+				const size_t i = bLower ? k : n-1-k;
+				size_t level = 0;
+				for(typename TMatrix::const_row_iterator it = A.begin_row(i);
+						it != A.end_row(i); ++it)
+				{
+					const size_t j = it.index();
+					if((bLower && j < i) || (!bLower && j > i && j < n))
+						level = std::max(level, vLevel[j]+1);
+				}
+				vLevel[i] = level;
+				numLevels = std::max(numLevels, level+1);
+			}
+
+			create(A, bLower, vKey, vLevel, numLevels);
+		}
+
+	///	creates the schedule for the multicolor ordering of the rows
+		template<typename TMatrix>
+		void init_colored(const TMatrix &A, bool bLower,
+		                  const std::vector<size_t> &vColor, size_t numColors)
+		{
+			PROFILE_FUNC_GROUP("algebra");
+			UG_COND_THROW(vColor.size() != A.num_rows(), "LevelScheduledTriangularMatrix: "
+						  "number of colors does not match matrix size.");
+
+		//	backward sweeps process the colors in reverse order
+			std::vector<size_t> vLevel(vColor);
+			if(!bLower)
+				for(size_t i=0; i<vLevel.size(); i++)
+					vLevel[i] = numColors-1-vColor[i];
+
+			create(A, bLower, vColor, vLevel, numColors);
+		}
+
+	///	clears the schedule
+		void clear()
+		{
+			std::vector<size_t>().swap(m_vLevelStart);
+			std::vector<size_t>().swap(m_vRow);
+			std::vector<size_t>().swap(m_vRowStart);
+			std::vector<size_t>().swap(m_vCol);
+			std::vector<value_type>().swap(m_vValue);
+			std::vector<value_type>().swap(m_vDiag);
+		}
+
+	///	number of rows
+		size_t num_rows() const {return m_vRow.size();}
+
+	///	number of levels
+		size_t num_levels() const {return m_vLevelStart.empty() ? 0 : m_vLevelStart.size()-1;}
+
+	///	solves the triangular system
+	/**
+	 * computes c[i] = relax * D(i,i)^{-1} (d[i] - sum_j T(i,j) c[j]) level by
+	 * level, where T is the triangular part. c and d may be the same vector.
+	 *
+	 * @param c				solution
+	 * @param d				right hand side
+	 * @param relax			relaxation factor
+	 * @param bUnitDiag		if true, the diagonal is assumed to be the identity
+	 * 						(and relax is ignored)
+	 * @param lastRowEps	if >= 0, the correction of the last row is set to
+	 * 						zero if its diagonal is smaller than
+	 * 						lastRowEps*|rhs| (as done in ILU's invert_U)
+	 * @return false if the last row had to be set to zero
+	 */
+		template<typename TVector>
+		bool apply(TVector &c, const TVector &d, number relax,
+		           bool bUnitDiag, number lastRowEps = -1.0) const
+		{
+			const size_t lastRow = num_rows()-1;
+			bool bResult = true;
+			number lastDiagNorm = 0.0, lastRhsNorm = 0.0;
+			for(size_t l=0; l<num_levels(); l++)
+			{
+				const size_t kBegin = m_vLevelStart[l];
+				const size_t kEnd = m_vLevelStart[l+1];
+
+				#ifdef UG_OPENMP
+				#pragma omp parallel for schedule(static) if(UseThreads(kEnd-kBegin))
+				#endif
+				for(size_t k=kBegin; k<kEnd; k++)
+				{
+					const size_t i = m_vRow[k];
+					typename TVector::value_type s = d[i];
+					for(size_t e=m_vRowStart[k]; e<m_vRowStart[k+1]; e++)
+						MatMultAdd(s, 1.0, s, -1.0, m_vValue[e], c[m_vCol[e]]);
+
+					if(bUnitDiag)
+						c[i] = s;
+					else if(lastRowEps >= 0 && i == lastRow
+							&& BlockNorm(m_vDiag[k]) <= lastRowEps * BlockNorm(s))
+					{
+					//	only one row is the last one, thus written by one thread only
+						lastDiagNorm = BlockNorm(m_vDiag[k]);
+						lastRhsNorm = BlockNorm(s);
+						c[i] = 0;
+						bResult = false;
+					}
+					else
+						InverseMatMult(c[i], relax, m_vDiag[k], s);
+				}
+			}
+
+			if(!bResult)
+				UG_LOG("ILU Warning: Near-zero last diagonal entry "
+						"with norm "<<lastDiagNorm<<" in U "
+						"for non-near-zero rhs entry with norm "
+						<< lastRhsNorm << ". Setting rhs to zero.\n");
+			return bResult;
+		}
+
+	///	computes c = D*c, with D the diagonal
+		template<typename TVector>
+		void apply_diag(TVector &c) const
+		{
+			const size_t n = num_rows();
+			#ifdef UG_OPENMP
+			#pragma omp parallel for schedule(static) if(UseThreads(n))
+			#endif
+			for(size_t k=0; k<n; k++)
+			{
+				const size_t i = m_vRow[k];
+				typename TVector::value_type s = c[i];
+				MatMult(c[i], 1.0, m_vDiag[k], s);
+			}
+		}
+
+	protected:
+	///	copies the triangular part of A sorted by levels
+	/**
+	 * an entry (i,j), j != i, belongs to the triangular part if
+	 * vKey[j] < vKey[i] (bLower) resp. vKey[j] > vKey[i] (!bLower). Within a
+	 * level the rows are sorted ascending.
+	 */
+		template<typename TMatrix>
+		void create(const TMatrix &A, bool bLower, const std::vector<size_t> &vKey,
+		            const std::vector<size_t> &vLevel, size_t numLevels)
+		{
+			typedef typename TMatrix::const_row_iterator const_row_iterator;
+			const size_t n = A.num_rows();
+			clear();
+
+		//	sort rows by level (counting sort, stable)
+			m_vLevelStart.resize(numLevels+1, 0);
+			for(size_t i=0; i<n; i++) m_vLevelStart[vLevel[i]+1]++;
+			for(size_t l=0; l<numLevels; l++) m_vLevelStart[l+1] += m_vLevelStart[l];
+			std::vector<size_t> vPos(m_vLevelStart.begin(), m_vLevelStart.end()-1);
+			m_vRow.resize(n);
+			for(size_t i=0; i<n; i++) m_vRow[vPos[vLevel[i]]++] = i;
+
+		//	copy entries
+			m_vRowStart.resize(n+1);
+			m_vDiag.resize(n);
+			m_vRowStart[0] = 0;
+			for(size_t k=0; k<n; k++)
+			{
+				const size_t i = m_vRow[k];
+				m_vDiag[k] = value_type(0);
+				for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+				{
+					const size_t j = it.index();
+					if(j == i)
+						m_vDiag[k] = it.value();
+					else if(j < n && ((bLower && vKey[j] < vKey[i])
+								   || (!bLower && vKey[j] > vKey[i])))
+					{
+						m_vCol.push_back(j);
+						m_vValue.push_back(it.value());
+					}
+					else if(j < n && vKey[j] == vKey[i])
+						UG_THROW("LevelScheduledTriangularMatrix: rows " << i << " and "
+								 << j << " are coupled, but on the same level.");
+				}
+				m_vRowStart[k+1] = m_vCol.size();
+			}
+		}
+
+	protected:
+		std::vector<size_t> m_vLevelStart;	///< level l are positions m_vLevelStart[l] ... m_vLevelStart[l+1]-1
+		std::vector<size_t> m_vRow;			///< row index of position k
+		std::vector<size_t> m_vRowStart;	///< entries of position k are m_vRowStart[k] ... m_vRowStart[k+1]-1
+		std::vector<size_t> m_vCol;			///< column index of the entries
+		std::vector<value_type> m_vValue;	///< values of the entries
+		std::vector<value_type> m_vDiag;	///< diagonal of position k
+};
+
+/// @}
+
+} // end namespace ug
+
+#endif // __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__LEVEL_SCHEDULING__
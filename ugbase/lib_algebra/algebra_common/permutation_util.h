@@ -38,6 +38,7 @@
 #include "common/error.h"
 #include "lib_algebra/ordering_strategies/algorithms/native_cuthill_mckee.h"
 #include <vector>
+#include <algorithm>
 
 namespace ug{
 /**
@@ -64,6 +65,38 @@ static void SetMatrixAsPermutation(TMatrix &PA, const TMatrix &A, const std::vec
 }
 
 
+/**
+ * Function to return a permutation of a matrix
+ * Same as SetMatrixAsPermutation(PA, A, perm), but the rows of PA are created
+ * one after another with sorted columns, so that no entries have to be
+ * inserted into existing rows. Requires the inverse permutation.
+ * @param[out] PA the permuted matrix PA(perm[r], perm[c]) = A(r, c)
+ * @param[in] A the input matrix
+ * @param[in] perm array mapping i -> perm[i]
+ * @param[in] invPerm inverse of perm, perm[invPerm[i]] = i
+ */
+template<typename TMatrix>
+static void SetMatrixAsPermutation(TMatrix &PA, const TMatrix &A, const std::vector<size_t> &perm,
+                                   const std::vector<size_t> &invPerm)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	typedef typename TMatrix::connection connection;
+	PA.resize_and_clear(A.num_rows(), A.num_cols());
+
+	std::vector<connection> con;
+	for(size_t Pr=0; Pr<A.num_rows(); Pr++)
+	{
+		const size_t r = invPerm[Pr];
+		con.clear();
+		for(typename TMatrix::const_row_iterator it = A.begin_row(r); it != A.end_row(r); ++it)
+			con.push_back(connection(perm[it.index()], it.value()));
+		std::sort(con.begin(), con.end());
+		if(!con.empty())
+			PA.set_matrix_row(Pr, &con[0], con.size());
+	}
+}
+
+
 /**
  * Function to compute a permutation of a vector
  * @param[out] Pv the permuted vector: Pv[perm[i]] = v[i]
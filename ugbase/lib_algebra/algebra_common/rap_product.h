@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+
+#ifndef __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__RAP_PRODUCT__
+#define __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__RAP_PRODUCT__
+
+#include <vector>
+#include <algorithm>
+#include "common/common.h"
+#include "common/profiler/profiler.h"
+#include "common/util/thread_util.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+
+namespace ug{
+
+/// \addtogroup lib_algebra
+///	@{
+
+/**
+ * Galerkin triple product M += R*A*P with a cached sparsity pattern.
+ *
+ * The product is split into a symbolic and a numeric phase:
+ * - init(M, R, A, P) computes the pattern of R*A*P from the sparsity patterns
+ *   (not the values) of R, A and P, inserts the missing connections into M and
+ *   caches the positions of the pattern entries in the value storage of M.
+ * - add(M, R, A, P) computes the values row by row. The entries of a row are
+ *   accumulated in a dense array indexed by the position in the pattern row
+ *   (sparse accumulator), and then added to M at the cached positions.
+ *
+ * Both phases process the rows of M independently and are executed
+ * multithreaded if the number of rows is at least ThreadingMinLoopSize()
+ * (see common/util/thread_util.h). Only in this case the factors are copied
+ * to plain CRS arrays, since the row iterators of the matrices must not be
+ * used concurrently; otherwise the factors are accessed directly. Since all
+ * connections are inserted in the symbolic phase, the numeric phase does not
+ * change the pattern of M.
+ *
+ * If the sparsity patterns of R, A and P do not change (e.g. only the values
+ * of A change in a Newton iteration), the pattern can be reused, so that only
+ * the numeric phase has to be executed. To detect changes, the column
+ * structure of the factors is stored in the symbolic phase and compared
+ * before the pattern is reused. Note that in contrast to
+ * AddMultiplyOf the pattern contains connections resulting from zero
+ * entries of the factors, since these may become non-zero later.
+ *
+ * \tparam	TMatrix		the matrix type (SparseMatrix or ParallelMatrix)
+ */
+template<typename TMatrix>
+class RAPProduct
+{
+	public:
+		typedef TMatrix matrix_type;
+		typedef typename TMatrix::value_type value_type;
+
+	public:
+		RAPProduct() : m_numRows(0), m_numCols(0) {}
+
+	///	removes the pattern
+		void clear()
+		{
+			m_vRowStart.clear(); m_vCol.clear(); m_vPos.clear();
+			m_patternR.clear(); m_patternA.clear(); m_patternP.clear();
+			m_numRows = m_numCols = 0;
+		}
+
+	///	returns if a pattern has been computed
+		bool valid() const {return !m_vRowStart.empty();}
+
+	///	returns if the pattern has been computed for factors with this column structure
+		bool matches(const TMatrix& R, const TMatrix& A, const TMatrix& P) const
+		{
+			return matches(R, A, P, MatrixRows(R), MatrixRows(A), MatrixRows(P));
+		}
+
+	///	computes the pattern of R*A*P and inserts it into M
+		void init(TMatrix& M, const TMatrix& R, const TMatrix& A, const TMatrix& P)
+		{
+			if(UseThreads(R.num_rows())){
+				CRS crsR(R), crsA(A), crsP(P);
+				init(M, R, A, P, crsR, crsA, crsP);
+			}
+			else
+				init(M, R, A, P, MatrixRows(R), MatrixRows(A), MatrixRows(P));
+		}
+
+	///	computes M += R*A*P, the pattern must have been computed by init
+		void add(TMatrix& M, const TMatrix& R, const TMatrix& A, const TMatrix& P)
+		{
+			if(!matches(R, A, P))
+				UG_THROW("RAPProduct::add: Pattern has not been computed for these matrices.");
+			if(UseThreads(R.num_rows())){
+				CRS crsR(R), crsA(A), crsP(P);
+				add(M, R, A, P, crsR, crsA, crsP);
+			}
+			else
+				add(M, R, A, P, MatrixRows(R), MatrixRows(A), MatrixRows(P));
+		}
+
+	///	computes M += R*A*P, recomputing the pattern only if needed
+	/**
+	 * If bReusePattern is false, the pattern is always recomputed. Otherwise
+	 * it is only recomputed if the column structure of the factors has changed.
+	 */
+		void add_product(TMatrix& M, const TMatrix& R, const TMatrix& A,
+		                 const TMatrix& P, bool bReusePattern)
+		{
+			if(UseThreads(R.num_rows())){
+				CRS crsR(R), crsA(A), crsP(P);
+				add_product(M, R, A, P, bReusePattern, crsR, crsA, crsP);
+			}
+			else
+				add_product(M, R, A, P, bReusePattern,
+				            MatrixRows(R), MatrixRows(A), MatrixRows(P));
+		}
+
+	protected:
+	///	direct access to the rows of a factor (single threaded only)
+		struct MatrixRows
+		{
+			typedef typename TMatrix::const_row_iterator iterator;
+
+			explicit MatrixRows(const TMatrix& mat) : m(mat) {}
+
+			iterator begin(int i) const {return m.begin_row(i);}
+			iterator end(int i) const {return m.end_row(i);}
+			static int col(const iterator& it) {return (int)it.index();}
+			static const value_type& value(const iterator& it) {return it.value();}
+
+			const TMatrix& m;
+		};
+
+	///	CRS copy of a factor
+	/**	The matrices are copied for multithreaded access, since their row
+	 * iterators must not be used concurrently by several threads.*/
+		struct CRS
+		{
+			typedef int iterator;
+
+			size_t numRows, numCols;
+			std::vector<value_type> vValue;
+			std::vector<int> vRowStart;
+			std::vector<int> vCol;
+
+			explicit CRS(const TMatrix& mat)
+			{
+				if(mat.num_rows() == 0){
+					numRows = 0; numCols = mat.num_cols();
+					vRowStart.assign(1, 0);
+					return;
+				}
+				mat.copy_crs(numRows, numCols, vValue, vRowStart, vCol);
+			}
+
+			iterator begin(int i) const {return vRowStart[i];}
+			iterator end(int i) const {return vRowStart[i+1];}
+			int col(iterator k) const {return vCol[k];}
+			const value_type& value(iterator k) const {return vValue[k];}
+		};
+
+	///	column structure of a factor
+		struct Pattern
+		{
+			std::vector<int> vRowStart;
+			std::vector<int> vCol;
+
+			void clear() {vRowStart.clear(); vCol.clear();}
+
+			template <typename TRows>
+			void assign(const TMatrix& mat, const TRows& rows)
+			{
+				const int numRows = (int)mat.num_rows();
+				vRowStart.resize(numRows+1);
+				vRowStart[0] = 0;
+				vCol.clear();
+				vCol.reserve(mat.total_num_connections());
+				for(int i = 0; i < numRows; ++i)
+				{
+					for(typename TRows::iterator it = rows.begin(i), itEnd = rows.end(i);
+						it != itEnd; ++it)
+						vCol.push_back(rows.col(it));
+					vRowStart[i+1] = (int)vCol.size();
+				}
+			}
+
+			template <typename TRows>
+			bool equals(const TMatrix& mat, const TRows& rows) const
+			{
+				const int numRows = (int)mat.num_rows();
+				if((int)vRowStart.size() != numRows+1) return false;
+				int pos = 0;
+				for(int i = 0; i < numRows; ++i)
+				{
+					for(typename TRows::iterator it = rows.begin(i), itEnd = rows.end(i);
+						it != itEnd; ++it, ++pos)
+						if(pos >= (int)vCol.size() || vCol[pos] != rows.col(it))
+							return false;
+					if(vRowStart[i+1] != pos) return false;
+				}
+				return true;
+			}
+		};
+
+	///	returns if the pattern has been computed for factors with this column structure
+		template <typename TRows>
+		bool matches(const TMatrix& R, const TMatrix& A, const TMatrix& P,
+		             const TRows& rowsR, const TRows& rowsA, const TRows& rowsP) const
+		{
+			return valid()
+				&& m_numRows == R.num_rows() && m_numCols == P.num_cols()
+				&& m_patternR.equals(R, rowsR)
+				&& m_patternA.equals(A, rowsA)
+				&& m_patternP.equals(P, rowsP);
+		}
+
+	///	symbolic phase
+		template <typename TRows>
+		void init(TMatrix& M, const TMatrix& R, const TMatrix& A, const TMatrix& P,
+		          const TRows& rowsR, const TRows& rowsA, const TRows& rowsP);
+
+	///	numeric phase
+		template <typename TRows>
+		void add(TMatrix& M, const TMatrix& R, const TMatrix& A, const TMatrix& P,
+		         const TRows& rowsR, const TRows& rowsA, const TRows& rowsP);
+
+	///	both phases, the symbolic phase only if needed
+		template <typename TRows>
+		void add_product(TMatrix& M, const TMatrix& R, const TMatrix& A,
+		                 const TMatrix& P, bool bReusePattern,
+		                 const TRows& rowsR, const TRows& rowsA, const TRows& rowsP)
+		{
+			if(!bReusePattern || !matches(R, A, P, rowsR, rowsA, rowsP))
+				init(M, R, A, P, rowsR, rowsA, rowsP);
+			add(M, R, A, P, rowsR, rowsA, rowsP);
+		}
+
+	///	checks the sizes of the factors
+		void check_sizes(const TMatrix& M, const TMatrix& R,
+		                 const TMatrix& A, const TMatrix& P) const
+		{
+			if(R.num_cols() != A.num_rows() || A.num_cols() != P.num_rows())
+				UG_THROW("RAPProduct: sizes mismatch: R is "<<R.num_rows()<<"x"
+				         <<R.num_cols()<<", A is "<<A.num_rows()<<"x"<<A.num_cols()
+				         <<", P is "<<P.num_rows()<<"x"<<P.num_cols());
+			if(M.num_rows() != R.num_rows() || M.num_cols() != P.num_cols())
+				UG_THROW("RAPProduct: M is "<<M.num_rows()<<"x"<<M.num_cols()
+				         <<", but R*A*P is "<<R.num_rows()<<"x"<<P.num_cols());
+		}
+
+	///	updates the cached positions in M, inserting missing connections
+		void update_positions(TMatrix& M);
+
+	protected:
+		std::vector<int> m_vRowStart;	///< entries of row i are m_vRowStart[i] ... m_vRowStart[i+1]-1
+		std::vector<int> m_vCol;		///< column index of the entries (sorted within a row)
+		std::vector<int> m_vPos;		///< position of the entries in the value storage of M
+
+	///	sizes and column structure of the factors the pattern has been computed for
+		size_t m_numRows, m_numCols;
+		Pattern m_patternR, m_patternA, m_patternP;
+};
+
+
+template<typename TMatrix>
+template<typename TRows>
+void RAPProduct<TMatrix>::
+init(TMatrix& M, const TMatrix& R, const TMatrix& A, const TMatrix& P,
+     const TRows& rowsR, const TRows& rowsA, const TRows& rowsP)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	check_sizes(M, R, A, P);
+
+	typedef typename TRows::iterator iterator;
+	const int numRows = (int)R.num_rows();
+	const size_t numCols = P.num_cols();
+
+//	count the entries of each row. The rows are marked with their index in
+//	vMark, so that the marker does not need to be reset.
+	m_vRowStart.clear(); m_vRowStart.resize(numRows+1, 0);
+	#ifdef UG_OPENMP
+	#pragma omp parallel if(UseThreads(numRows))
+	#endif
+	{
+		std::vector<int> vMark(numCols, -1);
+
+		#ifdef UG_OPENMP
+		#pragma omp for schedule(dynamic, 64)
+		#endif
+		for(int i = 0; i < numRows; ++i)
+		{
+			int cnt = 0;
+			for(iterator ik = rowsR.begin(i), ikEnd = rowsR.end(i); ik != ikEnd; ++ik)
+			{
+				const int k = rowsR.col(ik);
+				for(iterator kl = rowsA.begin(k), klEnd = rowsA.end(k); kl != klEnd; ++kl)
+				{
+					const int l = rowsA.col(kl);
+					for(iterator lj = rowsP.begin(l), ljEnd = rowsP.end(l); lj != ljEnd; ++lj)
+					{
+						const int j = rowsP.col(lj);
+						if(vMark[j] != i) {vMark[j] = i; ++cnt;}
+					}
+				}
+			}
+			m_vRowStart[i+1] = cnt;
+		}
+	}
+	for(int i = 0; i < numRows; ++i) m_vRowStart[i+1] += m_vRowStart[i];
+
+//	fill and sort the rows
+	m_vCol.resize(m_vRowStart[numRows]);
+	#ifdef UG_OPENMP
+	#pragma omp parallel if(UseThreads(numRows))
+	#endif
+	{
+		std::vector<int> vMark(numCols, -1);
+
+		#ifdef UG_OPENMP
+		#pragma omp for schedule(dynamic, 64)
+		#endif
+		for(int i = 0; i < numRows; ++i)
+		{
+			int pos = m_vRowStart[i];
+			for(iterator ik = rowsR.begin(i), ikEnd = rowsR.end(i); ik != ikEnd; ++ik)
+			{
+				const int k = rowsR.col(ik);
+				for(iterator kl = rowsA.begin(k), klEnd = rowsA.end(k); kl != klEnd; ++kl)
+				{
+					const int l = rowsA.col(kl);
+					for(iterator lj = rowsP.begin(l), ljEnd = rowsP.end(l); lj != ljEnd; ++lj)
+					{
+						const int j = rowsP.col(lj);
+						if(vMark[j] != i) {vMark[j] = i; m_vCol[pos++] = j;}
+					}
+				}
+			}
+			std::sort(m_vCol.begin() + m_vRowStart[i], m_vCol.begin() + m_vRowStart[i+1]);
+		}
+	}
+
+//	insert the pattern into M
+	m_vPos.clear(); m_vPos.resize(m_vCol.size(), -1);
+	update_positions(M);
+
+	m_numRows = R.num_rows(); m_numCols = P.num_cols();
+	m_patternR.assign(R, rowsR);
+	m_patternA.assign(A, rowsA);
+	m_patternP.assign(P, rowsP);
+}
+
+
+template<typename TMatrix>
+void RAPProduct<TMatrix>::update_positions(TMatrix& M)
+{
+//	the positions are only valid as long as M is not restructured (insertion
+//	of connections, defragmentation), so they are checked on every use.
+//	Inserting a connection may move the other entries of its row, thus all
+//	positions are recomputed if a connection has been inserted.
+	const size_t numRows = m_vRowStart.size() - 1;
+	const size_t nnz = M.total_num_connections();
+	for(size_t i = 0; i < numRows; ++i)
+		for(int k = m_vRowStart[i]; k < m_vRowStart[i+1]; ++k)
+			if(m_vPos[k] < 0 || !M.is_position(i, m_vCol[k], m_vPos[k]))
+				m_vPos[k] = M.position(i, m_vCol[k]);
+
+	if(M.total_num_connections() != nnz)
+		for(size_t i = 0; i < numRows; ++i)
+			for(int k = m_vRowStart[i]; k < m_vRowStart[i+1]; ++k)
+				m_vPos[k] = M.position(i, m_vCol[k]);
+}
+
+
+template<typename TMatrix>
+template<typename TRows>
+void RAPProduct<TMatrix>::
+add(TMatrix& M, const TMatrix& R, const TMatrix& A, const TMatrix& P,
+    const TRows& rowsR, const TRows& rowsA, const TRows& rowsP)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	check_sizes(M, R, A, P);
+	update_positions(M);
+
+	typedef typename block_multiply_traits<value_type, value_type>::ReturnType ab_type;
+	typedef typename TRows::iterator iterator;
+
+	const int numRows = (int)m_numRows;
+
+//	M_{ij} += \sum_kl R_{ik} * A_{kl} * P_{lj}
+	#ifdef UG_OPENMP
+	#pragma omp parallel if(UseThreads(numRows))
+	#endif
+	{
+	//	vLoc[j]: position of column j in the current pattern row
+		std::vector<int> vLoc(m_numCols, -1);
+		std::vector<value_type> vAcc;
+		ab_type ab;
+
+		#ifdef UG_OPENMP
+		#pragma omp for schedule(dynamic, 64)
+		#endif
+		for(int i = 0; i < numRows; ++i)
+		{
+			const int rowStart = m_vRowStart[i];
+			const int rowSize = m_vRowStart[i+1] - rowStart;
+			if(rowSize == 0) continue;
+
+			if((int)vAcc.size() < rowSize) vAcc.resize(rowSize);
+			for(int k = 0; k < rowSize; ++k)
+			{
+				vLoc[m_vCol[rowStart + k]] = k;
+				vAcc[k] = 0.0;
+			}
+
+			for(iterator ik = rowsR.begin(i), ikEnd = rowsR.end(i); ik != ikEnd; ++ik)
+			{
+				const value_type& r = rowsR.value(ik);
+				if(r == 0.0) continue;
+				const int k = rowsR.col(ik);
+				for(iterator kl = rowsA.begin(k), klEnd = rowsA.end(k); kl != klEnd; ++kl)
+				{
+					const value_type& a = rowsA.value(kl);
+					if(a == 0.0) continue;
+					AssignMult(ab, r, a);
+
+					const int l = rowsA.col(kl);
+					for(iterator lj = rowsP.begin(l), ljEnd = rowsP.end(l); lj != ljEnd; ++lj)
+					{
+						const value_type& p = rowsP.value(lj);
+						if(p == 0.0) continue;
+						const int j = rowsP.col(lj);
+						UG_ASSERT(vLoc[j] >= 0 && m_vCol[rowStart + vLoc[j]] == j,
+						          "RAPProduct: Connection ("<<i<<","<<j<<") not in pattern.");
+						AddMult(vAcc[vLoc[j]], ab, p);
+					}
+				}
+			}
+
+			for(int k = 0; k < rowSize; ++k)
+				M.value_at(m_vPos[rowStart + k]) += vAcc[k];
+		}
+	}
+}
+
+/// @}
+
+} // end namespace ug
+
+#endif // __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__RAP_PRODUCT__
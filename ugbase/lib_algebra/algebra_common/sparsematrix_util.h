@@ -33,6 +33,7 @@
 #ifndef __H__UG__CPU_ALGEBRA__SPARSEMATRIX_UTIL__
 #define __H__UG__CPU_ALGEBRA__SPARSEMATRIX_UTIL__
 
+#include "common/types.h"
 #include "common/profiler/profiler.h"
 #include "unsorted_sparse_vector.h"
 #include "../small_algebra/small_algebra.h"
@@ -942,6 +943,32 @@ void DeserializeMatrix(TIStream& buf, TSparseMatrix &A)
 	A.defragment();
 }
 
+/**
+ * computes a fingerprint (hash) of the sparsity pattern of a matrix, i.e. of
+ * its size and the column indices of all rows. Matrices with the same pattern
+ * have the same fingerprint, values are not considered.
+ * Used to detect whether symbolic information (orderings, fill patterns) of
+ * a previous matrix can be reused.
+ */
+template<typename TSparseMatrix>
+size_t MatrixPatternFingerprint(const TSparseMatrix &A)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	typedef typename TSparseMatrix::const_row_iterator const_row_iterator;
+	uint64 h = 14695981039346656037ULL;
+	const uint64 prime = 1099511628211ULL;
+	h = (h ^ A.num_rows()) * prime;
+	h = (h ^ A.num_cols()) * prime;
+	for(size_t r=0; r < A.num_rows(); r++)
+	{
+		for(const_row_iterator it = A.begin_row(r); it != A.end_row(r); ++it)
+			h = (h ^ it.index()) * prime;
+	//	row separator
+		h = (h ^ 0xffffffffULL) * prime;
+	}
+	return (size_t) h;
+}
+
 template<typename TSparseMatrix>
 void ScaleSparseMatrixCommon(TSparseMatrix &A, double d)
 {
@@ -504,6 +504,28 @@ public:
 		return row_iterator(*this, r, j);
 	}
 
+	/**
+	 * \param r index of the row
+	 * \param c index of the column
+	 * \return the position of the connection A(r,c) in the value storage
+	 * \remark creates connection if necessary. The position is valid as long
+	 * as the sparsity pattern is not changed. \sa is_position, value_at
+	 */
+	int position(size_t r, size_t c)
+	{
+		check_rc(r, c);
+		return get_index(r, c);
+	}
+
+	//! returns true if pos is the position of the connection A(r,c) \sa position
+	bool is_position(size_t r, size_t c, int pos) const
+	{
+		return pos >= rowStart[r] && pos < rowEnd[r] && cols[pos] == (int)c;
+	}
+
+	//! returns the value at a position obtained by position() \sa position
+	value_type &value_at(int pos) { return values[pos]; }
+
 
 	void defragment()
     {
@@ -516,6 +538,21 @@ public:
 		(const_cast<this_type*>(this))->defragment();
 	}
 
+	/**
+	 * defragments the matrix and marks its sparsity pattern as final. The rows
+	 * are then stored contiguously in plain CRS format without any slack
+	 * (rowStart[i+1] == rowEnd[i]), and matrix-vector products use a CRS kernel
+	 * (for scalar matrices one with a local row accumulator, which the compiler
+	 * can vectorize). Values can still be changed, but as soon as the pattern is
+	 * modified (new connections, resize, ...) the frozen state is left again.
+	 * Useful for the system matrix of an iterative solver, whose pattern is
+	 * fixed during the iterations.
+	 */
+	void freeze();
+
+	//! returns true if the matrix is in the frozen CRS state \sa freeze
+	bool is_frozen() const { return m_bFrozen; }
+
 	/**
 	 * copies the matrix to the standard CRS format
 	 * @param numRows   	(out) num rows of A
@@ -628,6 +665,7 @@ protected:
     }
     void copyToNewSize(size_t newSize, size_t maxCols);
 	void check_fragmentation() const;
+	bool rows_stored_contiguously() const;
 	int get_nnz_max_cols(size_t maxCols);
 
 
@@ -644,6 +682,7 @@ protected:
     int maxValues;
     int m_numCols;
     mutable int iIterators;
+    bool m_bFrozen; ///< true if pattern is final and stored without fragmentation \sa freeze
 
 #ifdef CHECK_ROW_ITERATORS
 public:
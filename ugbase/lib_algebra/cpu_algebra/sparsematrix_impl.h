@@ -40,6 +40,7 @@
 
 #include "lib_algebra/common/operations_vec.h"
 #include "common/profiler/profiler.h"
+#include "common/util/thread_util.h"
 #include "sparsematrix.h"
 #include <vector>
 #include <algorithm>
@@ -57,6 +58,8 @@ SparseMatrix<T>::SparseMatrix()
 	nnz = 0;
 	m_numCols = 0;
 	maxValues = 0;
+	fragmented = 0;
+	m_bFrozen = false;
 	cols.resize(32);
 	if(bNeedsValues) values.resize(32);
 }
@@ -64,6 +67,7 @@ SparseMatrix<T>::SparseMatrix()
 template<typename T>
 void SparseMatrix<T>::clear_and_free()
 {
+	m_bFrozen = false;
 	std::vector<int>().swap(rowStart);
 	std::vector<int>().swap(rowMax);
 	std::vector<int>().swap(rowEnd);
@@ -84,6 +88,7 @@ template<typename T>
 void SparseMatrix<T>::resize_and_clear(size_t newRows, size_t newCols)
 {
 	PROFILE_SPMATRIX(SparseMatrix_resize_and_clear);
+	m_bFrozen = false;
 	rowStart.clear(); rowStart.resize(newRows+1, -1);
 	rowMax.clear(); rowMax.resize(newRows);
 	rowEnd.clear(); rowEnd.resize(newRows, -1);
@@ -108,6 +113,7 @@ void SparseMatrix<T>::resize_and_keep_values(size_t newRows, size_t newCols)
 	//UG_LOG("SparseMatrix resize " << newRows << "x" << newCols << "\n");
 	if(newRows == 0 && newCols == 0)
 		return resize_and_clear(0,0);
+	m_bFrozen = false;
 
 	if(newRows != num_rows())
 	{
@@ -189,11 +195,52 @@ inline void SparseMatrix<T>::mat_mult_add_row(size_t row, typename vector_t::val
 }
 
 
+// CRS kernel of apply_ignore_zero_rows for frozen matrices (cf. FrozenCRSAxpy).
+// The generic version returns false, the standard row loop is used then.
+template<typename vector_t, typename value_type>
+inline bool FrozenCRSApplyIgnoreZeroRows(vector_t &dest,
+		const number &beta1, const vector_t &w1,
+		size_t numRows, const int *pRowStart, const int *pCols,
+		const value_type *pValues)
+{
+	return false;
+}
+
+// scalar version: gathers each row into a local accumulator
+template<typename vector_t>
+inline bool FrozenCRSApplyIgnoreZeroRows(vector_t &dest,
+		const number &beta1, const vector_t &w1,
+		size_t numRows, const int *pRowStart, const int *pCols,
+		const double *pValues)
+{
+	#ifdef UG_OPENMP
+	#pragma omp parallel for schedule(static) if(UseThreads(numRows))
+	#endif
+	for(size_t i=0; i < numRows; i++)
+	{
+		const int itEnd = pRowStart[i+1];
+		if(pRowStart[i] == itEnd) continue;
+
+		double s = 0.0;
+		for(int k=pRowStart[i]; k < itEnd; ++k)
+			s += pValues[k] * w1[pCols[k]];
+		dest[i] = beta1*s;
+	}
+	return true;
+}
+
 template<typename T>
 template<typename vector_t>
 void SparseMatrix<T>::apply_ignore_zero_rows(vector_t &dest,
 		const number &beta1, const vector_t &w1) const
 {
+	if(m_bFrozen && FrozenCRSApplyIgnoreZeroRows(dest, beta1, w1, num_rows(),
+								&rowStart[0], &cols[0], &values[0]))
+		return;
+
+	#ifdef UG_OPENMP
+	#pragma omp parallel for schedule(static) if(UseThreads(num_rows()))
+	#endif
 	for(size_t i=0; i < num_rows(); i++)
 	{
 		size_t rowIt=rowStart[i];
@@ -209,7 +256,49 @@ void SparseMatrix<T>::apply_ignore_zero_rows(vector_t &dest,
 }
 
 
+// CRS kernel for frozen matrices. There is no special kernel for block
+// matrices, so the generic version returns false and SparseMatrix::axpy
+// uses the standard row loop.
+template<typename vector_t, typename value_type>
+inline bool FrozenCRSAxpy(vector_t &dest,
+		const number &alpha1, const vector_t &v1,
+		const number &beta1, const vector_t &w1,
+		size_t numRows, const int *pRowStart, const int *pCols,
+		const value_type *pValues)
+{
+	return false;
+}
+
+// scalar version: rows are accumulated in a local variable, so that the
+// inner loop is a plain gather-multiply-add the compiler can vectorize.
+template<typename vector_t>
+inline bool FrozenCRSAxpy(vector_t &dest,
+		const number &alpha1, const vector_t &v1,
+		const number &beta1, const vector_t &w1,
+		size_t numRows, const int *pRowStart, const int *pCols,
+		const double *pValues)
+{
+	#ifdef UG_OPENMP
+	#pragma omp parallel for schedule(static) if(UseThreads(numRows))
+	#endif
+	for(size_t i=0; i < numRows; i++)
+	{
+		const int itEnd = pRowStart[i+1];
+		double s = 0.0;
+		for(int k=pRowStart[i]; k < itEnd; ++k)
+			s += pValues[k] * w1[pCols[k]];
+
+		if(alpha1 == 0.0)
+			dest[i] = beta1*s;
+		else
+			dest[i] = alpha1*v1[i] + beta1*s;
+	}
+	return true;
+}
+
 // calculate dest = alpha1*v1 + beta1*A*w1 (A = this matrix)
+// the rows are independent of each other, so with OpenMP they are distributed
+// among the threads in contiguous blocks
 template<typename T>
 template<typename vector_t>
 void SparseMatrix<T>::axpy(vector_t &dest,
@@ -217,9 +306,16 @@ void SparseMatrix<T>::axpy(vector_t &dest,
 		const number &beta1, const vector_t &w1) const
 {
 	PROFILE_SPMATRIX(SparseMatrix_axpy);
+	if(m_bFrozen && FrozenCRSAxpy(dest, alpha1, v1, beta1, w1, num_rows(),
+								&rowStart[0], &cols[0], &values[0]))
+		return;
+
 	check_fragmentation();
 	if(alpha1 == 0.0)
 	{
+		#ifdef UG_OPENMP
+		#pragma omp parallel for schedule(static) if(UseThreads(num_rows()))
+		#endif
 		for(size_t i=0; i < num_rows(); i++)
 		{
 			size_t rowIt=rowStart[i];
@@ -238,6 +334,9 @@ void SparseMatrix<T>::axpy(vector_t &dest,
 	else if(&dest == &v1)
 	{
 		if(alpha1 != 1.0) {
+			#ifdef UG_OPENMP
+			#pragma omp parallel for schedule(static) if(UseThreads(num_rows()))
+			#endif
 			for(size_t i=0; i < num_rows(); i++)
 			{
 				dest[i] *= alpha1;
@@ -245,12 +344,19 @@ void SparseMatrix<T>::axpy(vector_t &dest,
 			}
 		}
 		else
+		{
+			#ifdef UG_OPENMP
+			#pragma omp parallel for schedule(static) if(UseThreads(num_rows()))
+			#endif
 			for(size_t i=0; i < num_rows(); i++)
 				mat_mult_add_row(i, dest[i], beta1, w1);
-
+		}
 	}
 	else
 	{
+		#ifdef UG_OPENMP
+		#pragma omp parallel for schedule(static) if(UseThreads(num_rows()))
+		#endif
 		for(size_t i=0; i < num_rows(); i++)
 		{
 			VecScaleAssign(dest[i], alpha1, v1[i]);
@@ -260,6 +366,8 @@ void SparseMatrix<T>::axpy(vector_t &dest,
 }
 
 // calculate dest = alpha1*v1 + beta1*A^T*w1 (A = this matrix)
+// note: the transposed product scatters into dest and is therefore executed
+// sequentially even if OpenMP is enabled
 template<typename T>
 template<typename vector_t>
 void SparseMatrix<T>::axpy_transposed(vector_t &dest,
@@ -521,6 +629,7 @@ int SparseMatrix<T>::get_index(int r, int c)
 	if(rowStart[r] == -1 || rowStart[r] == rowEnd[r])
 	{
 //		UG_LOG("new row\n");
+		m_bFrozen = false;
 		// row did not start, start new row at the end of cols array
 		assureValuesSize(maxValues+1);
 		rowStart[r] = maxValues;
@@ -550,6 +659,7 @@ int SparseMatrix<T>::get_index(int r, int c)
 	// we did not find it, so we have to add it
 
 	check_row_modifiable(r);
+	m_bFrozen = false;
 
 #ifndef NDEBUG
 	assert(index == rowEnd[r] || cols[index] > c);
@@ -643,6 +753,7 @@ void SparseMatrix<T>::copyToNewSize(size_t newSize, size_t maxCol)
 	std::vector<value_type> v(newSize);
 	std::vector<int> c(newSize);
 	size_t j=0;
+	bool bDropped = false;
 	for(size_t r=0; r<num_rows(); r++)
 	{
 		if(rowStart[r] == -1)
@@ -658,11 +769,15 @@ void SparseMatrix<T>::copyToNewSize(size_t newSize, size_t maxCol)
 					c[j] = cols[k];
 					j++;
 				}
+				else bDropped = true;
 			}
 			rowStart[r] = start;
 			rowEnd[r] = rowMax[r] = j;
 		}
 	}
+//	the rows are now stored contiguously, the frozen state is only left if
+//	the pattern has changed by dropping columns
+	if(bDropped) m_bFrozen = false;
 	rowStart[num_rows()] = rowEnd[num_rows()-1];
 	fragmented = 0;
 	maxValues = j;
@@ -673,10 +788,32 @@ void SparseMatrix<T>::copyToNewSize(size_t newSize, size_t maxCol)
 template<typename T>
 void SparseMatrix<T>::check_fragmentation() const
 {
+	if(m_bFrozen) return;
 	if((double)nnz/(double)maxValues < 0.9)
 		defragment();
 }
 
+template<typename T>
+bool SparseMatrix<T>::rows_stored_contiguously() const
+{
+	if(num_rows() == 0 || num_cols() == 0 || nnz == 0) return false;
+	int j=0;
+	for(size_t r=0; r<num_rows(); r++)
+	{
+		if(rowStart[r] != j || rowEnd[r] < rowStart[r]) return false;
+		j = rowEnd[r];
+	}
+	return rowStart[num_rows()] == j;
+}
+
+template<typename T>
+void SparseMatrix<T>::freeze()
+{
+	PROFILE_SPMATRIX(SparseMatrix_freeze);
+	defragment();
+	m_bFrozen = rows_stored_contiguously();
+}
+
 template<typename T>
 void SparseMatrix<T>::assureValuesSize(size_t s)
 {
@@ -38,6 +38,7 @@
 #include <algorithm>
 #include "algebra_misc.h"
 #include "common/math/ugmath.h"
+#include "common/util/thread_util.h"
 #include "vector.h" // for urand
 
 #define prefetchReadWrite(a)
@@ -67,15 +68,71 @@ inline const value_type &Vector<value_type>::operator [] (size_t i) const
 	return sum;
 }*/
 
+#ifdef UG_OPENMP
+//	Reductions are computed chunk-wise: each chunk is summed up sequentially,
+//	then the partial sums are added in chunk order. Since the chunks do not
+//	depend on the number of threads, the result is the same for any number of
+//	threads (and equal to the sequential result for size <= chunk size).
+#define UG_VECTOR_REDUCTION_CHUNK 2048
+
+template<typename vector_t>
+double VecProdChunked(const vector_t &a, const vector_t &b)
+{
+	const size_t size = a.size();
+	const size_t numChunks = (size + UG_VECTOR_REDUCTION_CHUNK - 1) / UG_VECTOR_REDUCTION_CHUNK;
+	std::vector<double> vPartialSum(numChunks, 0.0);
+
+	#pragma omp parallel for schedule(static) if(UseThreads(size))
+	for(size_t c=0; c<numChunks; c++)
+	{
+		const size_t iEnd = std::min(size, (c+1)*UG_VECTOR_REDUCTION_CHUNK);
+		double sum=0;
+		for(size_t i=c*UG_VECTOR_REDUCTION_CHUNK; i<iEnd; i++)
+			VecProdAdd(a[i], b[i], sum);
+		vPartialSum[c] = sum;
+	}
+
+	double sum=0;
+	for(size_t c=0; c<numChunks; c++) sum += vPartialSum[c];
+	return sum;
+}
+
+template<typename vector_t>
+double BlockNorm2Chunked(const vector_t &a)
+{
+	const size_t size = a.size();
+	const size_t numChunks = (size + UG_VECTOR_REDUCTION_CHUNK - 1) / UG_VECTOR_REDUCTION_CHUNK;
+	std::vector<double> vPartialSum(numChunks, 0.0);
+
+	#pragma omp parallel for schedule(static) if(UseThreads(size))
+	for(size_t c=0; c<numChunks; c++)
+	{
+		const size_t iEnd = std::min(size, (c+1)*UG_VECTOR_REDUCTION_CHUNK);
+		double sum=0;
+		for(size_t i=c*UG_VECTOR_REDUCTION_CHUNK; i<iEnd; i++)
+			sum += BlockNorm2(a[i]);
+		vPartialSum[c] = sum;
+	}
+
+	double sum=0;
+	for(size_t c=0; c<numChunks; c++) sum += vPartialSum[c];
+	return sum;
+}
+#endif
+
 // dotprod
 template<typename value_type>
 inline double Vector<value_type>::dotprod(const Vector &w) //const
 {
 	UG_ASSERT(m_size == w.m_size,  *this << " has not same size as " << w);
 
+#ifdef UG_OPENMP
+	return VecProdChunked(*this, w);
+#else
 	double sum=0;
 	for(size_t i=0; i<m_size; i++)	sum += VecProd(values[i], w[i]);
 	return sum;
+#endif
 }
 
 // assign double to whole Vector
@@ -322,10 +379,14 @@ double operator *(const TRANSPOSED<Vector<value_type> > &x, const Vector<value_t
 template<typename value_type>
 inline double Vector<value_type>::norm() const
 {
+#ifdef UG_OPENMP
+	return sqrt(BlockNorm2Chunked(*this));
+#else
 	double d=0;
 	for(size_t i=0; i<size(); ++i)
 		d+=BlockNorm2(values[i]);
 	return sqrt(d);
+#endif
 }
 
 template<typename value_type>
@@ -337,6 +398,72 @@ inline double Vector<value_type>::maxnorm() const
 	return d;
 }
 
+#ifdef UG_OPENMP
+//	Overloads of the vector operations in operations_vec.h that execute the
+//	loop over the entries multithreaded. The element-wise operations are
+//	applied to disjoint ranges, reductions are computed chunk-wise (see above).
+
+//! calculates dest = alpha1*v1
+template<typename TValueType>
+inline void VecScaleAssign(Vector<TValueType> &dest, double alpha1, const Vector<TValueType> &v1)
+{
+	#pragma omp parallel for schedule(static) if(UseThreads(dest.size()))
+	for(size_t i=0; i<dest.size(); i++)
+		VecScaleAssign(dest[i], alpha1, v1[i]);
+}
+
+//! sets dest = v1 entrywise
+template<typename TValueType>
+inline void VecAssign(Vector<TValueType> &dest, const Vector<TValueType> &v1)
+{
+	#pragma omp parallel for schedule(static) if(UseThreads(dest.size()))
+	for(size_t i=0; i<dest.size(); i++)
+		dest[i] = v1[i];
+}
+
+//! calculates dest = alpha1*v1 + alpha2*v2
+template<typename TValueType>
+inline void VecScaleAdd(Vector<TValueType> &dest, double alpha1, const Vector<TValueType> &v1,
+                        double alpha2, const Vector<TValueType> &v2)
+{
+	#pragma omp parallel for schedule(static) if(UseThreads(dest.size()))
+	for(size_t i=0; i<dest.size(); i++)
+		VecScaleAdd(dest[i], alpha1, v1[i], alpha2, v2[i]);
+}
+
+//! calculates dest = alpha1*v1 + alpha2*v2 + alpha3*v3
+template<typename TValueType>
+inline void VecScaleAdd(Vector<TValueType> &dest, double alpha1, const Vector<TValueType> &v1,
+                        double alpha2, const Vector<TValueType> &v2,
+                        double alpha3, const Vector<TValueType> &v3)
+{
+	#pragma omp parallel for schedule(static) if(UseThreads(dest.size()))
+	for(size_t i=0; i<dest.size(); i++)
+		VecScaleAdd(dest[i], alpha1, v1[i], alpha2, v2[i], alpha3, v3[i]);
+}
+
+//! calculates s += scal<a, b>
+template<typename TValueType>
+inline void VecProd(const Vector<TValueType> &a, const Vector<TValueType> &b, double &sum)
+{
+	sum += VecProdChunked(a, b);
+}
+
+//! returns scal<a, b>
+template<typename TValueType>
+inline double VecProd(const Vector<TValueType> &a, const Vector<TValueType> &b)
+{
+	return VecProdChunked(a, b);
+}
+
+//! returns norm_2^2(a)
+template<typename TValueType>
+inline double VecNormSquared(const Vector<TValueType> &a)
+{
+	return VecProdChunked(a, a);
+}
+#endif
+
 template<typename TValueType>
 void CloneVector(Vector<TValueType> &dest, const Vector<TValueType>& src)
 {
@@ -527,6 +527,12 @@ public:
 			copyToNewSize(nnz);
     }
 
+	//! the device matrix always is in CRS format, so freezing only defragments
+	void freeze()
+	{
+		defragment();
+	}
+
 public:
 	// output functions
 	//----------------------
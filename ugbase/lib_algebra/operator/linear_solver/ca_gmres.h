@@ -0,0 +1,520 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__CA_GMRES__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__CA_GMRES__
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <cmath>
+#include <limits>
+
+#include "lib_algebra/operator/interface/operator.h"
+#include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
+#include "common/profiler/profiler.h"
+#include "fused_reduction.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	the communication-avoiding (s-step) GMRES method
+/**
+ * This class implements a (left preconditioned) s-step GMRES method. Instead
+ * of orthogonalizing each new Krylov vector against all previous ones (one
+ * reduction per dot product as in GMRES), s vectors of a scaled monomial
+ * basis \f$ w_i = (M^{-1}A)^i q_k / \sigma^i \f$ are computed without any
+ * reduction and are orthogonalized as a block: block classical Gram-Schmidt
+ * against the previous basis followed by a Cholesky QR of the block. All dot
+ * products of a pass (\f$ Q^T W \f$ and \f$ W^T W \f$) are computed as one
+ * blocked product of the local parts and summed in a single reduction. With
+ * reorthogonalization (default), two passes are done, i.e. two reductions for
+ * s basis vectors. The Hessenberg matrix is recovered from the change of
+ * basis.
+ *
+ * Since the monomial basis becomes ill-conditioned for large s, s should be
+ * moderate (e.g. 4 - 8). If the Cholesky factorization of a block breaks
+ * down, the block is truncated.
+ *
+ * For detailed description of the algorithm, please refer to:
+ *
+ * - Hoemmen, "Communication-avoiding Krylov subspace methods", PhD thesis,
+ *   UC Berkeley (2010), Sec. 3.2 (CA-GMRES)
+ *
+ * \tparam 	TVector		vector type
+ */
+template <typename TVector>
+class CAGMRES
+	: public IPreconditionedLinearOperatorInverse<TVector>
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	///	Base type
+		typedef IPreconditionedLinearOperatorInverse<vector_type> base_type;
+
+	protected:
+		using base_type::convergence_check;
+		using base_type::linear_operator;
+		using base_type::preconditioner;
+		using base_type::write_debug;
+
+	///	small dense matrix
+		typedef std::vector<std::vector<number> > dense_type;
+
+	public:
+	///	constructor setting restart and block size
+		CAGMRES(size_t restart, size_t s)
+			: m_restart(restart), m_s(s), m_bReorthogonalize(true)
+		{
+			UG_COND_THROW(restart == 0 || s == 0, "CAGMRES: restart and s must be positive.");
+		}
+
+	///	constructor setting the preconditioner and the convergence check
+		CAGMRES(size_t restart, size_t s,
+		        SmartPtr<ILinearIterator<vector_type> > spPrecond,
+		        SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
+			: base_type(spPrecond, spConvCheck),
+			  m_restart(restart), m_s(s), m_bReorthogonalize(true)
+		{
+			UG_COND_THROW(restart == 0 || s == 0, "CAGMRES: restart and s must be positive.");
+		}
+
+	///	name of solver
+		virtual const char* name() const {return "CAGMRES";}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const
+		{
+			if(preconditioner().valid())
+				return preconditioner()->supports_parallel();
+			return true;
+		}
+
+	///	enables the second block Gram-Schmidt pass (one more reduction per block)
+		void set_reorthogonalization(bool bReorth) {m_bReorthogonalize = bReorth;}
+
+	// 	Solve J(u)*x = b, such that x = J(u)^{-1} b
+		virtual bool apply_return_defect(vector_type& x, vector_type& b)
+		{
+			PROFILE_BEGIN_GROUP(CAGMRES_apply_return_defect, "algebra");
+		//	check correct storage type in parallel
+			#ifdef UG_PARALLEL
+			if(!b.has_storage_type(PST_ADDITIVE) || !x.has_storage_type(PST_CONSISTENT))
+				UG_THROW("CAGMRES: Inadequate storage format of Vectors.");
+			#endif
+
+			const size_t m = m_restart;
+
+		//	copy rhs
+			SmartPtr<vector_type> spR = b.clone();
+
+		// 	build defect:  r := b - A*x
+			linear_operator()->apply_sub(*spR, x);
+
+		//	prepare convergence check
+			prepare_conv_check();
+
+		//	compute start defect norm
+			convergence_check()->start(*spR);
+
+		//	basis q, hessenberg matrix (H unrotated, Hr rotated), givens rotations
+			std::vector<SmartPtr<vector_type> > q(m+1);
+			dense_type H(m+1, std::vector<number>(m, 0.0));
+			dense_type Hr(m+1, std::vector<number>(m, 0.0));
+			std::vector<number> gamma(m+1), c(m), s(m);
+
+		//	scaling of the monomial basis (estimate of ||M^-1 A||)
+			number sigma = 0.0;
+
+		// 	Iteration loop
+			while(!convergence_check()->iteration_ended())
+			{
+				if(q[0].invalid()) q[0] = x.clone_without_values();
+
+			// 	apply q[0] = M^-1 * (b-A*x)
+				if(!apply_precond(*q[0], *spR)) return false;
+
+			// 	compute norm of inital residuum and normalize q[0]
+				number oldNorm = gamma[0] = q[0]->norm();
+				if(gamma[0] == 0.0) break;
+				*q[0] *= 1./gamma[0];
+
+				for(size_t i = 0; i <= m; ++i)
+					for(size_t j = 0; j < m; ++j)
+						H[i][j] = Hr[i][j] = 0.0;
+
+			//	build the basis block by block
+				size_t k = 0;
+				bool bEnded = false;
+				while(k < m && !bEnded)
+				{
+				//	block size, the very first block is a single vector to
+				//	get an estimate of the scaling
+					size_t sk = std::min(m_s, m - k);
+					if(sigma == 0.0) sk = 1;
+
+				//	matrix powers: q[k+1+i] = (M^-1 A)^(i+1) q[k] / sigma^(i+1)
+					const number scale = (sigma == 0.0) ? 1.0 : 1.0/sigma;
+					for(size_t i = 0; i < sk; ++i)
+					{
+						if(q[k+1+i].invalid()) q[k+1+i] = x.clone_without_values();
+						if(!apply_operator(*q[k+1+i], *q[k+i], *spR)) return false;
+						*q[k+1+i] *= scale;
+					}
+
+				//	block orthogonalization: W = Q C + Q_new R
+					dense_type C, R;
+					sk = orthogonalize_block(q, k, sk, C, R);
+					if(sk == 0)
+					{
+						UG_LOG("CAGMRES: Block orthogonalization broke down at basis "
+								"size " << k+1 << ". Restarting.\n");
+						break;
+					}
+
+				//	compute the new columns of the hessenberg matrix
+					compute_hessenberg(H, C, R, k, sk, (sigma == 0.0) ? 1.0 : sigma);
+
+				//	apply givens rotations and update the defect
+					const size_t kBlockEnd = k + sk;
+					for(size_t j = k; j < kBlockEnd && !bEnded; ++j)
+					{
+						for(size_t i = 0; i <= j+1; ++i) Hr[i][j] = H[i][j];
+
+						for(size_t i = 0; i < j; ++i)
+						{
+							const number hij = Hr[i][j];
+							const number hi1j = Hr[i+1][j];
+							Hr[i][j]   =  c[i]*hij + s[i]*hi1j;
+							Hr[i+1][j] =  s[i]*hij - c[i]*hi1j;
+						}
+
+						const number alpha = sqrt(Hr[j][j]*Hr[j][j] + Hr[j+1][j]*Hr[j+1][j]);
+						if(alpha == 0.0) {bEnded = true; break;}
+						s[j] = Hr[j+1][j] / alpha;
+						c[j] = Hr[j][j]   / alpha;
+						Hr[j][j] = alpha;
+						Hr[j+1][j] = 0.0;
+
+						gamma[j+1] = s[j]*gamma[j];
+						gamma[j] = c[j]*gamma[j];
+						k = j+1;
+
+						if(preconditioner().valid()) {
+							UG_LOG(std::string(convergence_check()->get_offset(),' '));
+							UG_LOG("% CAGMRES "<<std::setw(4) <<j+1<<": "
+								   << std::fabs(gamma[j+1]) << "    " << std::fabs(gamma[j+1]) / oldNorm);
+							UG_LOG(" (in Precond-Norm) \n");
+							oldNorm = std::fabs(gamma[j+1]);
+						}
+						else{
+							convergence_check()->update_defect(std::fabs(gamma[j+1]));
+							if(convergence_check()->iteration_ended()) bEnded = true;
+						}
+					}
+
+				//	scaling for the next block: ||(M^-1 A) q_{k-1}|| = ||H(:,k-1)||
+					if(k > 0)
+					{
+						number norm2 = 0.0;
+						for(size_t i = 0; i <= k; ++i) norm2 += H[i][k-1]*H[i][k-1];
+						if(norm2 > 0.0) sigma = sqrt(norm2);
+					}
+				}
+
+			//	compute current x
+				for(size_t i = k; i-- > 0; ){
+					for(size_t j = i+1; j < k; ++j)
+						gamma[i] -= Hr[i][j] * gamma[j];
+					gamma[i] /= Hr[i][i];
+				}
+				for(size_t i = 0; i < k; ++i)
+					VecScaleAppend(x, *q[i], gamma[i]);
+
+			//	compute fresh defect: r := b - A*x
+				*spR = b;
+				linear_operator()->apply_sub(*spR, x);
+
+				if(preconditioner().valid())
+					convergence_check()->update(*spR);
+				else if(k == 0)
+					convergence_check()->update(*spR);
+			}
+
+		//	print ending output
+			return convergence_check()->post();
+		}
+
+	public:
+		virtual std::string config_string() const
+		{
+			std::stringstream ss;
+			ss << "CAGMRes ( restart = " << m_restart << ", s = " << m_s
+			   << ", reorthogonalization = " << (m_bReorthogonalize ? "true" : "false") << ")\n";
+			ss << base_type::config_string_preconditioner_convergence_check();
+			return ss.str();
+		}
+
+	protected:
+	///	c := M^-1 d (or c := d), c is unique afterwards
+		bool apply_precond(vector_type& c, vector_type& d)
+		{
+			if(preconditioner().valid()){
+				if(!preconditioner()->apply(c, d)){
+					UG_LOG("CAGMRES: Cannot apply preconditioner.\n");
+					return false;
+				}
+			}
+			else c = d;
+
+			#ifdef UG_PARALLEL
+			if(!c.change_storage_type(PST_UNIQUE))
+				UG_THROW("CAGMRES: Cannot convert vector to unique vector.");
+			#endif
+			return true;
+		}
+
+	///	c := M^-1 A v, using tmp as help vector, c and v are unique afterwards
+		bool apply_operator(vector_type& c, vector_type& v, vector_type& tmp)
+		{
+			#ifdef UG_PARALLEL
+			if(!v.change_storage_type(PST_CONSISTENT))
+				UG_THROW("CAGMRES: Cannot convert vector to consistent vector.");
+			#endif
+
+			linear_operator()->apply(tmp, v);
+			if(!apply_precond(c, tmp)) return false;
+
+			#ifdef UG_PARALLEL
+			if(!v.change_storage_type(PST_UNIQUE))
+				UG_THROW("CAGMRES: Cannot convert vector to unique vector.");
+			#endif
+			return true;
+		}
+
+	///	one pass of block classical Gram-Schmidt and Cholesky QR
+	/**
+	 * Orthogonalizes W = q[k+1 .. k+sk] against Q = q[0 .. k] and within the
+	 * block using a single reduction: W := (W - Q C) R^{-1} with C = Q^T W
+	 * and R^T R = W^T W - C^T C.
+	 * \return number of columns that could be orthogonalized
+	 */
+		size_t block_gram_schmidt(std::vector<SmartPtr<vector_type> >& q,
+		                          size_t k, size_t sk, dense_type& C, dense_type& R)
+		{
+			PROFILE_BEGIN_GROUP(CAGMRES_block_gram_schmidt, "algebra");
+			std::vector<vector_type*> vQ(k+1), vW(sk);
+			for(size_t i = 0; i <= k; ++i) vQ[i] = q[i].get();
+			for(size_t j = 0; j < sk; ++j) vW[j] = q[k+1+j].get();
+
+		//	all dot products in one reduction
+			FusedVecProds<vector_type> dots;
+			const size_t iC = dots.add_block(vQ, vW);
+			const size_t iG = dots.add_block(vW, vW);
+			dots.reduce();
+
+			C.assign(k+1, std::vector<number>(sk, 0.0));
+			for(size_t i = 0; i <= k; ++i)
+				for(size_t j = 0; j < sk; ++j)
+					C[i][j] = dots[iC + i*sk + j];
+
+		//	cholesky factorization of W^T W - C^T C (pythagorean)
+			R.assign(sk, std::vector<number>(sk, 0.0));
+			size_t rank = sk;
+			for(size_t j = 0; j < sk && rank == sk; ++j)
+			{
+				for(size_t i = 0; i <= j; ++i)
+				{
+					number g = dots[iG + i*sk + j];
+					for(size_t l = 0; l <= k; ++l) g -= C[l][i]*C[l][j];
+					for(size_t l = 0; l < i; ++l) g -= R[l][i]*R[l][j];
+					if(i < j) R[i][j] = g / R[i][i];
+					else
+					{
+						const number gjj = dots[iG + j*sk + j];
+						if(!(g > 100 * std::numeric_limits<number>::epsilon() * gjj)
+							|| gjj <= 0.0)
+							{rank = j; break;}
+						R[j][j] = sqrt(g);
+					}
+				}
+			}
+
+		//	W := (W - Q C) R^-1
+			for(size_t j = 0; j < rank; ++j)
+			{
+				vector_type& w = *vW[j];
+				for(size_t i = 0; i <= k; ++i)
+					VecScaleAppend(w, *vQ[i], -C[i][j]);
+				for(size_t i = 0; i < j; ++i)
+					VecScaleAppend(w, *vW[i], -R[i][j]);
+				w *= 1./R[j][j];
+			}
+			return rank;
+		}
+
+	///	orthogonalizes the block, W = Q C + Q_new R, returns new block size
+		size_t orthogonalize_block(std::vector<SmartPtr<vector_type> >& q,
+		                           size_t k, size_t sk, dense_type& C, dense_type& R)
+		{
+			sk = block_gram_schmidt(q, k, sk, C, R);
+			if(!m_bReorthogonalize || sk == 0) return sk;
+
+		//	second pass: W_1 = Q C2 + Q_new R2, thus W = Q (C + C2 R) + Q_new R2 R
+			dense_type C2, R2;
+			const size_t sk2 = block_gram_schmidt(q, k, sk, C2, R2);
+			if(sk2 < sk) sk = sk2;
+
+			dense_type Cn(k+1, std::vector<number>(sk, 0.0));
+			dense_type Rn(sk, std::vector<number>(sk, 0.0));
+			for(size_t j = 0; j < sk; ++j)
+			{
+				for(size_t i = 0; i <= k; ++i)
+				{
+					number v = C[i][j];
+					for(size_t l = 0; l <= j; ++l) v += C2[i][l]*R[l][j];
+					Cn[i][j] = v;
+				}
+				for(size_t i = 0; i <= j; ++i)
+				{
+					number v = 0.0;
+					for(size_t l = i; l <= j; ++l) v += R2[i][l]*R[l][j];
+					Rn[i][j] = v;
+				}
+			}
+			C.swap(Cn); R.swap(Rn);
+			return sk;
+		}
+
+	///	computes the columns k .. k+sk-1 of the hessenberg matrix
+	/**
+	 * With Y = [q_k, w_1 .. w_{sk-1}] and W = [w_1 .. w_sk] it holds
+	 * (M^-1 A) Y = sigma W. Writing Y = Q_{0..k-1} C' + Q_{k..k+sk-1} T
+	 * (T upper triangular) and W = Q_{0..k+sk} [C; R] gives
+	 * H_{new} = (sigma [C; R] - H_{old} C') T^{-1}.
+	 */
+		void compute_hessenberg(dense_type& H, const dense_type& C, const dense_type& R,
+		                        size_t k, size_t sk, number sigma)
+		{
+			const size_t nRow = k + sk + 1;
+
+		//	T (sk x sk) and C' (k x sk)
+			dense_type T(sk, std::vector<number>(sk, 0.0));
+			T[0][0] = 1.0;
+			for(size_t col = 1; col < sk; ++col)
+			{
+				T[0][col] = C[k][col-1];
+				for(size_t a = 1; a <= col; ++a) T[a][col] = R[a-1][col-1];
+			}
+
+		//	X = sigma [C; R] - H_old C'
+			dense_type X(nRow, std::vector<number>(sk, 0.0));
+			for(size_t col = 0; col < sk; ++col)
+			{
+				for(size_t i = 0; i <= k; ++i) X[i][col] = sigma * C[i][col];
+				for(size_t a = 0; a <= col; ++a) X[k+1+a][col] = sigma * R[a][col];
+
+				if(col == 0) continue;
+				for(size_t l = 0; l < k; ++l)
+				{
+					const number cl = C[l][col-1];
+					if(cl == 0.0) continue;
+					for(size_t i = 0; i <= l+1; ++i) X[i][col] -= H[i][l] * cl;
+				}
+			}
+
+		//	H_new = X T^-1
+			for(size_t col = 0; col < sk; ++col)
+			{
+				for(size_t i = 0; i < nRow; ++i)
+				{
+					number v = X[i][col];
+					for(size_t a = 0; a < col; ++a) v -= H[i][k+a] * T[a][col];
+					H[i][k+col] = v / T[col][col];
+				}
+			}
+		}
+
+	///	prepares the output of the convergence check
+		void prepare_conv_check()
+		{
+		//	set iteration symbol and name
+			convergence_check()->set_name(name());
+			convergence_check()->set_symbol('%');
+
+		//	set preconditioner string
+			std::string s;
+			if(preconditioner().valid())
+			  s = std::string(" (Precond: ") + preconditioner()->name() + ")";
+			else
+				s = " (No Preconditioner) ";
+			convergence_check()->set_info(s);
+		}
+
+	///	adds a scaled vector to a second one
+		void VecScaleAppend(vector_type& a, vector_type& b, number s)
+		{
+			#ifdef UG_PARALLEL
+			if(a.has_storage_type(PST_UNIQUE) && b.has_storage_type(PST_UNIQUE));
+			else if(a.has_storage_type(PST_CONSISTENT) && b.has_storage_type(PST_CONSISTENT));
+			else if (a.has_storage_type(PST_ADDITIVE) && b.has_storage_type(PST_ADDITIVE));
+			else
+			{
+				a.change_storage_type(PST_ADDITIVE);
+				b.change_storage_type(PST_ADDITIVE);
+			}
+			#endif
+
+			for(size_t i = 0; i < a.size(); ++i)
+				VecScaleAdd(a[i], 1.0, a[i], s, b[i]);
+		}
+
+	protected:
+	///	restart parameter
+		size_t m_restart;
+
+	///	number of basis vectors computed per block
+		size_t m_s;
+
+	///	second block Gram-Schmidt pass
+		bool m_bReorthogonalize;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__CA_GMRES__ */
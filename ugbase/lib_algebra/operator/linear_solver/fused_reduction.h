@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__FUSED_REDUCTION__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__FUSED_REDUCTION__
+
+#include <vector>
+#include <algorithm>
+
+#include "common/common.h"
+#include "common/error.h"
+#include "common/profiler/profiler.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	returns the process-local part of the dot product (a,b)
+template <typename TVector>
+inline number LocalVecProd(const TVector& a, const TVector& b)
+{
+	return const_cast<TVector&>(a).dotprod(b);
+}
+
+#ifdef UG_PARALLEL
+///	returns if (a,b) can be computed without communication
+template <typename TVector>
+inline bool LocalVecProdAdmissible(const ParallelVector<TVector>& a,
+                                   const ParallelVector<TVector>& b)
+{
+	return (a.has_storage_type(PST_ADDITIVE) && b.has_storage_type(PST_CONSISTENT))
+		|| (a.has_storage_type(PST_CONSISTENT) && b.has_storage_type(PST_ADDITIVE))
+		|| (a.has_storage_type(PST_UNIQUE) && b.has_storage_type(PST_UNIQUE));
+}
+
+template <typename TVector>
+inline number LocalVecProd(const ParallelVector<TVector>& a, const ParallelVector<TVector>& b)
+{
+	UG_COND_THROW(!LocalVecProdAdmissible(a, b), "FusedVecProds: storage types "
+			<< a.get_storage_mask() << " and " << b.get_storage_mask()
+			<< " would require communication. Use an additive and a"
+			" consistent vector or two unique vectors.");
+//	storage types are not changed for admissible pairs
+	return const_cast<ParallelVector<TVector>&>(a).local_dotprod(b);
+}
+#endif
+
+///	several dot products summed over all processes in a single reduction
+/**
+ * The process-local parts of the dot products are collected by add(). The
+ * global sums are computed by one (non-blocking) allreduce, which is started
+ * by start() and completed by finish(). Work that does not depend on the
+ * results, e.g. the application of a preconditioner or of the operator, can
+ * be done in between to hide the latency of the reduction.
+ *
+ * In parallel, add() requires storage types that need no communication, i.e.
+ * an additive and a consistent vector or two unique vectors, and throws
+ * otherwise. The storage types of the vectors are not changed by add().
+ * Conversions must be done by the caller before start().
+ *
+ * \tparam 	TVector		vector type
+ */
+template <typename TVector>
+class FusedVecProds
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	public:
+		FusedVecProds() : m_bStarted(false) {}
+
+	///	removes all dot products
+		void clear()
+		{
+			UG_COND_THROW(m_bStarted, "FusedVecProds: reduction still running.");
+			m_vLocal.clear();
+			m_vGlobal.clear();
+		}
+
+	///	adds the dot product (a,b) and returns its index
+		size_t add(const vector_type& a, const vector_type& b)
+		{
+			UG_COND_THROW(m_bStarted, "FusedVecProds: reduction still running.");
+			m_vLocal.push_back(LocalVecProd(a, b));
+			#ifdef UG_PARALLEL
+			m_spLayouts = a.layouts();
+			#endif
+			return m_vLocal.size() - 1;
+		}
+
+	///	adds the dot products (a_i,b_j) of two sets of vectors
+	/**
+	 * The process-local parts are computed in one sweep over chunks of the
+	 * entries, i.e. as a blocked product of the local blocks [a_0 .. a_n]^T
+	 * [b_0 .. b_m], so that each chunk is loaded only once. In parallel, all
+	 * vectors are changed to unique storage type.
+	 *
+	 * \return index of (a_0,b_0), (a_i,b_j) has index + i*vB.size() + j
+	 */
+		size_t add_block(const std::vector<vector_type*>& vA,
+		                 const std::vector<vector_type*>& vB)
+		{
+			PROFILE_BEGIN_GROUP(FusedVecProds_add_block, "algebra");
+			UG_COND_THROW(m_bStarted, "FusedVecProds: reduction still running.");
+			const size_t first = m_vLocal.size();
+			const size_t nA = vA.size(), nB = vB.size();
+			if(nA == 0 || nB == 0) return first;
+
+			#ifdef UG_PARALLEL
+			for(size_t i = 0; i < nA; ++i)
+				if(!vA[i]->change_storage_type(PST_UNIQUE))
+					UG_THROW("FusedVecProds: Cannot convert vector to unique vector.");
+			for(size_t j = 0; j < nB; ++j)
+				if(!vB[j]->change_storage_type(PST_UNIQUE))
+					UG_THROW("FusedVecProds: Cannot convert vector to unique vector.");
+			m_spLayouts = vA[0]->layouts();
+			#endif
+
+			m_vLocal.resize(first + nA*nB, 0.0);
+			double* sum = &m_vLocal[first];
+
+			const size_t size = vA[0]->size();
+			const size_t chunk = 256;
+			for(size_t start = 0; start < size; start += chunk)
+			{
+				const size_t end = std::min(size, start + chunk);
+				for(size_t i = 0; i < nA; ++i)
+				{
+					const vector_type& a = *vA[i];
+					for(size_t j = 0; j < nB; ++j)
+					{
+						const vector_type& b = *vB[j];
+						double s = 0.0;
+						for(size_t k = start; k < end; ++k)
+							s += VecProd(a[k], b[k]);
+						sum[i*nB + j] += s;
+					}
+				}
+			}
+			return first;
+		}
+
+	///	number of dot products
+		size_t size() const {return m_vLocal.size();}
+
+	///	starts the summation over all processes
+		void start()
+		{
+			PROFILE_BEGIN_GROUP(FusedVecProds_start, "algebra");
+			UG_COND_THROW(m_bStarted, "FusedVecProds: reduction already started.");
+			m_vGlobal.resize(m_vLocal.size());
+			m_bStarted = true;
+			#ifdef UG_PARALLEL
+			if(!m_vLocal.empty() && m_spLayouts.valid()
+				&& !m_spLayouts->proc_comm().empty())
+			{
+				m_spLayouts->proc_comm().iallreduce(&m_vLocal[0], &m_vGlobal[0],
+						(int)m_vLocal.size(), PCL_DT_DOUBLE, PCL_RO_SUM, m_request);
+				return;
+			}
+			m_request = MPI_REQUEST_NULL;
+			#endif
+			m_vGlobal = m_vLocal;
+		}
+
+	///	waits for the summation over all processes to complete
+		void finish()
+		{
+			PROFILE_BEGIN_GROUP(FusedVecProds_finish, "algebra");
+			UG_COND_THROW(!m_bStarted, "FusedVecProds: reduction not started.");
+			#ifdef UG_PARALLEL
+			MPI_Wait(&m_request, MPI_STATUS_IGNORE);
+			#endif
+			m_bStarted = false;
+		}
+
+	///	starts and finishes the summation
+		void reduce() {start(); finish();}
+
+	///	returns the i-th summed dot product (valid after finish())
+		number operator[](size_t i) const
+		{
+			UG_ASSERT(!m_bStarted && i < m_vGlobal.size(), "FusedVecProds: invalid access.");
+			return m_vGlobal[i];
+		}
+
+	protected:
+		std::vector<double> m_vLocal;
+		std::vector<double> m_vGlobal;
+		bool m_bStarted;
+
+		#ifdef UG_PARALLEL
+		ConstSmartPtr<AlgebraLayouts> m_spLayouts;
+		MPI_Request m_request;
+		#endif
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__FUSED_REDUCTION__ */
@@ -42,6 +42,7 @@
 	#include "lib_algebra/parallelization/parallelization.h"
 #endif
 #include "../preconditioner/ilut_scalar.h"
+#include "supernodal_lu.h"
 #include "../interface/preconditioned_linear_operator_inverse.h"
 #include "linear_solver.h"
 
@@ -68,6 +69,9 @@ class LU
 	///	Base type
 		typedef IMatrixOperatorInverse<matrix_type,vector_type> base_type;
 
+	///	Ordering type
+		typedef typename SupernodalLU<TAlgebra>::ordering_algo_type ordering_algo_type;
+
 		using base_type::init;
 
 	protected:
@@ -75,7 +79,8 @@ class LU
 
 	public:
 	///	constructor
-		LU() : m_spOperator(NULL), m_mat(), m_bSortSparse(true), m_bInfo(false), m_bShowProgress(true)
+		LU() : m_spOperator(NULL), m_mat(), m_bSortSparse(true), m_bInfo(false), m_bShowProgress(true),
+			m_bSupernodal(false)
 		{
 #ifdef LAPACK_AVAILABLE
 			m_iMinimumForSparse = 4000;
@@ -108,6 +113,21 @@ class LU
 			m_bShowProgress = b;
 		}
 
+	///	use a supernodal sparse LU instead of ILUT(0) for large matrices
+	/**	The supernodal LU computes a fill reducing ordering and the symbolic
+	 * factorization only once as long as the pattern of the matrix does not
+	 * change, only the numeric factorization is repeated in init.*/
+		void set_supernodal(bool b)
+		{
+			m_bSupernodal = b;
+		}
+
+	///	sets the fill reducing ordering of the supernodal LU
+		void set_ordering_algorithm(SmartPtr<ordering_algo_type> spOrderingAlgo)
+		{
+			m_supernodalLU.set_ordering_algorithm(spOrderingAlgo);
+		}
+
 		virtual const char* name() const {return "LU";}
 
 	private:
@@ -186,10 +206,16 @@ class LU
 
 			if(m_bInfo)
 			{
-				UG_LOG("LU using Sparse LU on ");
+				UG_LOG("LU using " << (m_bSupernodal ? "Supernodal" : "Sparse") << " LU on ");
 				print_info(A);
 				UG_LOG("\n");
 			}
+			if(m_bSupernodal)
+			{
+				m_supernodalLU.set_info(m_bInfo);
+				m_supernodalLU.init(A);
+				return true;
+			}
 			ilut_scalar = make_sp(new ILUTScalarPreconditioner<algebra_type>(0.0));
 			ilut_scalar->set_sort(m_bSortSparse);
 			ilut_scalar->set_info(m_bInfo);
@@ -227,7 +253,10 @@ class LU
 		bool solve_sparse(vector_type &x, const vector_type &b)
 		{
 			PROFILE_FUNC();
-			ilut_scalar->solve(x, b);
+			if(m_bSupernodal)
+				m_supernodalLU.solve(x, b);
+			else
+				ilut_scalar->solve(x, b);
 			return true;
 		}
 
@@ -386,6 +415,8 @@ class LU
 			ss << " Minimum Entries for Sparse LU: " << m_iMinimumForSparse;
 			if(m_iMinimumForSparse==0)
 				ss << " (= always Sparse LU)";
+			if(m_bSupernodal)
+				ss << "\n Sparse LU: supernodal";
 			return ss.str();
 		}
 
@@ -411,6 +442,10 @@ class LU
 		SmartPtr<ILUTScalarPreconditioner<algebra_type> > ilut_scalar;
 		size_t m_iMinimumForSparse;
 		bool m_bSortSparse, m_bInfo, m_bShowProgress;
+
+	///	supernodal sparse LU
+		bool m_bSupernodal;
+		SupernodalLU<algebra_type> m_supernodalLU;
 };
 
 } // end namespace ug
@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_BICGSTAB__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_BICGSTAB__
+
+#include <iostream>
+#include <string>
+#include <sstream>
+
+#include "lib_algebra/operator/interface/operator.h"
+#include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
+#include "lib_algebra/operator/interface/linear_solver_profiling.h"
+#include "fused_reduction.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	the pipelined BiCGStab method as a solver for linear operators
+/**
+ * This class implements the pipelined (right) preconditioned BiCGStab
+ * method. BiCGStab needs four blocking reductions per iteration (including
+ * the defect norms). Here, all dot products of a half step are summed in one
+ * non-blocking reduction, which is overlapped with an application of the
+ * preconditioner and of the operator. This gives two hidden reductions per
+ * iteration. The additional vectors are updated by recurrences, so the
+ * iteration needs more vector updates and memory than BiCGStab.
+ *
+ * The preconditioner has to be a fixed linear operator (no inner Krylov
+ * solvers). As in BiCGStab, the convergence check is updated with the
+ * intermediate and the final defect of each iteration. Since the recurrences
+ * drift apart from the true defect, the defect and its images are recomputed
+ * every set_residual_replacement() iterations (three additional applications
+ * of the preconditioner and four of the operator).
+ *
+ * For detailed description of the algorithm, please refer to:
+ *
+ * - Cools, Vanroose, "The communication-hiding pipelined BiCGstab method
+ *   for the parallel solution of large unsymmetric linear systems",
+ *   Parallel Computing 65 (2017), Alg. 3
+ *
+ * \tparam 	TVector		vector type
+ */
+template <typename TVector>
+class PipelinedBiCGStab
+	: public IPreconditionedLinearOperatorInverse<TVector>
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	///	Base type
+		typedef IPreconditionedLinearOperatorInverse<vector_type> base_type;
+
+	protected:
+		using base_type::convergence_check;
+		using base_type::linear_operator;
+		using base_type::preconditioner;
+		using base_type::write_debug;
+
+	public:
+	///	constructors
+		PipelinedBiCGStab() : base_type(), m_numReplace(50) {}
+
+		PipelinedBiCGStab(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond)
+			: base_type ( spPrecond ), m_numReplace(50) {}
+
+		PipelinedBiCGStab( SmartPtr<ILinearIterator<vector_type> > spPrecond,
+		                   SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
+			: base_type(spPrecond, spConvCheck), m_numReplace(50) {}
+
+	///	recomputes the defect every numSteps iterations (numSteps <= 0 --> never)
+		void set_residual_replacement(int numSteps) {m_numReplace = numSteps;}
+
+	///	name of solver
+		virtual const char* name() const {return "PipelinedBiCGStab";}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const
+		{
+			if(preconditioner().valid())
+				return preconditioner()->supports_parallel();
+			return true;
+		}
+
+	// 	Solve J(u)*x = b, such that x = J(u)^{-1} b
+		virtual bool apply_return_defect(vector_type& x, vector_type& b)
+		{
+			LS_PROFILE_BEGIN(LS_ApplyReturnDefect);
+
+		//	check correct storage type in parallel
+			#ifdef UG_PARALLEL
+			if(!b.has_storage_type(PST_ADDITIVE) || !x.has_storage_type(PST_CONSISTENT))
+				UG_THROW("PipelinedBiCGStab: Inadequate storage format of Vectors.");
+			#endif
+
+		//	remember rhs for residual replacement
+			SmartPtr<vector_type> spB;
+			if(m_numReplace > 0) spB = b.clone();
+
+		// 	build defect:  r := b - A*x
+			linear_operator()->apply_sub(b, x);
+			vector_type& r = b;
+
+		// 	create vectors (the hat vectors are preconditioned, i.e. consistent)
+			SmartPtr<vector_type> spR0 = r.clone_without_values(); vector_type& r0 = *spR0;
+			SmartPtr<vector_type> spW = r.clone_without_values(); vector_type& w = *spW;
+			SmartPtr<vector_type> spT = r.clone_without_values(); vector_type& t = *spT;
+			SmartPtr<vector_type> spS = r.clone_without_values(); vector_type& s = *spS;
+			SmartPtr<vector_type> spZ = r.clone_without_values(); vector_type& z = *spZ;
+			SmartPtr<vector_type> spV = r.clone_without_values(); vector_type& v = *spV;
+			SmartPtr<vector_type> spQ = r.clone_without_values(); vector_type& q = *spQ;
+			SmartPtr<vector_type> spY = r.clone_without_values(); vector_type& y = *spY;
+			SmartPtr<vector_type> spRh = x.clone_without_values(); vector_type& rh = *spRh;
+			SmartPtr<vector_type> spWh = x.clone_without_values(); vector_type& wh = *spWh;
+			SmartPtr<vector_type> spPh = x.clone_without_values(); vector_type& ph = *spPh;
+			SmartPtr<vector_type> spSh = x.clone_without_values(); vector_type& sh = *spSh;
+			SmartPtr<vector_type> spZh = x.clone_without_values(); vector_type& zh = *spZh;
+			SmartPtr<vector_type> spQh = x.clone_without_values(); vector_type& qh = *spQh;
+
+		//	prepare convergence check
+			prepare_conv_check();
+
+		//	compute start defect norm
+			convergence_check()->start(r);
+
+		//	convert r to unique (should already be unique due to norm calculation)
+			#ifdef UG_PARALLEL
+			if(!r.change_storage_type(PST_UNIQUE))
+				UG_THROW("PipelinedBiCGStab: Cannot convert r to unique vector.");
+			#endif
+
+		//	shadow residual
+			r0 = r;
+
+			write_debugXR(x, r, convergence_check()->step(), 'i');
+
+		//	rh := M^-1 r, w := A rh, wh := M^-1 w, t := A wh
+			if(!apply_precond_op(rh, w, r, 'i')) return false;
+			if(!apply_precond_op(wh, t, w, 'j')) return false;
+
+		//	alpha = (r0,r) / (r0,w)
+			FusedVecProds<vector_type> dots;
+			const size_t iRho = dots.add(r0, r);
+			const size_t iDenom = dots.add(r0, w);
+			dots.reduce();
+
+			number rho = dots[iRho];
+			if(!check_breakdown(dots[iDenom], "(r0,w)")) return false;
+			number alpha = rho / dots[iDenom], beta = 0.0, omega = 1.0;
+
+			int iter = 0;
+
+		// 	Iteration loop
+			while(!convergence_check()->iteration_ended())
+			{
+			//	update search directions and their images
+				if(iter == 0)
+				{
+					ph = rh; s = w; sh = wh; z = t;
+				}
+				else if(m_numReplace > 0 && iter % m_numReplace == 0)
+				{
+				//	residual replacement: recompute r, rh, w, wh, t and s, sh, z
+					VecScaleAdd(ph, 1.0, rh, beta, ph, -beta*omega, sh);
+
+					r = *spB;
+					linear_operator()->apply_sub(r, x);
+					#ifdef UG_PARALLEL
+					if(!r.change_storage_type(PST_UNIQUE))
+						UG_THROW("PipelinedBiCGStab: Cannot convert r to unique vector.");
+					#endif
+					if(!apply_precond_op(rh, w, r, 'r')) return false;
+					if(!apply_precond_op(wh, t, w, 's')) return false;
+
+					linear_operator()->apply(s, ph);
+					#ifdef UG_PARALLEL
+					if(!s.change_storage_type(PST_UNIQUE))
+						UG_THROW("PipelinedBiCGStab: Cannot convert s to unique vector.");
+					#endif
+					if(!apply_precond_op(sh, z, s, 't')) return false;
+				}
+				else
+				{
+					VecScaleAdd(ph, 1.0, rh, beta, ph, -beta*omega, sh);
+					VecScaleAdd(s, 1.0, w, beta, s, -beta*omega, z);
+					VecScaleAdd(sh, 1.0, wh, beta, sh, -beta*omega, zh);
+					VecScaleAdd(z, 1.0, t, beta, z, -beta*omega, v);
+				}
+				++iter;
+
+			//	intermediate defect q = r - alpha*s, qh = M^-1 q, y = A qh
+				VecScaleAdd(q, 1.0, r, -alpha, s);
+				VecScaleAdd(qh, 1.0, rh, -alpha, sh);
+				VecScaleAdd(y, 1.0, w, -alpha, z);
+
+			//	start reduction of (q,y), (y,y), (q,q)
+				dots.clear();
+				const size_t iQY = dots.add(q, y);
+				const size_t iYY = dots.add(y, y);
+				const size_t iQQ = dots.add(q, q);
+				dots.start();
+
+			//	overlap: zh := M^-1 z, v := A zh
+				if(!apply_precond_op(zh, v, z, 'a')) {dots.finish(); return false;}
+
+				dots.finish();
+
+			// 	check convergence of intermediate defect
+				convergence_check()->update_defect(sqrt(dots[iQQ]));
+				if(convergence_check()->iteration_ended())
+				{
+					VecScaleAdd(x, 1.0, x, alpha, ph);
+					r = q;
+					write_debugXR(x, r, convergence_check()->step(), 'a');
+					break;
+				}
+
+			// 	omega = (q,y)/(y,y)
+				if(!check_breakdown(dots[iYY], "(y,y)")) return false;
+				omega = dots[iQY] / dots[iYY];
+				if(!check_breakdown(omega, "omega")) return false;
+
+			// 	update x, r, rh = M^-1 r and w = A rh
+				VecScaleAdd(x, 1.0, x, alpha, ph, omega, qh);
+				VecScaleAdd(r, 1.0, q, -omega, y);
+				VecScaleAdd(rh, 1.0, qh, -omega, wh, omega*alpha, zh);
+				VecScaleAdd(w, 1.0, y, -omega, t, omega*alpha, v);
+
+			//	start reduction of (r0,r), (r0,w), (r0,s), (r0,z), (r,r)
+				dots.clear();
+				const size_t iR0R = dots.add(r0, r);
+				const size_t iR0W = dots.add(r0, w);
+				const size_t iR0S = dots.add(r0, s);
+				const size_t iR0Z = dots.add(r0, z);
+				const size_t iRR = dots.add(r, r);
+				dots.start();
+
+			//	overlap: wh := M^-1 w, t := A wh
+				if(!apply_precond_op(wh, t, w, 'b')) {dots.finish(); return false;}
+
+				dots.finish();
+
+			// 	check convergence
+				convergence_check()->update_defect(sqrt(dots[iRR]));
+
+				write_debugXR(x, r, convergence_check()->step(), 'b');
+
+			//	new beta and alpha
+				if(!check_breakdown(rho, "rho")) return false;
+				const number rhoNew = dots[iR0R];
+				beta = (alpha / omega) * (rhoNew / rho);
+				const number denom = dots[iR0W] + beta * dots[iR0S]
+									- beta * omega * dots[iR0Z];
+				if(!check_breakdown(denom, "(r0,s)")) return false;
+				alpha = rhoNew / denom;
+				rho = rhoNew;
+			}
+
+		//	print ending output
+			return convergence_check()->post();
+		}
+
+	protected:
+	///	prints a message and returns false if the value is zero
+		bool check_breakdown(number val, const char* what)
+		{
+			if(val != 0.0) return true;
+			UG_LOG("PipelinedBiCGStab: Method breakdown: " << what << " = "
+					<< val << " is an invalid value. Aborting iteration.\n");
+			return false;
+		}
+
+	///	computes ch := M^-1 d (consistent) and c := A ch (unique)
+		bool apply_precond_op(vector_type& ch, vector_type& c, const vector_type& d, char phase)
+		{
+			if(preconditioner().valid())
+			{
+				enter_precond_debug_section(convergence_check()->step(), phase);
+				if(!preconditioner()->apply(ch, d))
+				{
+					UG_LOG("PipelinedBiCGStab: Cannot apply preconditioner. Aborting.\n");
+					this->leave_vector_debug_writer_section();
+					return false;
+				}
+				this->leave_vector_debug_writer_section();
+			}
+			else
+			{
+				ch = d;
+
+			// 	make ch consistent
+				#ifdef UG_PARALLEL
+				if(!ch.change_storage_type(PST_CONSISTENT))
+					UG_THROW("PipelinedBiCGStab: Cannot convert vector to consistent vector.");
+				#endif
+			}
+
+			linear_operator()->apply(c, ch);
+
+		// 	make c unique
+			#ifdef UG_PARALLEL
+			if(!c.change_storage_type(PST_UNIQUE))
+				UG_THROW("PipelinedBiCGStab: Cannot convert vector to unique vector.");
+			#endif
+			return true;
+		}
+
+	public:
+		virtual std::string config_string() const
+		{
+			std::stringstream ss;
+			ss << "PipelinedBiCGStab( residual replacement = " << m_numReplace << ")\n";
+			ss << base_type::config_string_preconditioner_convergence_check();
+			return ss.str();
+		}
+
+	protected:
+	///	prepares the output of the convergence check
+		void prepare_conv_check()
+		{
+		//	set iteration symbol and name
+			convergence_check()->set_name(name());
+			convergence_check()->set_symbol('%');
+
+		//	set preconditioner string
+			std::string s;
+			if(preconditioner().valid())
+			  s = std::string(" (Precond: ") + preconditioner()->name() + ")";
+			else
+				s = " (No Preconditioner) ";
+			convergence_check()->set_info(s);
+		}
+
+	/// debugger output: solution and residual
+		void write_debugXR(vector_type &x, vector_type &r, int loopCnt, char phase)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; sprintf(ext, "-%c_iter%03d", phase, loopCnt);
+			write_debug(r, std::string("PipelinedBiCGStab_Residual") + ext + ".vec");
+			write_debug(x, std::string("PipelinedBiCGStab_Solution") + ext + ".vec");
+		}
+
+	/// debugger section for the preconditioner
+		void enter_precond_debug_section(int loopCnt, char phase)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; sprintf(ext, "-%c_iter%03d", phase, loopCnt);
+			this->enter_vector_debug_writer_section(std::string("PipelinedBiCGStab_Precond") + ext);
+		}
+
+	protected:
+	///	recomputes the defect every m_numReplace iterations (<= 0 --> never)
+		int m_numReplace;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_BICGSTAB__ */
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_CG__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_CG__
+
+#include <iostream>
+#include <string>
+#include <sstream>
+
+#include "lib_algebra/operator/interface/operator.h"
+#include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
+#include "common/profiler/profiler.h"
+#include "fused_reduction.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	the pipelined CG method as a solver for linear operators
+/**
+ * This class implements the pipelined preconditioned CG method. In contrast
+ * to CG, all dot products of an iteration are summed over the processes in
+ * a single non-blocking reduction, which is overlapped with the application
+ * of the preconditioner and of the operator. The additional vectors are
+ * updated by recurrences, so the iteration needs more vector updates and
+ * memory than CG and is slightly less stable in finite precision.
+ *
+ * The preconditioner has to be a fixed linear operator (no inner Krylov
+ * solvers). The defect norm is taken from the reduction of the iteration,
+ * thus the convergence is detected one preconditioner and operator
+ * application later than in CG. Since the recurrences drift apart from the
+ * true defect, the defect and its images are recomputed every
+ * set_residual_replacement() iterations (two additional applications of the
+ * preconditioner and three of the operator).
+ *
+ * For detailed description of the algorithm, please refer to:
+ *
+ * - Ghysels, Vanroose, "Hiding global synchronization latency in the
+ *   preconditioned Conjugate Gradient algorithm", Parallel Computing 40
+ *   (2014), Alg. 3
+ *
+ * \tparam 	TVector		vector type
+ */
+template <typename TVector>
+class PipelinedCG
+	: public IPreconditionedLinearOperatorInverse<TVector>
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	///	Base type
+		typedef IPreconditionedLinearOperatorInverse<vector_type> base_type;
+
+	protected:
+		using base_type::convergence_check;
+		using base_type::linear_operator;
+		using base_type::preconditioner;
+		using base_type::write_debug;
+
+	public:
+	///	constructors
+		PipelinedCG() : base_type(), m_numReplace(50) {}
+
+		PipelinedCG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond)
+			: base_type ( spPrecond ), m_numReplace(50)  {}
+
+		PipelinedCG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond, SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
+			: base_type ( spPrecond, spConvCheck), m_numReplace(50)  {}
+
+	///	recomputes the defect every numSteps iterations (numSteps <= 0 --> never)
+		void set_residual_replacement(int numSteps) {m_numReplace = numSteps;}
+
+	///	name of solver
+		virtual const char* name() const {return "PipelinedCG";}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const
+		{
+			if(preconditioner().valid())
+				return preconditioner()->supports_parallel();
+			return true;
+		}
+
+	///	Solve J(u)*x = b, such that x = J(u)^{-1} b
+		virtual bool apply_return_defect(vector_type& x, vector_type& b)
+		{
+			PROFILE_BEGIN_GROUP(PipelinedCG_apply_return_defect, "CG algebra");
+		//	check parallel storage types
+			#ifdef UG_PARALLEL
+			if(!b.has_storage_type(PST_ADDITIVE) || !x.has_storage_type(PST_CONSISTENT))
+				UG_THROW("PipelinedCG::apply_return_defect:"
+								"Inadequate storage format of Vectors.");
+			#endif
+
+		//	remember rhs for residual replacement
+			SmartPtr<vector_type> spB;
+			if(m_numReplace > 0) spB = b.clone();
+
+		// 	rename r as b (for convenience)
+			vector_type& r = b;
+
+		// 	Build defect:  r := b - J(u)*x
+			linear_operator()->apply_sub(r, x);
+
+		// 	create help vectors (additive: r, w, n, s, z; consistent: u, m, p, q)
+			SmartPtr<vector_type> spU = x.clone_without_values(); vector_type& u = *spU;
+			SmartPtr<vector_type> spW = r.clone_without_values(); vector_type& w = *spW;
+			SmartPtr<vector_type> spM = x.clone_without_values(); vector_type& m = *spM;
+			SmartPtr<vector_type> spN = r.clone_without_values(); vector_type& n = *spN;
+			SmartPtr<vector_type> spP = x.clone_without_values(); vector_type& p = *spP;
+			SmartPtr<vector_type> spQ = x.clone_without_values(); vector_type& q = *spQ;
+			SmartPtr<vector_type> spS = r.clone_without_values(); vector_type& s = *spS;
+			SmartPtr<vector_type> spZ = r.clone_without_values(); vector_type& z = *spZ;
+
+		//	unique copy of r for the defect norm, since (r,r) of additive
+		//	vectors would need communication inside of the reduction
+			#ifdef UG_PARALLEL
+			SmartPtr<vector_type> spRU = r.clone_without_values();
+			vector_type& rNorm = *spRU;
+			#else
+			vector_type& rNorm = r;
+			#endif
+
+			write_debugXR(x, r, convergence_check()->step());
+
+		//	compute start defect
+			prepare_conv_check();
+			convergence_check()->start(r);
+
+		// 	u := M^-1 r, w := A u
+			if(!apply_precond(u, r)) return false;
+			linear_operator()->apply(w, u);
+
+			FusedVecProds<vector_type> dots;
+			number gammaOld = 0.0, alphaOld = 0.0;
+			int iter = 0;
+
+		// 	Iteration loop
+			while(!convergence_check()->iteration_ended())
+			{
+			//	residual replacement: recompute r, u, w and s, q, z
+				if(m_numReplace > 0 && iter > 0 && iter % m_numReplace == 0)
+				{
+					r = *spB;
+					linear_operator()->apply_sub(r, x);
+					if(!apply_precond(u, r)) return false;
+					linear_operator()->apply(w, u);
+					linear_operator()->apply(s, p);
+					if(!apply_precond(q, s)) return false;
+					linear_operator()->apply(z, q);
+				}
+				const bool bFirst = (iter++ == 0);
+
+			//	make the unique copy of r before the reduction is started
+				#ifdef UG_PARALLEL
+				rNorm = r;
+				if(!rNorm.change_storage_type(PST_UNIQUE))
+					UG_THROW("PipelinedCG::apply_return_defect: "
+									"Cannot convert vector to unique vector.");
+				#endif
+
+			//	start reduction of gamma = (r,u), delta = (w,u) and (r,r)
+				dots.clear();
+				const size_t iGamma = dots.add(r, u);
+				const size_t iDelta = dots.add(w, u);
+				const size_t iNorm = dots.add(rNorm, rNorm);
+				dots.start();
+
+			//	overlap: m := M^-1 w, n := A m
+				if(!apply_precond(m, w)) {dots.finish(); return false;}
+				linear_operator()->apply(n, m);
+
+				dots.finish();
+
+			// 	check convergence of current defect
+				if(!bFirst)
+				{
+					convergence_check()->update_defect(sqrt(dots[iNorm]));
+					if(convergence_check()->iteration_ended()) break;
+				}
+
+				const number gamma = dots[iGamma];
+				const number delta = dots[iDelta];
+
+			//	compute alpha, beta
+				number alpha, beta;
+				if(bFirst)
+				{
+					beta = 0.0;
+					alpha = delta;
+				}
+				else
+				{
+					beta = gamma / gammaOld;
+					alpha = delta - beta * gamma / alphaOld;
+				}
+
+			//	check alpha
+				if(alpha == 0.0)
+				{
+					if (x.size())
+					{
+						UG_LOG("ERROR in 'PipelinedCG::apply_return_defect': denominator="
+							<< alpha << " is not admitted. Aborting solver.\n");
+						return false;
+					}
+				//	in cases where a proc has no geometry, we do not want to fail here
+					alpha = 1.0;
+				}
+				alpha = gamma / alpha;
+
+			//	update the directions
+				if(bFirst)
+				{
+					z = n; q = m; s = w; p = u;
+				}
+				else
+				{
+					VecScaleAdd(z, 1.0, n, beta, z);
+					VecScaleAdd(q, 1.0, m, beta, q);
+					VecScaleAdd(s, 1.0, w, beta, s);
+					VecScaleAdd(p, 1.0, u, beta, p);
+				}
+
+			// 	update x, r, u = M^-1 r and w = A u
+				VecScaleAdd(x, 1.0, x, alpha, p);
+				VecScaleAdd(r, 1.0, r, -alpha, s);
+				VecScaleAdd(u, 1.0, u, -alpha, q);
+				VecScaleAdd(w, 1.0, w, -alpha, z);
+
+				write_debugXR(x, r, convergence_check()->step() + 1);
+
+				gammaOld = gamma;
+				alphaOld = alpha;
+			}
+
+		//	post output
+			return convergence_check()->post();
+		}
+
+	protected:
+	///	applies the preconditioner c := M^-1 d (or c := d) and makes c consistent
+		bool apply_precond(vector_type& c, const vector_type& d)
+		{
+			if(preconditioner().valid())
+			{
+				enter_precond_debug_section(convergence_check()->step());
+				if(!preconditioner()->apply(c, d))
+				{
+					UG_LOG("ERROR in 'PipelinedCG::apply_return_defect': "
+							"Cannot apply preconditioner. Aborting.\n");
+					this->leave_vector_debug_writer_section();
+					return false;
+				}
+				this->leave_vector_debug_writer_section();
+			}
+			else c = d;
+
+			#ifdef UG_PARALLEL
+			if(!c.change_storage_type(PST_CONSISTENT))
+				UG_THROW("PipelinedCG::apply_return_defect: "
+								"Cannot convert vector to consistent vector.");
+			#endif
+			return true;
+		}
+
+	///	adjust output of convergence check
+		void prepare_conv_check()
+		{
+		//	set iteration symbol and name
+			convergence_check()->set_name(name());
+			convergence_check()->set_symbol('%');
+
+		//	set preconditioner string
+			std::string s;
+			if(preconditioner().valid())
+			  s = std::string(" (Precond: ") + preconditioner()->name() + ")";
+			else
+				s = " (No Preconditioner) ";
+			convergence_check()->set_info(s);
+		}
+
+	/// debugger output: solution and residual
+		void write_debugXR(vector_type &x, vector_type &r, int loopCnt)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; sprintf(ext, "_iter%03d", loopCnt);
+			write_debug(r, std::string("PipelinedCG_Residual") + ext + ".vec");
+			write_debug(x, std::string("PipelinedCG_Solution") + ext + ".vec");
+		}
+
+	/// debugger section for the preconditioner
+		void enter_precond_debug_section(int loopCnt)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; sprintf(ext, "_iter%03d", loopCnt);
+			this->enter_vector_debug_writer_section(std::string("PipelinedCG_Precond_") + ext);
+		}
+
+	public:
+		virtual std::string config_string() const
+		{
+			std::stringstream ss;
+			ss << "PipelinedCG( residual replacement = " << m_numReplace << ")\n";
+			ss << base_type::config_string_preconditioner_convergence_check();
+			return ss.str();
+		}
+
+	protected:
+	///	recomputes the defect every m_numReplace iterations (<= 0 --> never)
+		int m_numReplace;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_CG__ */
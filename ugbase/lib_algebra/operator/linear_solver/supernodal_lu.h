@@ -0,0 +1,703 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__SUPERNODAL_LU__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__SUPERNODAL_LU__
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "common/common.h"
+#include "common/profiler/profiler.h"
+#include "common/util/smart_pointer.h"
+#include "common/util/string_util.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+#include "lib_algebra/ordering_strategies/algorithms/IOrderingAlgorithm.h"
+#include "lib_algebra/ordering_strategies/algorithms/native_nested_dissection.h"
+
+namespace ug{
+
+/// \addtogroup lib_algebra
+///	@{
+
+/**
+ * Sparse direct LU decomposition with a fill reducing ordering and a
+ * supernodal numeric factorization.
+ *
+ * The factorization consists of two phases:
+ * - symbolic: The block rows are ordered by an IOrderingAlgorithm (default:
+ *   nested dissection) and the elimination tree is postordered. Based on the
+ *   symmetric pattern of A + A^T the column counts of L are computed and
+ *   consecutive columns with the same structure are combined to
+ *   supernodes. Since the blocks of the matrix are dense, a block is never
+ *   split between supernodes.
+ *   The symbolic factorization is reused as long as the pattern of the
+ *   matrix does not change.
+ * - numeric: Right-looking factorization of the supernodes. Each supernode
+ *   stores its columns of L and its rows of U as dense panels, so that the
+ *   factorization of the diagonal block, the triangular solves and the
+ *   Schur complement updates are dense operations (LAPACK/BLAS-3 if
+ *   available). Partial pivoting is done within the diagonal block of each
+ *   supernode only.
+ *
+ * \tparam	TAlgebra	Algebra type (blocks have to be of static size)
+ */
+template <typename TAlgebra>
+class SupernodalLU
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Matrix type
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Ordering type
+		typedef std::vector<size_t> ordering_container_type;
+		typedef IOrderingAlgorithm<TAlgebra, ordering_container_type> ordering_algo_type;
+
+	private:
+		typedef typename matrix_type::value_type block_type;
+		typedef typename matrix_type::const_row_iterator const_row_iterator;
+
+	public:
+		SupernodalLU() : m_bInfo(false), m_n(0), m_numSymbolic(0) {}
+
+	///	sets the fill reducing ordering (default: NativeNestedDissectionOrdering)
+		void set_ordering_algorithm(SmartPtr<ordering_algo_type> spOrderingAlgo)
+		{
+			m_spOrderingAlgo = spOrderingAlgo;
+			m_vPatRowStart.clear();
+		}
+
+	///	print information about the factorization
+		void set_info(bool b) {m_bInfo = b;}
+
+	///	computes the factorization of A
+	/**	the symbolic factorization is only recomputed if the pattern of A
+	 * differs from the one of the last call.*/
+		void init(const matrix_type &A)
+		{
+			PROFILE_FUNC_GROUP("algebra lu");
+			UG_COND_THROW(!block_traits<block_type>::is_static,
+						  "SupernodalLU: only blocks of static size supported.");
+			UG_COND_THROW(A.num_rows() != A.num_cols(),
+						  "SupernodalLU: only square matrices supported.");
+
+			if(!same_pattern(A))
+				symbolic(A);
+			numeric(A);
+
+			if(m_bInfo) print_info();
+		}
+
+	///	computes x = A^{-1} b
+		void solve(vector_type &x, const vector_type &b)
+		{
+			PROFILE_FUNC_GROUP("algebra lu");
+			const size_t bs = blockSize;
+			UG_COND_THROW(b.size() != m_n || x.size() != m_n,
+						  "SupernodalLU: vector size does not match matrix size.");
+
+			m_y.resize(m_n*bs);
+			for(size_t i=0; i<m_n; i++)
+				for(size_t c=0; c<bs; c++)
+					m_y[m_vPerm[i]*bs+c] = BlockRef(b[i], c);
+
+		//	forward substitution
+			for(size_t s=0; s<num_supernodes(); s++)
+			{
+				const size_t F = m_vSnStart[s]*bs, k = num_cols(s), m = num_struct(s), lda = k+m;
+				const double *pL = &m_vL[m_vLOffset[s]];
+				const int *pPiv = &m_vPivot[F];
+				const size_t *pR = m_vStruct.data() + m_vStructStart[s];
+				double *y = &m_y[F];
+
+				for(size_t i=0; i<k; i++)
+					if((size_t)pPiv[i] != i) std::swap(y[i], y[pPiv[i]]);
+				for(size_t j=0; j<k; j++)
+					for(size_t i=j+1; i<k; i++)
+						y[i] -= pL[j*lda+i] * y[j];
+				for(size_t j=0; j<k; j++)
+					for(size_t a=0; a<m; a++)
+						m_y[pR[a/bs]*bs + a%bs] -= pL[j*lda+k+a] * y[j];
+			}
+
+		//	backward substitution
+			for(size_t s=num_supernodes(); s-- > 0; )
+			{
+				const size_t F = m_vSnStart[s]*bs, k = num_cols(s), m = num_struct(s), lda = k+m;
+				const double *pL = &m_vL[m_vLOffset[s]];
+				const double *pU = m_vU.data() + m_vUOffset[s];
+				const size_t *pR = m_vStruct.data() + m_vStructStart[s];
+				double *y = &m_y[F];
+
+				for(size_t a=0; a<m; a++)
+				{
+					const double xa = m_y[pR[a/bs]*bs + a%bs];
+					for(size_t i=0; i<k; i++)
+						y[i] -= pU[a*k+i] * xa;
+				}
+				for(size_t j=k; j-- > 0; )
+				{
+					y[j] /= pL[j*lda+j];
+					for(size_t i=0; i<j; i++)
+						y[i] -= pL[j*lda+i] * y[j];
+				}
+			}
+
+			for(size_t i=0; i<m_n; i++)
+				for(size_t c=0; c<bs; c++)
+					BlockRef(x[i], c) = m_y[m_vPerm[i]*bs+c];
+		}
+
+	///	number of supernodes
+		size_t num_supernodes() const {return m_vSnStart.empty() ? 0 : m_vSnStart.size()-1;}
+
+	///	number of stored entries in L and U
+		size_t num_entries() const {return m_vL.size() + m_vU.size();}
+
+	///	number of symbolic factorizations done so far
+		size_t num_symbolic_factorizations() const {return m_numSymbolic;}
+
+	///	prints information about the factorization
+		void print_info() const
+		{
+			size_t maxCols = 0;
+			for(size_t s=0; s<num_supernodes(); s++)
+				maxCols = std::max(maxCols, num_cols(s));
+			UG_LOG("SupernodalLU: " << m_n*blockSize << " unknowns, " << num_supernodes()
+				   << " supernodes (max. " << maxCols << " columns), "
+				   << num_entries() << " entries in L+U ("
+				   << GetBytesSizeString(num_entries()*sizeof(double)) << "), "
+				   << m_numSymbolic << " symbolic factorizations.\n");
+		}
+
+	protected:
+		static const size_t blockSize = block_traits<block_type>::static_num_rows;
+		static const size_t invalid = (size_t)-1;
+
+	///	number of (scalar) columns of supernode s
+		size_t num_cols(size_t s) const {return (m_vSnStart[s+1]-m_vSnStart[s])*blockSize;}
+
+	///	number of (scalar) off-diagonal rows of supernode s
+		size_t num_struct(size_t s) const {return (m_vStructStart[s+1]-m_vStructStart[s])*blockSize;}
+
+	///	position of block row i in the structure of supernode s
+		size_t struct_index(size_t s, size_t i) const
+		{
+			const size_t *pBegin = m_vStruct.data() + m_vStructStart[s];
+			const size_t *pEnd = m_vStruct.data() + m_vStructStart[s+1];
+			const size_t *p = std::lower_bound(pBegin, pEnd, i);
+			UG_ASSERT(p != pEnd && *p == i, "SupernodalLU: entry " << i << " not in structure of supernode " << s);
+			return p - pBegin;
+		}
+
+	///	returns true if A has the pattern of the last symbolic factorization
+		bool same_pattern(const matrix_type &A) const
+		{
+			if(m_vPatRowStart.size() != A.num_rows()+1) return false;
+			size_t k = 0;
+			for(size_t r=0; r<A.num_rows(); r++)
+			{
+				if(m_vPatRowStart[r] != k) return false;
+				for(const_row_iterator it = A.begin_row(r); it != A.end_row(r); ++it, ++k)
+					if(k >= m_vPatCol.size() || m_vPatCol[k] != it.index()) return false;
+			}
+			return k == m_vPatCol.size();
+		}
+
+	///	computes the fill reducing ordering (vPerm[old] = new)
+		void compute_ordering(const matrix_type &A, std::vector<size_t> &vPerm)
+		{
+			const size_t n = A.num_rows();
+			SmartPtr<ordering_algo_type> spOrderingAlgo = m_spOrderingAlgo;
+			if(spOrderingAlgo.invalid())
+				spOrderingAlgo = make_sp(new NativeNestedDissectionOrdering<TAlgebra, ordering_container_type>());
+
+		//	the ordering algorithms do not change the matrix
+			spOrderingAlgo->init(const_cast<matrix_type*>(&A));
+			spOrderingAlgo->compute();
+			vPerm = spOrderingAlgo->ordering();
+			UG_COND_THROW(vPerm.size() != n, "SupernodalLU: ordering of "
+						  << spOrderingAlgo->name() << " has wrong size.");
+		}
+
+	///	creates the symmetric pattern of PAP^T + (PAP^T)^T without diagonal
+		void create_graph(const std::vector<size_t> &vPerm,
+		                  std::vector<size_t> &vAdjStart, std::vector<size_t> &vAdj) const
+		{
+			const size_t n = vPerm.size();
+			vAdjStart.assign(n+1, 0);
+			for(size_t r=0; r<n; r++)
+				for(size_t k=m_vPatRowStart[r]; k<m_vPatRowStart[r+1]; k++)
+					if(m_vPatCol[k] != r)
+					{
+						vAdjStart[vPerm[r]+1]++;
+						vAdjStart[vPerm[m_vPatCol[k]]+1]++;
+					}
+			for(size_t i=0; i<n; i++) vAdjStart[i+1] += vAdjStart[i];
+
+			std::vector<size_t> vPos(vAdjStart.begin(), vAdjStart.end()-1);
+			vAdj.resize(vAdjStart[n]);
+			for(size_t r=0; r<n; r++)
+				for(size_t k=m_vPatRowStart[r]; k<m_vPatRowStart[r+1]; k++)
+					if(m_vPatCol[k] != r)
+					{
+						const size_t i = vPerm[r], j = vPerm[m_vPatCol[k]];
+						vAdj[vPos[i]++] = j;
+						vAdj[vPos[j]++] = i;
+					}
+		}
+
+	///	computes the elimination tree of the symmetric graph (Liu)
+		void elimination_tree(const std::vector<size_t> &vAdjStart, const std::vector<size_t> &vAdj,
+		                      std::vector<size_t> &vParent) const
+		{
+			const size_t n = vAdjStart.size()-1;
+			std::vector<size_t> vAncestor(n, invalid);
+			vParent.assign(n, invalid);
+			for(size_t k=0; k<n; k++)
+				for(size_t e=vAdjStart[k]; e<vAdjStart[k+1]; e++)
+				{
+					size_t r = vAdj[e];
+					if(r >= k) continue;
+				//	follow path to root, compress path to k
+					while(vAncestor[r] != invalid && vAncestor[r] != k)
+					{
+						const size_t next = vAncestor[r];
+						vAncestor[r] = k;
+						r = next;
+					}
+					if(vAncestor[r] == invalid)
+					{
+						vAncestor[r] = k;
+						vParent[r] = k;
+					}
+				}
+		}
+
+	///	computes a postorder of the tree (vPost[k] = k-th node)
+		void postorder(const std::vector<size_t> &vParent, std::vector<size_t> &vPost) const
+		{
+			const size_t n = vParent.size();
+			std::vector<size_t> vChildStart(n+3, 0), vChild(n);
+			for(size_t i=0; i<n; i++)
+				vChildStart[(vParent[i] == invalid ? n : vParent[i])+2]++;
+			for(size_t i=0; i<=n; i++) vChildStart[i+2] += vChildStart[i+1];
+			for(size_t i=0; i<n; i++)
+				vChild[vChildStart[(vParent[i] == invalid ? n : vParent[i])+1]++] = i;
+
+		//	depth first search starting from the virtual root n
+			vPost.clear(); vPost.reserve(n);
+			std::vector<size_t> vStack(1, n), vNext(n+1);
+			for(size_t i=0; i<=n; i++) vNext[i] = vChildStart[i];
+			while(!vStack.empty())
+			{
+				const size_t i = vStack.back();
+				if(vNext[i] < vChildStart[i+1])
+					vStack.push_back(vChild[vNext[i]++]);
+				else
+				{
+					vStack.pop_back();
+					if(i != n) vPost.push_back(i);
+				}
+			}
+		}
+
+	///	computes ordering, supernodes and their structure
+		void symbolic(const matrix_type &A)
+		{
+			PROFILE_FUNC_GROUP("algebra lu");
+			const size_t n = A.num_rows();
+			m_n = n;
+			m_numSymbolic++;
+
+		//	remember pattern
+			m_vPatRowStart.resize(n+1);
+			m_vPatCol.clear();
+			for(size_t r=0; r<n; r++)
+			{
+				m_vPatRowStart[r] = m_vPatCol.size();
+				for(const_row_iterator it = A.begin_row(r); it != A.end_row(r); ++it)
+					m_vPatCol.push_back(it.index());
+			}
+			m_vPatRowStart[n] = m_vPatCol.size();
+
+			m_vSnStart.assign(1, 0);
+			m_vSnOf.clear();
+			m_vStructStart.assign(1, 0);
+			m_vStruct.clear();
+			m_vLOffset.assign(1, 0);
+			m_vUOffset.assign(1, 0);
+			if(n == 0) {m_vPerm.clear(); return;}
+
+		//	fill reducing ordering
+			std::vector<size_t> vPerm;
+			compute_ordering(A, vPerm);
+
+		//	postorder the elimination tree, so that the columns of a supernode
+		//	are consecutive and all descendants come before a supernode
+			std::vector<size_t> vAdjStart, vAdj, vParent, vPost;
+			create_graph(vPerm, vAdjStart, vAdj);
+			elimination_tree(vAdjStart, vAdj, vParent);
+			postorder(vParent, vPost);
+			std::vector<size_t> vPostInv(n);
+			for(size_t k=0; k<n; k++) vPostInv[vPost[k]] = k;
+			for(size_t i=0; i<n; i++) vPerm[i] = vPostInv[vPerm[i]];
+			create_graph(vPerm, vAdjStart, vAdj);
+			elimination_tree(vAdjStart, vAdj, vParent);
+			m_vPerm.swap(vPerm);
+
+		//	column counts of L (row subtrees)
+			std::vector<size_t> vColCount(n, 1), vMark(n, invalid);
+			for(size_t i=0; i<n; i++)
+				for(size_t e=vAdjStart[i]; e<vAdjStart[i+1]; e++)
+					for(size_t j=vAdj[e]; j < i && vMark[j] != i; j = vParent[j])
+					{
+						vMark[j] = i;
+						vColCount[j]++;
+					}
+
+		//	supernodes: chains of columns with the same structure (fundamental
+		//	supernodes). Small supernodes are relaxed, i.e. a few explicit zeros
+		//	are stored in order to get larger dense blocks.
+			std::vector<size_t> vNumChildren(n, 0);
+			for(size_t j=0; j<n; j++)
+				if(vParent[j] != invalid) vNumChildren[vParent[j]]++;
+			m_vSnOf.resize(n);
+			for(size_t j=1; j<n; j++)
+			{
+				const bool bChain = (vParent[j-1] == j && vNumChildren[j] == 1);
+				const bool bSame = (vColCount[j-1] == vColCount[j]+1);
+				const bool bRelax = (j - m_vSnStart.back() < 4
+									 && vColCount[j-1] <= vColCount[j]+4);
+				if(!bChain || !(bSame || bRelax))
+					m_vSnStart.push_back(j);
+			}
+			m_vSnStart.push_back(n);
+			const size_t numSn = num_supernodes();
+			for(size_t s=0; s<numSn; s++)
+				for(size_t j=m_vSnStart[s]; j<m_vSnStart[s+1]; j++)
+					m_vSnOf[j] = s;
+
+		//	children in the supernodal elimination tree
+			std::vector<size_t> vChildStart(numSn+3, 0), vChild(numSn);
+			std::vector<size_t> vSnParent(numSn, invalid);
+			for(size_t s=0; s<numSn; s++)
+			{
+				const size_t p = vParent[m_vSnStart[s+1]-1];
+				if(p != invalid) vSnParent[s] = m_vSnOf[p];
+				vChildStart[(vSnParent[s] == invalid ? numSn : vSnParent[s])+2]++;
+			}
+			for(size_t s=0; s<=numSn; s++) vChildStart[s+2] += vChildStart[s+1];
+			for(size_t s=0; s<numSn; s++)
+				vChild[vChildStart[(vSnParent[s] == invalid ? numSn : vSnParent[s])+1]++] = s;
+
+		//	structure of the supernodes: off-diagonal rows of A and of the children
+			std::fill(vMark.begin(), vMark.end(), invalid);
+			for(size_t s=0; s<numSn; s++)
+			{
+				const size_t l = m_vSnStart[s+1];
+				const size_t start = m_vStruct.size();
+				for(size_t j=m_vSnStart[s]; j<l; j++)
+					for(size_t e=vAdjStart[j]; e<vAdjStart[j+1]; e++)
+					{
+						const size_t i = vAdj[e];
+						if(i >= l && vMark[i] != s) {vMark[i] = s; m_vStruct.push_back(i);}
+					}
+				for(size_t c=vChildStart[s]; c<vChildStart[s+1]; c++)
+				{
+					const size_t child = vChild[c];
+					for(size_t e=m_vStructStart[child]; e<m_vStructStart[child+1]; e++)
+					{
+						const size_t i = m_vStruct[e];
+						if(i >= l && vMark[i] != s) {vMark[i] = s; m_vStruct.push_back(i);}
+					}
+				}
+				std::sort(m_vStruct.begin()+start, m_vStruct.end());
+				m_vStructStart.push_back(m_vStruct.size());
+
+				const size_t k = num_cols(s), m = num_struct(s);
+				m_vLOffset.push_back(m_vLOffset.back() + (k+m)*k);
+				m_vUOffset.push_back(m_vUOffset.back() + k*m);
+			}
+		}
+
+	///	returns the entry (nr, nc) (permuted scalar indices nr*bs+a, nc*bs+b) in the panels
+		double &entry(size_t nr, size_t nc, size_t a, size_t b)
+		{
+			const size_t bs = blockSize;
+			const size_t t = m_vSnOf[std::min(nr, nc)];
+			const size_t f = m_vSnStart[t], l = m_vSnStart[t+1];
+			const size_t k = num_cols(t), m = num_struct(t);
+			if(nc < l)
+			{
+				const size_t row = (nr < l) ? (nr-f)*bs + a : k + struct_index(t, nr)*bs + a;
+				return m_vL[m_vLOffset[t] + ((nc-f)*bs+b)*(k+m) + row];
+			}
+			else
+				return m_vU[m_vUOffset[t] + (struct_index(t, nc)*bs+b)*k + (nr-f)*bs + a];
+		}
+
+	///	computes the numeric factorization
+		void numeric(const matrix_type &A)
+		{
+			PROFILE_FUNC_GROUP("algebra lu");
+			const size_t bs = blockSize;
+			const size_t numSn = num_supernodes();
+
+		//	copy A into the panels
+			m_vL.assign(m_vLOffset.back(), 0.0);
+			m_vU.assign(m_vUOffset.back(), 0.0);
+			m_vPivot.resize(m_n*bs);
+			for(size_t r=0; r<m_n; r++)
+				for(const_row_iterator it = A.begin_row(r); it != A.end_row(r); ++it)
+				{
+					const size_t nr = m_vPerm[r], nc = m_vPerm[it.index()];
+					const block_type &v = it.value();
+					for(size_t a=0; a<bs; a++)
+						for(size_t b=0; b<bs; b++)
+							entry(nr, nc, a, b) = BlockRef(v, a, b);
+				}
+
+			std::vector<double> vBuf;
+			std::vector<size_t> vRel;
+			for(size_t s=0; s<numSn; s++)
+			{
+				const size_t k = num_cols(s), m = num_struct(s), lda = k+m;
+				double *pL = &m_vL[m_vLOffset[s]];
+				double *pU = m_vU.data() + m_vUOffset[s];
+				int *pPiv = &m_vPivot[m_vSnStart[s]*bs];
+
+			//	diagonal block: P D = L_D U_D
+				if(!dense_lu(k, pL, lda, pPiv))
+					UG_THROW("SupernodalLU: matrix is singular (zero pivot in supernode " << s << ").");
+				if(m == 0) continue;
+
+			//	U panel := L_D^{-1} P U panel, L panel := L panel U_D^{-1}
+				for(size_t i=0; i<k; i++)
+					if((size_t)pPiv[i] != i)
+						for(size_t a=0; a<m; a++)
+							std::swap(pU[a*k+i], pU[a*k+pPiv[i]]);
+				dense_solve_lower_unit(k, m, pL, lda, pU, k);
+				dense_solve_upper_right(m, k, pL, lda, pL+k, lda);
+
+			//	Schur complement update of the ancestors, grouped by target supernode
+				const size_t *pR = m_vStruct.data() + m_vStructStart[s];
+				const size_t nR = m_vStructStart[s+1] - m_vStructStart[s];
+				vRel.resize(m);
+				for(size_t g0 = 0; g0 < nR; )
+				{
+					const size_t t = m_vSnOf[pR[g0]];
+					const size_t ft = m_vSnStart[t], lt = m_vSnStart[t+1];
+					const size_t kt = num_cols(t), mt = num_struct(t);
+					size_t g1 = g0;
+					while(g1 < nR && pR[g1] < lt) g1++;
+
+				//	relative positions of the remaining rows in the panels of t
+					const size_t *pRt = m_vStruct.data() + m_vStructStart[t];
+					for(size_t ga=g0, p=0; ga<nR; ga++)
+					{
+						size_t rel;
+						if(pR[ga] < lt) rel = (pR[ga]-ft)*bs;
+						else
+						{
+							while(pRt[p] < pR[ga]) p++;
+							UG_ASSERT(pRt[p] == pR[ga], "SupernodalLU: structure of supernode " << t << " incomplete.");
+							rel = kt + p*bs;
+						}
+						for(size_t c=0; c<bs; c++) vRel[ga*bs+c] = rel+c;
+					}
+
+				//	columns of t: L_t(rows, cols) -= L(rows) U(cols)
+					const size_t a0 = g0*bs, a1 = g1*bs;
+					double *pLt = &m_vL[m_vLOffset[t]];
+					vBuf.resize((m-a0)*(a1-a0));
+					dense_mult(m-a0, a1-a0, k, pL+k+a0, lda, pU+a0*k, k, &vBuf[0], m-a0);
+					for(size_t cb=0; cb<a1-a0; cb++)
+					{
+						double *pCol = pLt + vRel[a0+cb]*(kt+mt);
+						const double *pB = &vBuf[cb*(m-a0)];
+						for(size_t rb=0; rb<m-a0; rb++)
+							pCol[vRel[a0+rb]] -= pB[rb];
+					}
+
+				//	rows of t: U_t(rows, cols) -= L(rows) U(cols)
+					if(a1 < m)
+					{
+						double *pUt = &m_vU[m_vUOffset[t]];
+						vBuf.resize((a1-a0)*(m-a1));
+						dense_mult(a1-a0, m-a1, k, pL+k+a0, lda, pU+a1*k, k, &vBuf[0], a1-a0);
+						for(size_t cb=0; cb<m-a1; cb++)
+						{
+							double *pCol = pUt + (vRel[a1+cb]-kt)*kt;
+							const double *pB = &vBuf[cb*(a1-a0)];
+							for(size_t rb=0; rb<a1-a0; rb++)
+								pCol[vRel[a0+rb]] -= pB[rb];
+						}
+					}
+					g0 = g1;
+				}
+			}
+		}
+
+	///	LU decomposition with partial pivoting of the n x n matrix A (pivots 0-based)
+		static bool dense_lu(size_t n, double *A, size_t lda, int *pPiv)
+		{
+#if defined(LAPACK_AVAILABLE) && defined(BLAS_AVAILABLE)
+			const lapack_int info = getrf(n, n, A, lda, pPiv);
+			for(size_t i=0; i<n; i++) pPiv[i]--;
+			return info == 0;
+#else
+			for(size_t j=0; j<n; j++)
+			{
+				size_t p = j;
+				for(size_t i=j+1; i<n; i++)
+					if(fabs(A[j*lda+i]) > fabs(A[j*lda+p])) p = i;
+				pPiv[j] = p;
+				if(A[j*lda+p] == 0.0) return false;
+				if(p != j)
+					for(size_t c=0; c<n; c++) std::swap(A[c*lda+j], A[c*lda+p]);
+				const double invPivot = 1.0/A[j*lda+j];
+				for(size_t i=j+1; i<n; i++) A[j*lda+i] *= invPivot;
+				for(size_t c=j+1; c<n; c++)
+				{
+					const double ajc = A[c*lda+j];
+					for(size_t i=j+1; i<n; i++) A[c*lda+i] -= A[j*lda+i] * ajc;
+				}
+			}
+			return true;
+#endif
+		}
+
+	///	B := L^{-1} B, with L the n x n unit lower triangle of A and B n x m
+		static void dense_solve_lower_unit(size_t n, size_t m, const double *A, size_t lda, double *B, size_t ldb)
+		{
+#if defined(LAPACK_AVAILABLE) && defined(BLAS_AVAILABLE)
+			trsm(true, true, ModeNoTrans, true, n, m, 1.0, A, lda, B, ldb);
+#else
+			for(size_t c=0; c<m; c++)
+				for(size_t j=0; j<n; j++)
+				{
+					const double bj = B[c*ldb+j];
+					for(size_t i=j+1; i<n; i++) B[c*ldb+i] -= A[j*lda+i] * bj;
+				}
+#endif
+		}
+
+	///	B := B U^{-1}, with U the n x n upper triangle of A and B m x n
+		static void dense_solve_upper_right(size_t m, size_t n, const double *A, size_t lda, double *B, size_t ldb)
+		{
+#if defined(LAPACK_AVAILABLE) && defined(BLAS_AVAILABLE)
+			trsm(false, false, ModeNoTrans, false, m, n, 1.0, A, lda, B, ldb);
+#else
+			for(size_t j=0; j<n; j++)
+			{
+				for(size_t i=0; i<j; i++)
+				{
+					const double u = A[j*lda+i];
+					for(size_t r=0; r<m; r++) B[j*ldb+r] -= B[i*ldb+r] * u;
+				}
+				const double invDiag = 1.0/A[j*lda+j];
+				for(size_t r=0; r<m; r++) B[j*ldb+r] *= invDiag;
+			}
+#endif
+		}
+
+	///	C := A B, with A m x k, B k x n and C m x n
+		static void dense_mult(size_t m, size_t n, size_t k, const double *A, size_t lda,
+		                       const double *B, size_t ldb, double *C, size_t ldc)
+		{
+#if defined(LAPACK_AVAILABLE) && defined(BLAS_AVAILABLE)
+			gemm(ModeNoTrans, ModeNoTrans, m, n, k, 1.0, A, lda, B, ldb, 0.0, C, ldc);
+#else
+			for(size_t j=0; j<n; j++)
+			{
+				double *pC = C + j*ldc;
+				for(size_t i=0; i<m; i++) pC[i] = 0.0;
+				for(size_t p=0; p<k; p++)
+				{
+					const double bpj = B[j*ldb+p];
+					const double *pA = A + p*lda;
+					for(size_t i=0; i<m; i++) pC[i] += pA[i] * bpj;
+				}
+			}
+#endif
+		}
+
+	protected:
+	///	fill reducing ordering (default: nested dissection)
+		SmartPtr<ordering_algo_type> m_spOrderingAlgo;
+		bool m_bInfo;
+
+	///	number of block rows
+		size_t m_n;
+		size_t m_numSymbolic;
+
+	///	pattern of the last symbolically factorized matrix
+		std::vector<size_t> m_vPatRowStart, m_vPatCol;
+
+	///	m_vPerm[old block index] = new block index
+		std::vector<size_t> m_vPerm;
+
+	///	supernode s has the block columns m_vSnStart[s] ... m_vSnStart[s+1]-1
+		std::vector<size_t> m_vSnStart;
+		std::vector<size_t> m_vSnOf;	///< supernode of a block column
+
+	///	off-diagonal block rows of supernode s (sorted)
+		std::vector<size_t> m_vStructStart, m_vStruct;
+
+	///	L panels ((k+m) x k, col major) and U panels (k x m, col major)
+		std::vector<size_t> m_vLOffset, m_vUOffset;
+		std::vector<double> m_vL, m_vU;
+		std::vector<int> m_vPivot;
+
+	///	help vector for solve
+		std::vector<double> m_y;
+};
+
+template <typename TAlgebra>
+const size_t SupernodalLU<TAlgebra>::blockSize;
+
+template <typename TAlgebra>
+const size_t SupernodalLU<TAlgebra>::invalid;
+
+/// @}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__SUPERNODAL_LU__ */
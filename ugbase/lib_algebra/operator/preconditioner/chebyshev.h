@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__CHEBYSHEV__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__CHEBYSHEV__
+
+#include <cmath>
+
+#include "lib_algebra/operator/interface/preconditioner.h"
+#include "jacobi.h"
+
+namespace ug{
+
+///	Chebyshev polynomial smoother
+/**
+ * The Chebyshev smoother applies a polynomial \f$ p(D^{-1}A) D^{-1} \f$ of the
+ * Jacobi-preconditioned operator to the defect. The polynomial is chosen such
+ * that the error components with eigenvalues of \f$ D^{-1}A \f$ in the interval
+ * \f$ [\lambda_{max} / r, \lambda_{max}] \f$ are damped optimally, where r is
+ * the eigenvalue ratio. The smoother only needs matrix-vector products,
+ * the inverse diagonal and vector updates, i.e. it is parallel without any
+ * coloring or ordering of the unknowns.
+ *
+ * The largest eigenvalue of \f$ D^{-1}A \f$ is estimated once in the init
+ * by a few steps of a power iteration, or may be set explicitly. The Dirichlet
+ * dofs can be excluded from the estimate by a mask (see set_dirichlet_mask).
+ *
+ * The smoother assumes that \f$ D^{-1}A \f$ has a real, non-negative spectrum
+ * (e.g. symmetric positive definite A).
+ *
+ * References:
+ * <ul>
+ * <li> M. Adams, M. Brezina, J. Hu, R. Tuminaro. Parallel multigrid smoothing:
+ *      polynomial versus Gauss-Seidel. J. Comput. Phys. 188 (2003)
+ * </ul>
+ */
+template <typename TAlgebra>
+class Chebyshev : public IPreconditioner<TAlgebra>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Matrix type
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Matrix Operator type
+		typedef typename IPreconditioner<TAlgebra>::matrix_operator_type matrix_operator_type;
+
+	///	Base type
+		typedef IPreconditioner<TAlgebra> base_type;
+
+	protected:
+		using base_type::set_debug;
+		using base_type::debug_writer;
+		using base_type::write_debug;
+
+	public:
+	///	default constructor
+		Chebyshev()
+			: m_degree(3), m_eigRatio(30.0), m_safety(1.1),
+			  m_powerIter(20), m_powerPrecision(1e-3),
+			  m_userMaxEigenvalue(0.0), m_maxEigenvalue(0.0)
+		{}
+
+	///	constructor setting the polynomial degree
+		Chebyshev(size_t degree)
+			: m_degree(degree), m_eigRatio(30.0), m_safety(1.1),
+			  m_powerIter(20), m_powerPrecision(1e-3),
+			  m_userMaxEigenvalue(0.0), m_maxEigenvalue(0.0)
+		{}
+
+	/// clone constructor
+		Chebyshev(const Chebyshev<TAlgebra> &parent)
+			: base_type(parent),
+			  m_degree(parent.m_degree), m_eigRatio(parent.m_eigRatio),
+			  m_safety(parent.m_safety), m_powerIter(parent.m_powerIter),
+			  m_powerPrecision(parent.m_powerPrecision),
+			  m_userMaxEigenvalue(parent.m_userMaxEigenvalue), m_maxEigenvalue(0.0),
+			  m_spMask(parent.m_spMask)
+		{}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new Chebyshev<algebra_type>(*this));
+		}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const {return true;}
+
+	///	Destructor
+		virtual ~Chebyshev() {};
+
+	///	sets the degree of the polynomial (number of matrix-vector products per step)
+		void set_degree(size_t degree)
+		{
+			UG_COND_THROW(degree == 0, "Chebyshev: Degree must be at least 1.");
+			m_degree = degree;
+		}
+
+	///	sets the ratio of the largest and smallest eigenvalue of the smoothed interval
+		void set_eigenvalue_ratio(number ratio)
+		{
+			UG_COND_THROW(ratio <= 1.0, "Chebyshev: Eigenvalue ratio must be larger than 1.");
+			m_eigRatio = ratio;
+		}
+
+	///	sets the factor the estimated largest eigenvalue is enlarged by
+		void set_safety_factor(number safety) {m_safety = safety;}
+
+	///	sets the largest eigenvalue of D^{-1}A explicitly (0 = estimate in init)
+		void set_max_eigenvalue(number lambda) {m_userMaxEigenvalue = lambda;}
+
+	///	sets the number of iterations and the precision of the eigenvalue estimate
+		void set_power_method(size_t maxIter, number precision)
+		{
+			m_powerIter = maxIter;
+			m_powerPrecision = precision;
+		}
+
+	///	sets a mask that is zero for the dofs excluded from the eigenvalue estimate
+	/**	The mask is read in every init, e.g. the one of a matrix-free operator
+	 * marking its Dirichlet dofs.*/
+		void set_dirichlet_mask(ConstSmartPtr<vector_type> spMask) {m_spMask = spMask;}
+
+	///	returns the largest eigenvalue of D^{-1}A used in the last init
+		number max_eigenvalue() const {return m_maxEigenvalue;}
+
+	protected:
+	///	Name of preconditioner
+		virtual const char* name() const {return "Chebyshev";}
+
+	///	Preprocess routine
+		virtual bool preprocess(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_preprocess, "algebra Chebyshev");
+
+		//	inverse diagonal
+			m_spJacobi = make_sp(new Jacobi<TAlgebra>(1.0));
+			if(!m_spJacobi->init(SmartPtr<ILinearOperator<vector_type> >(pOp)))
+				return false;
+
+		//	work vectors
+			const matrix_type& A = *pOp;
+#ifdef UG_PARALLEL
+			m_r.set_layouts(A.layouts());
+			m_z.set_layouts(A.layouts());
+			m_p.set_layouts(A.layouts());
+#endif
+			m_r.resize(A.num_rows(), false);
+			m_z.resize(A.num_rows(), false);
+			m_p.resize(A.num_rows(), false);
+
+		//	spectral bound
+			if(m_userMaxEigenvalue > 0.0)
+				m_maxEigenvalue = m_userMaxEigenvalue;
+			else
+				m_maxEigenvalue = estimate_max_eigenvalue(pOp, m_spMask.get());
+
+			if(!(m_maxEigenvalue > 0.0))
+			{
+				UG_LOG("ERROR in 'Chebyshev::preprocess': Estimated largest "
+						"eigenvalue " << m_maxEigenvalue << " is not positive.\n");
+				return false;
+			}
+
+			return true;
+		}
+
+	///	sets the entries of v to zero where the mask is zero
+		static void apply_mask(vector_type& v, const vector_type& mask)
+		{
+			for(size_t i = 0; i < mask.size(); ++i)
+				for(size_t alpha = 0; alpha < GetSize(mask[i]); ++alpha)
+					if(BlockRef(mask[i], alpha) == 0.0)
+						BlockRef(v[i], alpha) = 0.0;
+		}
+
+	///	scales v to unit norm and returns the norm of src, v = src / |src|
+		static number normalize(vector_type& v, vector_type& src)
+		{
+			const number norm = src.norm();
+			if(norm == 0.0) return norm;
+			VecScaleAssign(v, 1.0 / norm, src);
+#ifdef UG_PARALLEL
+		//	norm() leaves the vector unique, but the operator needs it consistent
+			v.change_storage_type(PST_CONSISTENT);
+#endif
+			return norm;
+		}
+
+	///	estimates the largest eigenvalue of D^{-1}A by a power iteration
+	/**	The dofs with zero entries in the mask (if passed) are excluded from
+	 * the iteration. The work vectors of the smoother are used.*/
+		number estimate_max_eigenvalue(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp,
+		                               const vector_type* pMask)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_estimate, "algebra Chebyshev");
+
+			vector_type& v = m_p;
+			vector_type& w = m_r;
+			vector_type& z = m_z;
+
+		//	random start vector
+			v.set_random(-1.0, 1.0);
+			if(pMask) apply_mask(v, *pMask);
+			if(normalize(v, v) == 0.0) return 0.0;
+
+		//	v := D^{-1}A v / |D^{-1}A v|, the norm converges to the largest eigenvalue
+			number lambda = 0.0;
+			for(size_t k = 0; k < m_powerIter; ++k)
+			{
+				pOp->apply(w, v);
+				if(!m_spJacobi->apply(z, w)) return 0.0;
+				if(pMask) apply_mask(z, *pMask);
+
+				const number lambdaNew = normalize(v, z);
+				if(lambdaNew == 0.0) return lambda;
+
+				const bool bConverged = (k > 0)
+						&& fabs(lambdaNew - lambda) <= m_powerPrecision * lambdaNew;
+				lambda = lambdaNew;
+				if(bConverged) break;
+			}
+
+			return lambda;
+		}
+
+		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_step, "algebra Chebyshev");
+
+		//	smoothed interval [a, b] of the spectrum of D^{-1}A
+			const number b = m_safety * m_maxEigenvalue;
+			const number a = b / m_eigRatio;
+			const number theta = 0.5 * (b + a);
+			const number delta = 0.5 * (b - a);
+			const number sigma = theta / delta;
+			number rho = 1.0 / sigma;
+
+		//	r = d, z = D^{-1} r, p = z / theta, c = p
+			vector_type& r = m_r;
+			vector_type& z = m_z;
+			vector_type& p = m_p;
+
+			VecScaleAssign(r, 1.0, d);
+			if(!m_spJacobi->apply(z, r)) return false;
+			VecScaleAssign(p, 1.0 / theta, z);
+			VecScaleAssign(c, 1.0, p);
+
+		//	three-term recurrence: r -= A p, z = D^{-1} r,
+		//	p = rho_new * rho * p + 2 rho_new / delta * z, c += p
+			for(size_t k = 1; k < m_degree; ++k)
+			{
+				pOp->apply_sub(r, p);
+				if(!m_spJacobi->apply(z, r)) return false;
+
+				const number rhoNew = 1.0 / (2.0 * sigma - rho);
+				VecScaleAdd(p, rhoNew * rho, p, 2.0 * rhoNew / delta, z);
+				VecScaleAdd(c, 1.0, c, 1.0, p);
+				rho = rhoNew;
+			}
+
+			return true;
+		}
+
+	///	Postprocess routine
+		virtual bool postprocess() {return true;}
+
+	protected:
+	///	degree of the polynomial
+		size_t m_degree;
+
+	///	ratio of largest and smallest eigenvalue of the smoothed interval
+		number m_eigRatio;
+
+	///	enlargement of the estimated largest eigenvalue
+		number m_safety;
+
+	///	settings of the power method
+		size_t m_powerIter;
+		number m_powerPrecision;
+
+	///	largest eigenvalue set by user (0 if estimated)
+		number m_userMaxEigenvalue;
+
+	///	largest eigenvalue used
+		number m_maxEigenvalue;
+
+	///	mask of the dofs excluded from the eigenvalue estimate (may be invalid)
+		ConstSmartPtr<vector_type> m_spMask;
+
+	///	inverse diagonal
+		SmartPtr<ILinearIterator<vector_type> > m_spJacobi;
+
+	///	work vectors (residual, preconditioned residual and update)
+		vector_type m_r, m_z, m_p;
+};
+
+} // end namespace ug
+
+#endif // __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__CHEBYSHEV__
@@ -70,6 +70,13 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 		typedef std::vector<size_t> ordering_container_type;
 		typedef IOrderingAlgorithm<TAlgebra, ordering_container_type> ordering_algo_type;
 
+	///	level scheduled triangular matrix type
+		typedef LevelScheduledTriangularMatrix<typename matrix_type::value_type> scheduled_matrix_type;
+
+	///	level scheduled triangular matrix type in reduced precision
+		typedef LevelScheduledTriangularMatrix<typename block_reduced_precision_traits<
+			typename matrix_type::value_type>::type> reduced_matrix_type;
+
 	protected:
 		using base_type::set_debug;
 		using base_type::debug_writer;
@@ -80,13 +87,19 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 		GaussSeidelBase() :
 			m_relax(1.0),
 			m_bConsistentInterfaces(false),
-			m_useOverlap(false) {};
+			m_useOverlap(false),
+			m_bLevelScheduling(false),
+			m_bMulticoloring(false),
+			m_bReducedPrecision(false) {};
 
 	/// clone constructor
 		GaussSeidelBase( const GaussSeidelBase<TAlgebra> &parent )
 			: base_type(parent),
 			  m_bConsistentInterfaces(parent.m_bConsistentInterfaces),
 			  m_useOverlap(parent.m_useOverlap),
+			  m_bLevelScheduling(parent.m_bLevelScheduling),
+			  m_bMulticoloring(parent.m_bMulticoloring),
+			  m_bReducedPrecision(parent.m_bReducedPrecision),
 			  m_spOrderingAlgo(parent.m_spOrderingAlgo)
 		{
 			set_sor_relax(parent.m_relax);
@@ -100,6 +113,34 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 
 		void enable_overlap (bool enable) {m_useOverlap = enable;}
 
+	///	processes independent rows of the sweeps in parallel (threads), same result as sequential
+	/**	The rows are grouped into dependency levels of the triangular parts
+	 * of the matrix (computed in init). Each level is processed in parallel,
+	 * the results are identical to the sequential sweeps.*/
+		void enable_level_scheduling(bool enable)
+		{
+			m_bLevelScheduling = enable;
+			if(enable) m_bMulticoloring = false;
+		}
+
+	///	performs the sweeps in a multicolor ordering of the rows (threads)
+	/**	The rows are colored such that rows of the same color are not coupled,
+	 * the sweeps process the colors one after another and the rows of one
+	 * color in parallel. Note that this changes the ordering and thus the
+	 * results compared to the sequential sweeps.*/
+		void enable_multicoloring(bool enable)
+		{
+			m_bMulticoloring = enable;
+			if(enable) m_bLevelScheduling = false;
+		}
+
+	///	performs the sweeps with a copy of the matrix in reduced precision
+	/**	The matrix is copied (sorted by the level schedule resp. the coloring
+	 * if enabled) in reduced precision (float for scalar algebra), which
+	 * nearly halves the memory traffic of the sweeps. Defects and corrections
+	 * stay in full precision.*/
+		void enable_reduced_precision(bool enable) {m_bReducedPrecision = enable;}
+
 	/// 	sets an ordering algorithm
 		void set_ordering_algorithm(SmartPtr<ordering_algo_type> ordering_algo){
 			m_spOrderingAlgo = ordering_algo;
@@ -151,9 +192,66 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 //			UG_ASSERT(CheckDiagonalInvertible(A), "GS: A has noninvertible diagonal");
 			UG_COND_THROW(CheckDiagonalInvertible(*pA) == false, name() << ": A has noninvertible diagonal");
 
+		//	schedule rows for the parallel sweeps
+			m_lower.clear(); m_upper.clear();
+			m_rLower.clear(); m_rUpper.clear();
+			if(reduced_precision())
+			{
+				init_schedule(*pA, m_rLower, m_rUpper);
+			//	the sweeps only use the reduced copy, release the matrix
+				#ifdef UG_PARALLEL
+				if(pA == &m_A) m_A.clear_and_free();
+				#endif
+			}
+			else if(scheduled())
+				init_schedule(*pA, m_lower, m_upper);
+
 			return true;
 		}
 
+	///	creates the level schedule (or the coloring) of the triangles
+	/**	Without level scheduling and multicoloring (reduced precision only),
+	 * the natural level schedule is used, which gives the sequential sweeps.*/
+		template <typename TScheduled>
+		void init_schedule(const matrix_type &A, TScheduled &lower, TScheduled &upper)
+		{
+			if(m_bMulticoloring)
+			{
+				std::vector<size_t> vColor;
+				const size_t numColors = ComputeMatrixColoring(A, vColor);
+				lower.init_colored(A, true, vColor, numColors);
+				upper.init_colored(A, false, vColor, numColors);
+			}
+			else
+			{
+				lower.init(A, true);
+				upper.init(A, false);
+			}
+		}
+
+	///	returns true if the sweeps use the level scheduled triangles
+		bool scheduled() const {return m_bLevelScheduling || m_bMulticoloring;}
+
+	///	returns true if the sweeps use the triangles in reduced precision
+	/**	This is not the case for block types without a reduced precision
+	 * counterpart and for derived classes that sweep over the matrix.*/
+		bool reduced_precision() const
+		{
+			return m_bReducedPrecision && supports_reduced_precision()
+				&& block_reduced_precision_traits<typename matrix_type::value_type>::is_reduced;
+		}
+
+	///	returns if step() uses the triangles in reduced precision
+		virtual bool supports_reduced_precision() const {return true;}
+
+#ifdef UG_PARALLEL
+	///	number of rows of the sweeps (m_A is released in reduced precision)
+		size_t num_sweep_rows() const
+		{
+			return reduced_precision() ? m_rLower.num_rows() : m_A.num_rows();
+		}
+#endif
+
 	//	Postprocess routine
 		virtual bool postprocess() {return true;}
 
@@ -188,7 +286,7 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 					SmartPtr<vector_type> spDtmp = d.clone();
 					spDtmp->change_storage_type(PST_CONSISTENT);
 
-					THROW_IF_NOT_EQUAL_3(c.size(), spDtmp->size(), m_A.num_rows());
+					THROW_IF_NOT_EQUAL_3(c.size(), spDtmp->size(), num_sweep_rows());
 					step(m_A, c, *spDtmp, m_relax);
 
 					// declare c unique to enforce that only master correction is used
@@ -206,7 +304,7 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 					SmartPtr<vector_type> spDtmp = d.clone();
 					spDtmp->change_storage_type(PST_UNIQUE);
 
-					THROW_IF_NOT_EQUAL_3(c.size(), spDtmp->size(), m_A.num_rows());
+					THROW_IF_NOT_EQUAL_3(c.size(), spDtmp->size(), num_sweep_rows());
 					step(m_A, c, *spDtmp, m_relax);
 					c.set_storage_type(PST_UNIQUE);
 				}
@@ -245,6 +343,16 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 		bool m_bConsistentInterfaces;
 		bool m_useOverlap;
 
+	///	level scheduling / multicoloring of the sweeps
+		bool m_bLevelScheduling;
+		bool m_bMulticoloring;
+		scheduled_matrix_type m_lower;
+		scheduled_matrix_type m_upper;
+
+	///	triangles in reduced precision
+		bool m_bReducedPrecision;
+		reduced_matrix_type m_rLower;
+		reduced_matrix_type m_rUpper;
 
 	/// for ordering algorithms
 		SmartPtr<ordering_algo_type> m_spOrderingAlgo;
@@ -296,7 +404,12 @@ public:
 	//	Stepping routine
 		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
 		{
-			gs_step_LL(A, c, d, relax);
+			if(base_type::reduced_precision())
+				gs_step_LL(base_type::m_rLower, c, d, relax);
+			else if(base_type::scheduled())
+				gs_step_LL(base_type::m_lower, c, d, relax);
+			else
+				gs_step_LL(A, c, d, relax);
 		}
 };
 
@@ -341,7 +454,12 @@ public:
 	//	Stepping routine
 		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
 		{
-			gs_step_UR(A, c, d, relax);
+			if(base_type::reduced_precision())
+				gs_step_UR(base_type::m_rUpper, c, d, relax);
+			else if(base_type::scheduled())
+				gs_step_UR(base_type::m_upper, c, d, relax);
+			else
+				gs_step_UR(A, c, d, relax);
 		}
 };
 
@@ -375,7 +493,12 @@ public:
 	//	Stepping routine
 		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
 		{
-			sgs_step(A, c, d, relax);
+			if(base_type::reduced_precision())
+				sgs_step(base_type::m_rLower, base_type::m_rUpper, c, d, relax);
+			else if(base_type::scheduled())
+				sgs_step(base_type::m_lower, base_type::m_upper, c, d, relax);
+			else
+				sgs_step(A, c, d, relax);
 		}
 };
 
@@ -50,6 +50,8 @@
 #include "lib_algebra/ordering_strategies/algorithms/native_cuthill_mckee.h" // for backward compatibility
 
 #include "lib_algebra/algebra_common/permutation_util.h"
+#include "lib_algebra/algebra_common/sparsematrix_util.h"
+#include "lib_algebra/algebra_common/level_scheduling.h"
 
 namespace ug{
 
@@ -354,6 +356,11 @@ class ILU : public IPreconditioner<TAlgebra>
 			m_bDisablePreprocessing(false),
 			m_useConsistentInterfaces(false),
 			m_useOverlap(false),
+			m_bLevelScheduling(false),
+			m_bReducedPrecision(false),
+			m_bSymbolicReuse(false),
+			m_bSymbolicValid(false),
+			m_patternFingerprint(0),
 			m_spOrderingAlgo(SPNULL),
 			m_bSortIsIdentity(false),
 			m_u(nullptr)
@@ -368,6 +375,11 @@ class ILU : public IPreconditioner<TAlgebra>
 			m_bDisablePreprocessing(parent.m_bDisablePreprocessing),
 			m_useConsistentInterfaces(parent.m_useConsistentInterfaces),
 			m_useOverlap(parent.m_useOverlap),
+			m_bLevelScheduling(parent.m_bLevelScheduling),
+			m_bReducedPrecision(parent.m_bReducedPrecision),
+			m_bSymbolicReuse(parent.m_bSymbolicReuse),
+			m_bSymbolicValid(false),
+			m_patternFingerprint(0),
 			m_spOrderingAlgo(parent.m_spOrderingAlgo),
 			m_bSortIsIdentity(false),
 			m_u(nullptr)
@@ -391,6 +403,7 @@ class ILU : public IPreconditioner<TAlgebra>
 	/// 	sets an ordering algorithm
 		void set_ordering_algorithm(SmartPtr<ordering_algo_type> ordering_algo){
 			m_spOrderingAlgo = ordering_algo;
+			m_bSymbolicValid = false;
 		}
 
 	/// set cuthill-mckee sort on/off
@@ -402,6 +415,7 @@ class ILU : public IPreconditioner<TAlgebra>
 			else{
 				m_spOrderingAlgo = SPNULL;
 			}
+			m_bSymbolicValid = false;
 
 			UG_LOG("\nILU: please use 'set_ordering_algorithm(..)' in the future\n");
 		}
@@ -422,6 +436,26 @@ class ILU : public IPreconditioner<TAlgebra>
 
 		void enable_overlap (bool enable)				{m_useOverlap = enable;}
 
+	///	solves the triangular systems level by level (threads)
+	/**	Independent rows of L and U are processed in parallel. The results are
+	 * identical to the sequential substitution.*/
+		void enable_level_scheduling (bool enable)		{m_bLevelScheduling = enable;}
+
+	///	stores the factors in reduced precision (float for scalar algebra)
+	/**	The factorization is computed in full precision, but L and U are
+	 * stored in reduced precision, which nearly halves the memory traffic of
+	 * the triangular solves. Defects and corrections stay in full precision,
+	 * thus an outer iteration (linear solver or Krylov method) acts as
+	 * iterative refinement and reaches full accuracy.*/
+		void enable_reduced_precision (bool enable)		{m_bReducedPrecision = enable;}
+
+	///	reuses the ordering if the sparsity pattern of the matrix is unchanged
+	/**	The ordering is only recomputed if the pattern fingerprint of the
+	 * matrix differs from the one of the previous preprocess (e.g. for the
+	 * Jacobians of a Newton iteration). Only enable this if the ordering
+	 * algorithm does not depend on the matrix values or the solution.*/
+		void enable_symbolic_reuse (bool enable)		{m_bSymbolicReuse = enable; m_bSymbolicValid = false;}
+
 	protected:
 	//	Name of preconditioner
 		virtual const char* name() const {return "ILU";}
@@ -434,21 +468,34 @@ class ILU : public IPreconditioner<TAlgebra>
 			if (m_useOverlap)
 				UG_THROW ("ILU: Ordering for overlap has not been implemented yet.");
 
-			if (m_u)
-				m_spOrderingAlgo->init(&m_ILU, *m_u);
-			else
-				m_spOrderingAlgo->init(&m_ILU);
+		//	reuse the ordering of the last preprocess if the pattern is unchanged
+			bool bReuse = false;
+			if(m_bSymbolicReuse)
+			{
+				const size_t fingerprint = MatrixPatternFingerprint(m_ILU);
+				bReuse = m_bSymbolicValid && fingerprint == m_patternFingerprint;
+				m_patternFingerprint = fingerprint;
+			}
 
-			m_spOrderingAlgo->compute();
-			m_ordering = m_spOrderingAlgo->ordering();
+			if(!bReuse)
+			{
+				if (m_u)
+					m_spOrderingAlgo->init(&m_ILU, *m_u);
+				else
+					m_spOrderingAlgo->init(&m_ILU);
+
+				m_spOrderingAlgo->compute();
+				m_ordering = m_spOrderingAlgo->ordering();
 
-			m_bSortIsIdentity = GetInversePermutation(m_ordering, m_old_ordering);
+				m_bSortIsIdentity = GetInversePermutation(m_ordering, m_old_ordering);
+				m_bSymbolicValid = m_bSymbolicReuse;
+			}
 
 			if (!m_bSortIsIdentity)
 			{
 				matrix_type tmp;
 				tmp = m_ILU;
-				SetMatrixAsPermutation(m_ILU, tmp, m_ordering);
+				SetMatrixAsPermutation(m_ILU, tmp, m_ordering, m_old_ordering);
 			}
 		}
 
@@ -565,6 +612,30 @@ class ILU : public IPreconditioner<TAlgebra>
 			else FactorizeILU(m_ILU);
 			m_ILU.defragment();
 
+		//	schedule the rows of the triangular solves
+			if(m_bLevelScheduling && !use_reduced_precision())
+			{
+				m_L.init(m_ILU, true);
+				m_U.init(m_ILU, false);
+			}
+			else
+			{
+				m_L.clear();
+				m_U.clear();
+			}
+
+		//	copy of the factors in reduced precision
+			if(use_reduced_precision())
+			{
+				m_rL.init(m_ILU, true);
+				m_rU.init(m_ILU, false);
+			}
+			else
+			{
+				m_rL.clear();
+				m_rU.clear();
+			}
+
 		//	Debug output of matrices
 			#ifdef UG_PARALLEL
 			write_overlap_debug(m_ILU, "ILU_prep_04_A_AfterFactorize");
@@ -572,20 +643,47 @@ class ILU : public IPreconditioner<TAlgebra>
 			write_debug(m_ILU, "ILU_PreProcess_U_AfterFactor");
 			#endif
 
+		//	the solves only use the reduced copy, release the factors
+			if(use_reduced_precision())
+				m_ILU.clear_and_free();
+
 		//	we're done
 			return true;
 		}
 
 
+	///	returns if a reduced precision copy is used (not for block types without one)
+		bool use_reduced_precision() const
+		{
+			return m_bReducedPrecision && block_reduced_precision_traits<
+				typename matrix_type::value_type>::is_reduced;
+		}
+
+	//	solve x = L^-1 b
+		bool invert_L(vector_type &x, const vector_type &b)
+		{
+			if(use_reduced_precision()) return m_rL.apply(x, b, 1.0, true);
+			else if(m_bLevelScheduling) return m_L.apply(x, b, 1.0, true);
+			else return ug::invert_L(m_ILU, x, b);
+		}
+
+	//	solve x = U^-1 b
+		bool invert_U(vector_type &x, const vector_type &b)
+		{
+			if(use_reduced_precision()) return m_rU.apply(x, b, 1.0, false, m_invEps);
+			else if(m_bLevelScheduling) return m_U.apply(x, b, 1.0, false, m_invEps);
+			else return ug::invert_U(m_ILU, x, b, m_invEps);
+		}
+
 		void applyLU(vector_type &c, const vector_type &d, vector_type &tmp)
 		{
 
 			if(m_spOrderingAlgo.invalid() || m_bSortIsIdentity)
 			{
 				// 	apply iterator: c = LU^{-1}*d
-				if(! invert_L(m_ILU, tmp, d)) // h := L^-1 d
+				if(! invert_L(tmp, d)) // h := L^-1 d
 					print_debugger_message("ILU: There were issues at inverting L\n");
-				if(! invert_U(m_ILU, c, tmp, m_invEps)) // c := U^-1 h = (LU)^-1 d
+				if(! invert_U(c, tmp)) // c := U^-1 h = (LU)^-1 d
 					print_debugger_message("ILU: There were issues at inverting U\n");
 			}
 ///*
@@ -593,9 +691,9 @@ class ILU : public IPreconditioner<TAlgebra>
 			{
 				// we save one vector here by renaming
 				SetVectorAsPermutation(tmp, d, m_ordering);
-				if(! invert_L(m_ILU, c, tmp)) // c = L^{-1} d
+				if(! invert_L(c, tmp)) // c = L^{-1} d
 					print_debugger_message("ILU: There were issues at inverting L (after permutation)\n");
-				if(! invert_U(m_ILU, tmp, c, m_invEps)) // tmp = (LU)^{-1} d
+				if(! invert_U(tmp, c)) // tmp = (LU)^{-1} d
 					print_debugger_message("ILU: There were issues at inverting U (after permutation)\n");
 				SetVectorAsPermutation(c, tmp, m_old_ordering);
 			}
@@ -717,6 +815,20 @@ class ILU : public IPreconditioner<TAlgebra>
 		bool m_useConsistentInterfaces;
 		bool m_useOverlap;
 
+	///	level scheduled triangular factors
+		bool m_bLevelScheduling;
+		LevelScheduledTriangularMatrix<typename matrix_type::value_type> m_L, m_U;
+
+	///	factors stored in reduced precision
+		bool m_bReducedPrecision;
+		LevelScheduledTriangularMatrix<typename block_reduced_precision_traits<
+			typename matrix_type::value_type>::type> m_rL, m_rU;
+
+	///	reuse of the ordering for unchanged sparsity patterns
+		bool m_bSymbolicReuse;
+		bool m_bSymbolicValid;
+		size_t m_patternFingerprint;
+
 	/// for ordering algorithms
 		SmartPtr<ordering_algo_type> m_spOrderingAlgo;
 		ordering_container_type m_ordering, m_old_ordering;
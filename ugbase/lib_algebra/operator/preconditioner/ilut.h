@@ -17,6 +17,8 @@
 #include "lib_algebra/ordering_strategies/algorithms/native_cuthill_mckee.h" // for backward compatibility
 
 #include "lib_algebra/algebra_common/permutation_util.h"
+#include "lib_algebra/algebra_common/sparsematrix_util.h"
+#include "lib_algebra/algebra_common/level_scheduling.h"
 
 namespace ug{
 
@@ -58,7 +60,9 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 	public:
 	///	Constructor
 		ILUTPreconditioner(double eps=1e-6)
-			: m_eps(eps), m_info(false), m_show_progress(true), m_bSortIsIdentity(false)
+			: m_eps(eps), m_bReducedPrecision(false), m_info(false), m_show_progress(true),
+			  m_bSymbolicReuse(false), m_bSymbolicValid(false), m_patternFingerprint(0),
+			  m_bSortIsIdentity(false), m_u(nullptr)
 		{
 			//default was set true
 			m_spOrderingAlgo = make_sp(new NativeCuthillMcKeeOrdering<TAlgebra, ordering_container_type>());
@@ -70,7 +74,13 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 		{
 			m_eps = parent.m_eps;
 			set_info(parent.m_info);
+			m_show_progress = parent.m_show_progress;
+			m_bReducedPrecision = parent.m_bReducedPrecision;
+			m_bSymbolicReuse = parent.m_bSymbolicReuse;
+			m_bSymbolicValid = false;
+			m_patternFingerprint = 0;
 			m_bSortIsIdentity = parent.m_bSortIsIdentity;
+			m_u = nullptr;
 		}
 
 	///	Clone
@@ -91,6 +101,7 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 		void set_threshold(number thresh)
 		{
 			m_eps = thresh;
+			m_bSymbolicValid = false;
 		}
 		
 	///	sets storage information output to true or false
@@ -116,6 +127,7 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 	/// 	sets an ordering algorithm
 		void set_ordering_algorithm(SmartPtr<ordering_algo_type> ordering_algo){
 			m_spOrderingAlgo = ordering_algo;
+			m_bSymbolicValid = false;
 		}
 
 	/// set cuthill-mckee sort on/off
@@ -127,10 +139,32 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			else{
 				m_spOrderingAlgo = SPNULL;
 			}
+			m_bSymbolicValid = false;
 
 			UG_LOG("\nILUT: please use 'set_ordering_algorithm(..)' in the future\n");
 		}
 
+	///	reuses ordering and pattern of L and U if the matrix pattern is unchanged
+	/**	If the pattern fingerprint of the matrix equals the one of the previous
+	 * preprocess (e.g. for the Jacobians of a Newton iteration), the ordering
+	 * is not recomputed and only the values of L and U are recomputed on the
+	 * pattern of the previous threshold factorization. Only enable this if the
+	 * ordering algorithm does not depend on the matrix values or the solution.*/
+		void enable_symbolic_reuse(bool enable)
+		{
+			m_bSymbolicReuse = enable;
+			m_bSymbolicValid = false;
+		}
+
+	///	stores the factors in reduced precision (float for scalar algebra)
+	/**	L and U are computed in full precision, but the triangular solves use
+	 * a copy in reduced precision with half the memory traffic. The outer
+	 * iteration works on full precision defects (iterative refinement).*/
+		void enable_reduced_precision(bool enable)
+		{
+			m_bReducedPrecision = enable;
+		}
+
 
 	protected:
 	//	Name of preconditioner
@@ -244,7 +278,17 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			matrix_type* A;
 			matrix_type permA;
 
-			if(m_spOrderingAlgo.valid()){
+		//	reuse ordering and pattern of L/U of the last preprocess if possible
+			bool bReuse = false;
+			if(m_bSymbolicReuse)
+			{
+				const size_t fingerprint = MatrixPatternFingerprint(mat);
+				bReuse = m_bSymbolicValid && fingerprint == m_patternFingerprint
+						&& mat.num_rows() == m_U.num_rows();
+				m_patternFingerprint = fingerprint;
+			}
+
+			if(m_spOrderingAlgo.valid() && !bReuse){
 				if(m_u){
 					m_spOrderingAlgo->init(&mat, *m_u);
 				}
@@ -255,13 +299,16 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 
 			if(m_spOrderingAlgo.valid())
 			{
-				m_spOrderingAlgo->compute();
-				m_ordering = m_spOrderingAlgo->ordering();
+				if(!bReuse)
+				{
+					m_spOrderingAlgo->compute();
+					m_ordering = m_spOrderingAlgo->ordering();
 
-				m_bSortIsIdentity = GetInversePermutation(m_ordering, m_old_ordering);
+					m_bSortIsIdentity = GetInversePermutation(m_ordering, m_old_ordering);
+				}
 
 				if(!m_bSortIsIdentity){
-					SetMatrixAsPermutation(permA, mat, m_ordering);
+					SetMatrixAsPermutation(permA, mat, m_ordering, m_old_ordering);
 					A = &permA;
 				}
 				else{
@@ -273,6 +320,21 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 				A = &mat;
 			}
 
+			if(bReuse)
+			{
+				if(refactorize_numeric(*A))
+				{
+					init_reduced_precision();
+					return true;
+				}
+
+			//	the elimination on the old pattern broke down or A is not
+			//	contained in it: full preprocess, including the ordering
+				m_bSymbolicValid = false;
+				return preprocess_mat2(mat);
+			}
+			m_bSymbolicValid = m_bSymbolicReuse;
+
 			m_L.resize_and_clear(A->num_rows(), A->num_cols());
 			m_U.resize_and_clear(A->num_rows(), A->num_cols());
 
@@ -397,6 +459,8 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 				m_U.defragment();
 			}
 
+			init_reduced_precision();
+
 			if (m_info==true)
 			{
 				m_L.print("L");
@@ -420,6 +484,117 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			return true;
 		}
 
+	///	recomputes the values of L and U on their current pattern
+	/**	Same elimination as in preprocess_mat2, but fill-in outside the pattern
+	 * of L and U is dropped instead of being checked against the threshold.
+	 * The pattern of A has to be contained in the pattern of L+U, which holds
+	 * if A has the pattern used for the last threshold factorization.
+	 * \return false if A is not contained in the pattern of L+U or if a
+	 * 			multiplier is not finite or too big*/
+		bool refactorize_numeric(const matrix_type &A)
+		{
+			PROFILE_BEGIN_GROUP(ILUT_refactorize_numeric, "ilut algebra");
+			if(A.num_rows() != m_U.num_rows())
+			{
+				UG_LOG("ILUT: size of matrix changed, refactorizing.\n");
+				return false;
+			}
+
+			std::vector<matrix_connection> con;
+			con.reserve(300);
+			block_type zero;
+			zero = 0.0;
+
+			for(size_t i=0; i<A.num_rows(); i++)
+			{
+				// get the pattern of L(i, .) and U(i, .) into con
+				con.resize(0);
+				for(matrix_row_iterator it = m_L.begin_row(i); it != m_L.end_row(i); ++it)
+					con.push_back(matrix_connection(it.index(), zero));
+				const size_t u_part = con.size();
+				for(matrix_row_iterator it = m_U.begin_row(i); it != m_U.end_row(i); ++it)
+					con.push_back(matrix_connection(it.index(), zero));
+
+				// get the row A(i, .) into con
+				size_t j = 0;
+				for(const_matrix_row_iterator a_it = A.begin_row(i); a_it != A.end_row(i); ++a_it)
+				{
+					while(j < con.size() && con[j].iIndex < a_it.index()) ++j;
+					if(j == con.size() || con[j].iIndex != a_it.index())
+					{
+						UG_LOG("ILUT: A(" << i << ", " << a_it.index() << ") not in "
+								"pattern of L+U, refactorizing.\n");
+						return false;
+					}
+					con[j].dValue = a_it.value();
+				}
+
+				// eliminate all entries A(i, k) with k<i with rows U(k, .)
+				for(size_t i_it = 0; i_it < u_part; ++i_it)
+				{
+					if(con[i_it].dValue == 0.0) continue;
+					size_t k = con[i_it].iIndex;
+					block_type &ukk = m_U.begin_row(k).value();
+
+					con[i_it].dValue = con[i_it].dValue / ukk;
+					block_type d = con[i_it].dValue;
+					if(!BlockMatrixFiniteAndNotTooBig(d, 1e40))
+					{
+						UG_LOG("ILUT: breakdown on reused pattern in row " << i << ", refactorizing.\n");
+						return false;
+					}
+
+					matrix_row_iterator k_it = m_U.begin_row(k);
+					++k_it; // skip diag
+					j = i_it+1;
+					while(k_it != m_U.end_row(k) && j < con.size())
+					{
+						if(k_it.index() == con[j].iIndex)
+						{
+							con[j].dValue -= k_it.value() * d;
+							++k_it;	++j;
+						}
+						else if(k_it.index() < con[j].iIndex)
+							++k_it; // not in pattern: dropped
+						else
+							++j;
+					}
+				}
+
+				// write back values of L and U
+				j = 0;
+				for(matrix_row_iterator it = m_L.begin_row(i); it != m_L.end_row(i); ++it)
+					it.value() = con[j++].dValue;
+				for(matrix_row_iterator it = m_U.begin_row(i); it != m_U.end_row(i); ++it)
+					it.value() = con[j++].dValue;
+			}
+			return true;
+		}
+
+	///	returns if a reduced precision copy is used (not for block types without one)
+		bool use_reduced_precision() const
+		{
+			return m_bReducedPrecision
+				&& block_reduced_precision_traits<block_type>::is_reduced;
+		}
+
+	///	copies L and U into reduced precision, if enabled
+	/**	L and U are kept in full precision, since the symbolic reuse
+	 * refactorizes on their pattern.*/
+		void init_reduced_precision()
+		{
+			if(use_reduced_precision())
+			{
+				m_rL.init(m_L, true);
+				m_rU.init(m_U, false);
+			}
+			else
+			{
+				m_rL.clear();
+				m_rU.clear();
+			}
+		}
+
 	//	Stepping routine
 		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)
 		{
@@ -459,6 +634,13 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 		virtual bool applyLU(vector_type& c, const vector_type& d)
 		{
 			PROFILE_BEGIN_GROUP(ILUT_step, "ilut algebra");
+			if(use_reduced_precision())
+			{
+				// L has unit diagonal, U is solved in place
+				if(!m_rL.apply(c, d, 1.0, true)) return false;
+				return m_rU.apply(c, c, 1.0, false);
+			}
+
 			// apply iterator: c = LU^{-1}*d (damp is not used)
 			// L
 			for(size_t i=0; i < m_L.num_rows(); i++)
@@ -616,6 +798,11 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 		matrix_type m_L;
 		matrix_type m_U;
 		double m_eps;
+
+	///	L and U stored in reduced precision
+		bool m_bReducedPrecision;
+		LevelScheduledTriangularMatrix<typename block_reduced_precision_traits<block_type>::type> m_rL, m_rU;
+
 		bool m_info;
 		bool m_show_progress;
 		static const number m_small;
@@ -625,6 +812,11 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 		SmartPtr<ordering_algo_type> m_spOrderingAlgo;
 		ordering_container_type m_ordering, m_old_ordering;
 
+	///	reuse of ordering and pattern for unchanged sparsity patterns
+		bool m_bSymbolicReuse;
+		bool m_bSymbolicValid;
+		size_t m_patternFingerprint;
+
 		bool m_bSortIsIdentity;
 
 		const vector_type* m_u;
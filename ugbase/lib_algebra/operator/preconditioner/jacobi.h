@@ -114,16 +114,17 @@ class Jacobi : public IPreconditioner<TAlgebra>
 
 	public:
 	///	default constructor
-		Jacobi() {this->set_damp(1.0); m_bBlock = true;};
+		Jacobi() {this->set_damp(1.0); m_bBlock = true; m_bReducedPrecision = false;};
 
 	///	constructor setting the damping parameter
-		Jacobi(number damp) {this->set_damp(damp); m_bBlock = true;};
+		Jacobi(number damp) {this->set_damp(damp); m_bBlock = true; m_bReducedPrecision = false;};
 
 	/// clone constructor
 		Jacobi( const Jacobi<TAlgebra> &parent )
 			: base_type(parent)
 		{
 			set_block(parent.m_bBlock);
+			enable_reduced_precision(parent.m_bReducedPrecision);
 		}
 
 	///	Clone
@@ -147,10 +148,23 @@ class Jacobi : public IPreconditioner<TAlgebra>
 			m_bBlock = b;
 		}
 
+	/// sets if the inverse diagonal is stored in reduced precision (float for scalar algebra)
+		void enable_reduced_precision(bool b)
+		{
+			m_bReducedPrecision = b;
+		}
+
 	protected:
 	///	Name of preconditioner
 		virtual const char* name() const {return "Jacobi";}
 
+	///	returns if a reduced precision copy is used (not for block types without one)
+		bool use_reduced_precision() const
+		{
+			return m_bReducedPrecision
+				&& block_reduced_precision_traits<inverse_type>::is_reduced;
+		}
+
 	///	Preprocess routine
 		virtual bool preprocess(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp)
 		{
@@ -191,6 +205,9 @@ class Jacobi : public IPreconditioner<TAlgebra>
 					return false;
 //			UG_ASSERT(CheckVectorInvertible(diag), "Jacobi: A has noninvertible diagonal");
 
+		//	mark interface dofs for the overlapped step (in every init, since the
+		//	layouts may have been rebuilt in place, e.g. by redistribution)
+			mark_interface(mat.layouts(), size);
 #endif
 
 //	get damping in constant case to damp at once
@@ -215,6 +232,17 @@ class Jacobi : public IPreconditioner<TAlgebra>
 				GetInverse(m_diagInv[i], m);
 			}
 
+		//	copy of the inverse diagonal in reduced precision
+			if(use_reduced_precision())
+			{
+				m_diagInvReduced.resize(m_diagInv.size());
+				for(size_t i = 0; i < m_diagInv.size(); ++i)
+					m_diagInvReduced[i] = m_diagInv[i];
+				std::vector<inverse_type>().swap(m_diagInv);
+			}
+			else
+				std::vector<reduced_inverse_type>().swap(m_diagInvReduced);
+
 		//	done
 			return true;
 		}
@@ -223,13 +251,31 @@ class Jacobi : public IPreconditioner<TAlgebra>
 		{
 			PROFILE_BEGIN_GROUP(Jacobi_step, "algebra Jacobi");
 
-		// 	multiply defect with diagonal, c = damp * D^{-1} * d
-		//	note, that the damping is already included in the inverse diagonal
-			for(size_t i = 0; i < m_diagInv.size(); ++i)
+#ifdef UG_PARALLEL
+		//	interface dofs first, the inner dofs overlap with the communication.
+		//	With overlap, change_storage_type must update the overlap dofs, too.
+			if(c.layouts() == m_spMarkedLayouts && m_vbInterface.size() == c.size()
+				&& !c.layouts()->overlap_enabled())
 			{
-			// 	c[i] = m_diagInv[i] * d[i];
-				MatMult(c[i], 1.0, m_diagInv[i], d[i]);
+				if(use_reduced_precision())
+					step_overlapped(c, d, m_diagInvReduced);
+				else
+					step_overlapped(c, d, m_diagInv);
+				return true;
 			}
+#endif
+
+		// 	multiply defect with diagonal, c = damp * D^{-1} * d
+		//	note, that the damping is already included in the inverse diagonal
+			if(use_reduced_precision())
+				for(size_t i = 0; i < m_diagInvReduced.size(); ++i)
+					MatMult(c[i], 1.0, m_diagInvReduced[i], d[i]);
+			else
+				for(size_t i = 0; i < m_diagInv.size(); ++i)
+				{
+				// 	c[i] = m_diagInv[i] * d[i];
+					MatMult(c[i], 1.0, m_diagInv[i], d[i]);
+				}
 
 #ifdef UG_PARALLEL
 
@@ -248,6 +294,74 @@ class Jacobi : public IPreconditioner<TAlgebra>
 			return true;
 		}
 
+#ifdef UG_PARALLEL
+	///	marks the dofs in the master and slave interfaces of the layouts
+		void mark_interface(ConstSmartPtr<AlgebraLayouts> spLayouts, size_t size)
+		{
+			m_vbInterface.clear(); m_vbInterface.resize(size, false);
+			m_vInterfaceIndex.clear();
+			const IndexLayout* vLayout[2] = {&spLayouts->master(), &spLayouts->slave()};
+			for(int l = 0; l < 2; ++l)
+				for(IndexLayout::const_iterator iter = vLayout[l]->begin();
+					iter != vLayout[l]->end(); ++iter)
+				{
+					const IndexLayout::Interface& interface = vLayout[l]->interface(iter);
+					for(IndexLayout::Interface::const_iterator iIter = interface.begin();
+						iIter != interface.end(); ++iIter)
+					{
+						const size_t index = interface.get_element(iIter);
+						if(!m_vbInterface[index]) m_vInterfaceIndex.push_back(index);
+						m_vbInterface[index] = true;
+					}
+				}
+			m_spMarkedLayouts = spLayouts;
+		}
+
+	///	computes c = damp * D^{-1} * d and makes it consistent
+	/**
+	 * The additive correction is first computed on the interface dofs. Then
+	 * the (non-blocking) exchange of the slave values is started and the
+	 * correction on the inner dofs is computed, while the messages are in
+	 * transit. Finally, the master values are copied to the slaves. The result
+	 * is identical to computing c everywhere followed by AdditiveToConsistent.
+	 */
+		template <typename TInverse>
+		void step_overlapped(vector_type& c, const vector_type& d,
+		                     const std::vector<TInverse>& vDiagInv)
+		{
+			const IndexLayout& masterLayout = c.layouts()->master();
+			const IndexLayout& slaveLayout = c.layouts()->slave();
+			pcl::InterfaceCommunicator<IndexLayout>& com = c.layouts()->comm();
+
+		//	interface dofs, then send the slave values to the masters
+			for(size_t k = 0; k < m_vInterfaceIndex.size(); ++k)
+			{
+				const size_t i = m_vInterfaceIndex[k];
+				MatMult(c[i], 1.0, vDiagInv[i], d[i]);
+			}
+
+			ComPol_VecAdd<vector_type> cpVecAdd(&c);
+			com.send_data(slaveLayout, cpVecAdd);
+			com.receive_data(masterLayout, cpVecAdd);
+			com.communicate_and_resume();
+
+		//	inner dofs
+			for(size_t i = 0; i < vDiagInv.size(); ++i)
+				if(!m_vbInterface[i])
+					MatMult(c[i], 1.0, vDiagInv[i], d[i]);
+
+			com.wait();
+
+		//	copy master values to the slaves
+			ComPol_VecCopy<vector_type> cpVecCopy(&c);
+			com.send_data(masterLayout, cpVecCopy);
+			com.receive_data(slaveLayout, cpVecCopy);
+			com.communicate();
+
+			c.set_storage_type(PST_CONSISTENT);
+		}
+#endif
+
 	///	Postprocess routine
 		virtual bool postprocess() {return true;}
 
@@ -303,10 +417,26 @@ class Jacobi : public IPreconditioner<TAlgebra>
 	///	type of block-inverse
 		typedef typename block_traits<typename matrix_type::value_type>::inverse_type inverse_type;
 
+	///	type of block-inverse in reduced precision
+		typedef typename block_reduced_precision_traits<inverse_type>::type reduced_inverse_type;
+
 	///	storage of the inverse diagonal in parallel
 		std::vector<inverse_type> m_diagInv;
 		bool m_bBlock;
 
+	///	storage of the inverse diagonal in reduced precision
+		std::vector<reduced_inverse_type> m_diagInvReduced;
+		bool m_bReducedPrecision;
+
+#ifdef UG_PARALLEL
+	///	interface dofs (master or slave) of the layouts m_spMarkedLayouts (set in preprocess)
+	/// \{
+		std::vector<bool> m_vbInterface;
+		std::vector<size_t> m_vInterfaceIndex;
+		ConstSmartPtr<AlgebraLayouts> m_spMarkedLayouts;
+	/// \}
+#endif
+
 
 };
 
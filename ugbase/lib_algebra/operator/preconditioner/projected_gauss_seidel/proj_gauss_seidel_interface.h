@@ -137,6 +137,9 @@ class IProjGaussSeidel:
 	 */
 		virtual void step(const matrix_type& mat, vector_type& c, const vector_type& d, const number relax) = 0;
 
+	///	the projected sweeps run over the matrix, not over a reduced precision copy
+		virtual bool supports_reduced_precision() const {return false;}
+
 	///	projects the correction on the underlying constraints set by the obstacleConstraints
 		void project_correction(value_type& c_i, const size_t i);
 
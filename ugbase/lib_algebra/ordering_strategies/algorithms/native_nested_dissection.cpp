@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include "common/common.h"
+#include "common/profiler/profiler.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "native_nested_dissection.h"
+
+namespace ug{
+
+namespace{
+
+/// symmetric adjacency graph (compressed rows), restricted to the active subset
+struct NDGraph
+{
+	std::vector<size_t> vStart, vAdj;
+	std::vector<size_t> vSubset;	///< id of the subset a vertex belongs to
+	std::vector<size_t> vLevel;		///< BFS level, (size_t)-1 if not visited
+
+///	BFS from root inside subset id, returns vertices in BFS order
+	void bfs(size_t root, size_t id, std::vector<size_t> &vOrder, size_t &numLevels)
+	{
+		vOrder.clear();
+		vOrder.push_back(root);
+		vLevel[root] = 0;
+		numLevels = 1;
+		for(size_t k=0; k<vOrder.size(); k++)
+		{
+			const size_t v = vOrder[k];
+			for(size_t e=vStart[v]; e<vStart[v+1]; e++)
+			{
+				const size_t w = vAdj[e];
+				if(vSubset[w] != id || vLevel[w] != (size_t)-1) continue;
+				vLevel[w] = vLevel[v]+1;
+				numLevels = std::max(numLevels, vLevel[w]+1);
+				vOrder.push_back(w);
+			}
+		}
+	}
+
+///	resets the levels of the vertices
+	void reset(const std::vector<size_t> &vOrder)
+	{
+		for(size_t k=0; k<vOrder.size(); k++) vLevel[vOrder[k]] = (size_t)-1;
+	}
+};
+
+/// a subset of vertices, to be numbered with the indices begin, begin+1, ...
+struct NDSubset
+{
+	std::vector<size_t> vVertex;
+	size_t begin;
+};
+
+} // end anonymous namespace
+
+
+void ComputeNestedDissectionOrder(std::vector<size_t>& vNewIndex,
+                                  const std::vector<std::vector<size_t> >& vvNeighbour,
+                                  size_t leafSize)
+{
+	PROFILE_FUNC();
+	const size_t n = vvNeighbour.size();
+	const size_t invalid = (size_t)-1;
+	leafSize = std::max(leafSize, (size_t)1);
+
+//	symmetrize the graph and remove the diagonal
+	NDGraph g;
+	g.vStart.assign(n+1, 0);
+	for(size_t i=0; i<n; i++)
+		for(size_t k=0; k<vvNeighbour[i].size(); k++)
+		{
+			const size_t j = vvNeighbour[i][k];
+			if(j == i || j >= n) continue;
+			g.vStart[i+1]++; g.vStart[j+1]++;
+		}
+	for(size_t i=0; i<n; i++) g.vStart[i+1] += g.vStart[i];
+	g.vAdj.resize(g.vStart[n]);
+	{
+		std::vector<size_t> vPos(g.vStart.begin(), g.vStart.end()-1);
+		for(size_t i=0; i<n; i++)
+			for(size_t k=0; k<vvNeighbour[i].size(); k++)
+			{
+				const size_t j = vvNeighbour[i][k];
+				if(j == i || j >= n) continue;
+				g.vAdj[vPos[i]++] = j; g.vAdj[vPos[j]++] = i;
+			}
+	}
+	g.vSubset.assign(n, 0);
+	g.vLevel.assign(n, invalid);
+
+	vNewIndex.assign(n, invalid);
+
+	std::vector<NDSubset> vStack(1);
+	vStack[0].begin = 0;
+	vStack[0].vVertex.resize(n);
+	for(size_t i=0; i<n; i++) vStack[0].vVertex[i] = i;
+	size_t nextId = 1;
+
+	std::vector<size_t> vOrder, vOrder2;
+	while(!vStack.empty())
+	{
+		NDSubset S;
+		S.vVertex.swap(vStack.back().vVertex);
+		S.begin = vStack.back().begin;
+		vStack.pop_back();
+		const size_t id = nextId++;
+		for(size_t k=0; k<S.vVertex.size(); k++) g.vSubset[S.vVertex[k]] = id;
+
+	//	small subsets are numbered directly
+		if(S.vVertex.size() <= leafSize)
+		{
+			for(size_t k=0; k<S.vVertex.size(); k++)
+				vNewIndex[S.vVertex[k]] = S.begin + k;
+			continue;
+		}
+
+	//	pseudo-peripheral vertex: repeated BFS from the last vertex found
+		size_t root = S.vVertex[0], numLevels = 0;
+		g.bfs(root, id, vOrder, numLevels);
+		for(int sweep=0; sweep<4; sweep++)
+		{
+			const size_t cand = vOrder.back();
+			size_t candLevels;
+			g.reset(vOrder);
+			g.bfs(cand, id, vOrder2, candLevels);
+			if(candLevels <= numLevels)
+			{
+				g.reset(vOrder2);
+				g.bfs(root, id, vOrder, numLevels);
+				break;
+			}
+			root = cand; numLevels = candLevels;
+			vOrder.swap(vOrder2);
+		}
+
+	//	subset not connected: split off the component of root
+		if(vOrder.size() < S.vVertex.size())
+		{
+			NDSubset R;
+			R.begin = S.begin + vOrder.size();
+			for(size_t k=0; k<S.vVertex.size(); k++)
+				if(g.vLevel[S.vVertex[k]] == invalid)
+					R.vVertex.push_back(S.vVertex[k]);
+			NDSubset C;
+			C.begin = S.begin;
+			C.vVertex = vOrder;
+			g.reset(vOrder);
+			vStack.push_back(NDSubset()); vStack.back().begin = R.begin; vStack.back().vVertex.swap(R.vVertex);
+			vStack.push_back(NDSubset()); vStack.back().begin = C.begin; vStack.back().vVertex.swap(C.vVertex);
+			continue;
+		}
+
+	//	no separator possible (e.g. clique): number directly
+		if(numLevels < 3)
+		{
+			for(size_t k=0; k<vOrder.size(); k++)
+				vNewIndex[vOrder[k]] = S.begin + k;
+			g.reset(vOrder);
+			continue;
+		}
+
+	//	separator: level in the middle of the vertices (in BFS order), but
+	//	neither the first nor the last level
+		size_t sepLevel = g.vLevel[vOrder[vOrder.size()/2]];
+		sepLevel = std::max(sepLevel, (size_t)1);
+		sepLevel = std::min(sepLevel, numLevels-2);
+
+	//	only vertices of the separator level coupled to the next level separate
+		NDSubset A, B;
+		std::vector<size_t> vSep;
+		for(size_t k=0; k<vOrder.size(); k++)
+		{
+			const size_t v = vOrder[k], l = g.vLevel[v];
+			if(l < sepLevel) A.vVertex.push_back(v);
+			else if(l > sepLevel) B.vVertex.push_back(v);
+			else
+			{
+				bool bCoupled = false;
+				for(size_t e=g.vStart[v]; e<g.vStart[v+1] && !bCoupled; e++)
+					bCoupled = (g.vSubset[g.vAdj[e]] == id && g.vLevel[g.vAdj[e]] == l+1);
+				if(bCoupled) vSep.push_back(v);
+				else A.vVertex.push_back(v);
+			}
+		}
+		g.reset(vOrder);
+
+	//	parts first, separator last
+		A.begin = S.begin;
+		B.begin = S.begin + A.vVertex.size();
+		const size_t sepBegin = B.begin + B.vVertex.size();
+		for(size_t k=0; k<vSep.size(); k++)
+			vNewIndex[vSep[k]] = sepBegin + k;
+		for(size_t k=0; k<vSep.size(); k++) g.vSubset[vSep[k]] = 0;
+
+		vStack.push_back(NDSubset()); vStack.back().begin = B.begin; vStack.back().vVertex.swap(B.vVertex);
+		vStack.push_back(NDSubset()); vStack.back().begin = A.begin; vStack.back().vVertex.swap(A.vVertex);
+	}
+}
+
+} // end namespace ug
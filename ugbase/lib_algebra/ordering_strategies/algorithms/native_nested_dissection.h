@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __UG__LIB_ALGEBRA__ORDERING_STRATEGIES_ALGORITHMS_NATIVE_NESTED_DISSECTION_ORDERING__
+#define __UG__LIB_ALGEBRA__ORDERING_STRATEGIES_ALGORITHMS_NATIVE_NESTED_DISSECTION_ORDERING__
+
+#include <vector>
+
+#include "IOrderingAlgorithm.h"
+#include "util.cpp"
+
+//debug
+#include "common/error.h"
+#include "common/log.h"
+
+namespace ug{
+
+/// computes a nested dissection ordering of an index graph
+/**
+ * The graph is recursively split by level set separators: a BFS is started
+ * from a pseudo-peripheral vertex and the vertices of the middle level which
+ * are coupled to the next level form the separator. The two parts are ordered
+ * first, the separator last. Parts with at most leafSize vertices are not
+ * split further. This is a fill reducing ordering for direct solvers.
+ *
+ * The adjacency does not have to be symmetric, the ordering is computed for
+ * the symmetrized graph. On exit, vNewIndex[oldInd] = newInd.
+ *
+ * \param[out]	vNewIndex		vector returning new index for old index
+ * \param[in]	vvNeighbour		vector of adjacent indices for each index
+ * \param[in]	leafSize		size of the subgraphs that are not split anymore
+ */
+void ComputeNestedDissectionOrder(std::vector<size_t>& vNewIndex,
+                                  const std::vector<std::vector<size_t> >& vvNeighbour,
+                                  size_t leafSize = 64);
+
+
+template <typename TAlgebra, typename O_t>
+class NativeNestedDissectionOrdering : public IOrderingAlgorithm<TAlgebra, O_t>
+{
+public:
+	typedef typename TAlgebra::matrix_type M_t;
+	typedef typename TAlgebra::vector_type V_t;
+	typedef IOrderingAlgorithm<TAlgebra, O_t> baseclass;
+
+	NativeNestedDissectionOrdering() : m(NULL), m_leafSize(64) {}
+
+	/// clone constructor
+	NativeNestedDissectionOrdering( const NativeNestedDissectionOrdering<TAlgebra, O_t> &parent )
+			: baseclass(), m(NULL), m_leafSize(parent.m_leafSize){}
+
+	SmartPtr<IOrderingAlgorithm<TAlgebra, O_t> > clone()
+	{
+		return make_sp(new NativeNestedDissectionOrdering<TAlgebra, O_t>(*this));
+	}
+
+	void compute(){
+		UG_COND_THROW(m == NULL, name() << "::compute: no matrix given.");
+		std::vector<std::vector<size_t> > neighbors;
+		neighbors.resize(m->num_rows());
+
+		for(size_t i=0; i<m->num_rows(); i++)
+		{
+			for(typename M_t::row_iterator i_it = m->begin_row(i); i_it != m->end_row(i); ++i_it){
+				neighbors[i].push_back(i_it.index());
+			}
+		}
+
+		ComputeNestedDissectionOrder(o, neighbors, m_leafSize);
+
+		m = NULL;
+
+		#ifdef UG_DEBUG
+		check();
+		#endif
+	}
+
+	void check(){
+		UG_COND_THROW(!is_permutation(o), name() << "::check: Not a permutation!");
+	}
+
+	O_t& ordering(){
+		return o;
+	}
+
+	void init(M_t* A, const V_t&){
+		init(A);
+	}
+
+	void init(M_t* A){
+		//TODO: replace this by UG_DLOG if permutation_util does not depend on this file anymore
+		#ifdef UG_ENABLE_DEBUG_LOGS
+		UG_LOG("Using " << name() << "\n");
+		#endif
+
+		m = A;
+	}
+
+	void init(M_t*, const V_t&, const O_t&){
+		UG_THROW(name() << "::init: induced subgraph version not implemented yet!");
+	}
+
+	void init(M_t*, const O_t&){
+		UG_THROW(name() << "::init: induced subgraph version not implemented yet!");
+	}
+
+	void set_leaf_size(size_t leafSize){
+		m_leafSize = leafSize;
+	}
+
+	virtual const char* name() const {return "NativeNestedDissectionOrdering";}
+
+private:
+	O_t o;
+	M_t* m;
+
+	size_t m_leafSize;
+};
+
+
+} // end namespace ug
+
+#endif
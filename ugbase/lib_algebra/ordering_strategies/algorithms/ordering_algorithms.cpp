@@ -1,6 +1,7 @@
 #include "boost_cuthill_mckee_ordering.cpp"
 #include "boost_minimum_degree_ordering.cpp"
 #include "native_cuthill_mckee.h"
+#include "native_nested_dissection.h"
 #include "topological_ordering.cpp"
 
 #include "SCC_ordering.cpp"
@@ -152,6 +152,14 @@ class ParallelVector : public TVector
 	 */
 		inline number dotprod(const this_type& v);
 
+	/// process-local part of dotprod
+	/**
+	 * Changes the storage types as dotprod() does and returns the dot product
+	 * of the process-local parts without summing over the processes. This
+	 * allows to sum several dot products in a single reduction.
+	 */
+		inline number local_dotprod(const this_type& v);
+
 	/// assign number to whole Vector
 		number operator = (number d);
 
@@ -322,9 +322,8 @@ number ParallelVector<TVector>::maxnorm() const
 
 template <typename TVector>
 inline
-number ParallelVector<TVector>::dotprod(const this_type& v)
+number ParallelVector<TVector>::local_dotprod(const this_type& v)
 {
-	PROFILE_FUNC_GROUP("algebra parallelization");
 	// 	step 0: check that storage type is given
 	if(this->has_storage_type(PST_UNDEFINED) || v.has_storage_type(PST_UNDEFINED))
 	{
@@ -364,7 +363,16 @@ number ParallelVector<TVector>::dotprod(const this_type& v)
 	}
 
 	// 	step 3: compute local dot product
-	double tSumLocal = (double)TVector::dotprod(v);
+	return TVector::dotprod(v);
+}
+
+template <typename TVector>
+inline
+number ParallelVector<TVector>::dotprod(const this_type& v)
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	// 	steps 0 - 3: compute local dot product
+	double tSumLocal = (double)local_dotprod(v);
 	double tSumGlobal;
 
 	// 	step 4: sum global contributions
@@ -44,6 +44,17 @@ inline double dabs(double a) { return a > 0 ? a : -a; }
 template <typename t> struct block_traits;
 template<typename value_type, typename vec_type> struct block_multiply_traits;
 
+/// type used to store a copy of a block in reduced precision
+/**	Preconditioners may store their (approximate) operators in reduced
+ * precision to save memory bandwidth. Blocks without a reduced precision
+ * counterpart are stored as they are, i.e. is_reduced is false and no
+ * copy should be made.*/
+template <typename T> struct block_reduced_precision_traits
+{
+	typedef T type;
+	enum { is_reduced = false };
+};
+
 
 //////////////////////////////////////////////////////
 
@@ -160,6 +160,30 @@ inline bool InverseMatMult(number &dest, const double &beta, const number &mat,
 	return true;
 }
 
+///////////////////////////////////////////////////////////////////
+// float as reduced precision storage of numbers
+
+#ifndef UG_SINGLE_PRECISION
+template<>
+struct block_reduced_precision_traits<number>
+{
+	typedef float type;
+	enum { is_reduced = true };
+};
+
+template <>
+inline number BlockNorm(const float &a)
+{
+	return a>0 ? a : -a;
+}
+
+inline bool InverseMatMult(number &dest, const double &beta, const float &mat, const number &vec)
+{
+	dest = beta*vec/mat;
+	return true;
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////
 // traits: information for numbers
 
@@ -105,6 +105,17 @@ extern "C"
 				 lapack_float *pWork, lapack_int *worksize, lapack_int *info);
 	void dgetri_(lapack_int *n, lapack_double *pColMajorMatrix, lapack_int *lda, const lapack_int *ipiv,
 				 lapack_double *pWork, lapack_int *worksize, lapack_int *info);	
+
+	// BLAS-3: matrix-matrix product *GEMM
+	void dgemm_(char *transA, char *transB, lapack_int *m, lapack_int *n, lapack_int *k,
+			lapack_double *alpha, const lapack_double *pColMajorMatrixA, lapack_int *lda,
+			const lapack_double *pColMajorMatrixB, lapack_int *ldb, lapack_double *beta,
+			lapack_double *pColMajorMatrixC, lapack_int *ldc);
+
+	// BLAS-3: triangular solve with multiple right hand sides *TRSM
+	void dtrsm_(char *side, char *uplo, char *transA, char *diag, lapack_int *m, lapack_int *n,
+			lapack_double *alpha, const lapack_double *pColMajorMatrixA, lapack_int *lda,
+			lapack_double *pColMajorMatrixB, lapack_int *ldb);
 }
 
 
@@ -319,6 +330,43 @@ inline lapack_int getri(lapack_int n, lapack_double *pColMajorMatrix, lapack_int
 	return info;
 }
 
+
+// BLAS-3
+//---------------
+
+/*
+ *  gemm computes C = alpha * op(A) * op(B) + beta * C
+ *  with op(A) a m x k and op(B) a k x n matrix (all matrices col major).
+ */
+inline void gemm(eTransposeMode transA, eTransposeMode transB, lapack_int m, lapack_int n, lapack_int k,
+		lapack_double alpha, const lapack_double *pColMajorMatrixA, lapack_int lda,
+		const lapack_double *pColMajorMatrixB, lapack_int ldb, lapack_double beta,
+		lapack_double *pColMajorMatrixC, lapack_int ldc)
+{
+	char _transA = TransposeModeToChar(transA, false);
+	char _transB = TransposeModeToChar(transB, false);
+	dgemm_(&_transA, &_transB, &m, &n, &k, &alpha, pColMajorMatrixA, &lda,
+			pColMajorMatrixB, &ldb, &beta, pColMajorMatrixC, &ldc);
+}
+
+/*
+ *  trsm solves op(A) * X = alpha * B (bLeft) or X * op(A) = alpha * B (!bLeft)
+ *  for X with a triangular matrix A. B (m x n, col major) is overwritten with X.
+ *  If bUnitDiag, the diagonal of A is assumed to be one.
+ */
+inline void trsm(bool bLeft, bool bLower, eTransposeMode transA, bool bUnitDiag,
+		lapack_int m, lapack_int n, lapack_double alpha,
+		const lapack_double *pColMajorMatrixA, lapack_int lda,
+		lapack_double *pColMajorMatrixB, lapack_int ldb)
+{
+	char _side = bLeft ? 'L' : 'R';
+	char _uplo = bLower ? 'L' : 'U';
+	char _transA = TransposeModeToChar(transA, false);
+	char _diag = bUnitDiag ? 'U' : 'N';
+	dtrsm_(&_side, &_uplo, &_transA, &_diag, &m, &n, &alpha, pColMajorMatrixA, &lda,
+			pColMajorMatrixB, &ldb);
+}
+
 }
 
 
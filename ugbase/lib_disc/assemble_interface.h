@@ -195,6 +195,36 @@ class IAssemble
 		void assemble_stiffness_matrix(matrix_type& A, const vector_type& u)
 		{assemble_stiffness_matrix(A,u,GridLevel());}
 
+	///	applies the jacobian without assembling it
+	/**
+	 * Computes \f$ d = J(u) c \f$ by evaluating the element-local jacobians
+	 * on the fly. The rows of Dirichlet dofs are not adjusted, they are
+	 * identity rows of J(u) and marked by assemble_dirichlet_mask().
+	 *
+	 * \param[out]	d	result (additive)
+	 * \param[in]	c	vector the jacobian is applied to (consistent)
+	 * \param[in]	u	current iterate (consistent)
+	 * \param[in]	gl	Grid Level
+	 */
+		virtual void apply_jacobian(vector_type& d, const vector_type& c, const vector_type& u, const GridLevel& gl)
+		{UG_THROW("IAssemble: apply_jacobian not implemented.");}
+		void apply_jacobian(vector_type& d, const vector_type& c, const vector_type& u)
+		{apply_jacobian(d,c,u,GridLevel());}
+
+	///	assembles only the (block-)diagonal of the jacobian
+		virtual void assemble_jacobian_diagonal(matrix_type& D, const vector_type& u, const GridLevel& gl)
+		{UG_THROW("IAssemble: assemble_jacobian_diagonal not implemented.");}
+		void assemble_jacobian_diagonal(matrix_type& D, const vector_type& u)
+		{assemble_jacobian_diagonal(D,u,GridLevel());}
+
+	///	assembles a mask that is zero for Dirichlet dofs and one else
+	/**	Throws if constraints other than Dirichlet constraints are enabled,
+	 * since these are not supported in the matrix-free application.*/
+		virtual void assemble_dirichlet_mask(vector_type& mask, const GridLevel& gl)
+		{UG_THROW("IAssemble: assemble_dirichlet_mask not implemented.");}
+		void assemble_dirichlet_mask(vector_type& mask)
+		{assemble_dirichlet_mask(mask,GridLevel());}
+
 	/// \{
 		virtual SmartPtr<AssemblingTuner<TAlgebra> > ass_tuner() = 0;
 		virtual ConstSmartPtr<AssemblingTuner<TAlgebra> > ass_tuner() const = 0;
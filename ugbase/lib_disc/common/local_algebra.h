@@ -57,13 +57,21 @@ class LocalIndices
 
 	public:
 	///	Default Constructor
-		LocalIndices() {};
+		LocalIndices() : m_numFct(0) {};
 
 	///	sets the number of functions
+	/**
+	 * The index storage of the functions is retained when the number of
+	 * functions is reduced (or the indices are cleared), i.e. the indices do
+	 * not allocate in an element loop once they have been filled for the
+	 * largest element.
+	 */
 		void resize_fct(size_t numFct)
 		{
-			m_vvIndex.resize(numFct);
+			if(numFct > m_vvIndex.size()) m_vvIndex.resize(numFct);
+			for(size_t fct = m_numFct; fct < numFct; ++fct) m_vvIndex[fct].clear();
 			m_vLFEID.resize(numFct);
+			m_numFct = numFct;
 		}
 
 	///	sets the local finite element id for a function
@@ -108,10 +116,10 @@ class LocalIndices
 		}
 
 	///	clears all fct
-		void clear() {m_vvIndex.clear();}
+		void clear() {m_numFct = 0;}
 
 	///	number of functions
-		size_t num_fct() const {return m_vvIndex.size();}
+		size_t num_fct() const {return m_numFct;}
 
 	/// number of dofs for accessible function
 		size_t num_dof(size_t fct) const
@@ -187,9 +195,12 @@ class LocalIndices
 		}
 
 	protected:
-	// 	Mapping (fct, dof) -> local index
+	// 	Mapping (fct, dof) -> local index (size: >= num_fct())
 		std::vector<std::vector<DoFIndex> > m_vvIndex;
 
+	//	number of functions
+		size_t m_numFct;
+
 	//	Local finite element ids
 		std::vector<LFEID> m_vLFEID;
 };
@@ -205,19 +216,27 @@ class LocalVector
 
 	public:
 	///	default Constructor
-		LocalVector() : m_pIndex(NULL) {m_vvValue.clear();}
+		LocalVector() : m_pIndex(NULL), m_pFuncMap(NULL), m_vOffset(1, 0) {}
 
 	///	Constructor
-		LocalVector(const LocalIndices& ind) {resize(ind);}
+		LocalVector(const LocalIndices& ind) : m_pFuncMap(NULL) {resize(ind);}
 
 	///	resize for current local indices
+	/**
+	 * The values of all functions are stored in one contiguous array, function
+	 * by function. The memory is retained when resizing for smaller indices,
+	 * i.e. the vector does not allocate in an element loop once it has been
+	 * resized for the largest element.
+	 */
 		void resize(const LocalIndices& ind)
 		{
 			m_pIndex = &ind;
-			m_vvValue.resize(ind.num_fct());
-			m_vvValueAcc.resize(m_vvValue.size());
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				m_vvValue[fct].resize(ind.num_dof(fct));
+			const size_t numFct = ind.num_fct();
+			m_vOffset.resize(numFct + 1);
+			m_vOffset[0] = 0;
+			for(size_t fct = 0; fct < numFct; ++fct)
+				m_vOffset[fct+1] = m_vOffset[fct] + ind.num_dof(fct);
+			m_vValue.resize(m_vOffset[numFct]);
 			access_all();
 		}
 
@@ -230,16 +249,10 @@ class LocalVector
 
 	this_type& operator=(const this_type& other)
 	{
-		m_pIndex = other.m_pIndex;
-		const size_t numFcts = m_pIndex->num_fct();
-		m_vvValue.resize(numFcts);
-		for (size_t fct = 0; fct < numFcts; ++fct)
-			m_vvValue[fct].resize(m_pIndex->num_dof(fct));
-		m_vvValueAcc.resize(numFcts);
-		if (other.m_pFuncMap)
-			access_by_map(*other.m_pFuncMap);
-		else
-			access_all();
+		const FunctionIndexMapping* pFuncMap = other.m_pFuncMap;
+		resize(*other.m_pIndex);
+		if (pFuncMap)
+			access_by_map(*pFuncMap);
 
 		return *this;
 	}
@@ -247,9 +260,8 @@ class LocalVector
 	/// set all components of the vector
 		this_type& operator=(number val)
 		{
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] = val;
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] = val;
 			return *this;
 		}
 
@@ -262,9 +274,8 @@ class LocalVector
 	/// multiply all components of the vector
 		this_type& operator*=(number val)
 		{
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] *= val;
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] *= val;
 			return *this;
 		}
 
@@ -272,9 +283,8 @@ class LocalVector
 		this_type& operator+=(const this_type& rhs)
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pIndex==rhs.m_pIndex, "Not same indices.");
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] += rhs.m_vvValue[fct][dof];
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] += rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -282,9 +292,8 @@ class LocalVector
 		this_type& operator-=(const this_type& rhs)
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pIndex==rhs.m_pIndex, "Not same indices.");
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] -= rhs.m_vvValue[fct][dof];
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] -= rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -292,9 +301,8 @@ class LocalVector
 		this_type& scale_append(number s, const this_type& rhs)
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pIndex==rhs.m_pIndex, "Not same indices.");
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] += s * rhs.m_vvValue[fct][dof];
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] += s * rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -306,11 +314,9 @@ class LocalVector
 		void access_by_map(const FunctionIndexMapping& funcMap)
 		{
 			m_pFuncMap = &funcMap;
+			m_vAccOffset.resize(funcMap.num_fct());
 			for(size_t i = 0; i < funcMap.num_fct(); ++i)
-			{
-				const size_t mapFct = funcMap[i];
-				m_vvValueAcc[i] = &(m_vvValue[mapFct][0]);
-			}
+				m_vAccOffset[i] = m_vOffset[funcMap[i]];
 		}
 
 	///	access all functions
@@ -318,16 +324,15 @@ class LocalVector
 		{
 			m_pFuncMap = NULL;
 
-			if(m_pIndex==NULL) {m_vvValueAcc.clear(); return;}
+			if(m_pIndex==NULL) {m_vAccOffset.clear(); return;}
 
-			for(size_t i = 0; i < m_pIndex->num_fct(); ++i)
-				m_vvValueAcc[i] = &(m_vvValue[i][0]);
+			m_vAccOffset.assign(m_vOffset.begin(), m_vOffset.end() - 1);
 		}
 
 	///	returns the number of currently accessible functions
 		size_t num_fct() const
 		{
-			if(m_pFuncMap == NULL) return m_vvValue.size();
+			if(m_pFuncMap == NULL) return num_all_fct();
 			return m_pFuncMap->num_fct();
 		}
 
@@ -344,22 +349,22 @@ class LocalVector
 		size_t num_dof(size_t fct) const
 		{
 			check_fct(fct);
-			if(m_pFuncMap == NULL) return m_vvValue[fct].size();
-			else return m_vvValue[ (*m_pFuncMap)[fct] ].size();
+			if(m_pFuncMap == NULL) return num_all_dof(fct);
+			else return num_all_dof((*m_pFuncMap)[fct]);
 		}
 
 	/// access to dof of currently accessible function fct
 		number& operator()(size_t fct, size_t dof)
 		{
 			check_dof(fct,dof);
-			return m_vvValueAcc[fct][dof];
+			return m_vValue[m_vAccOffset[fct] + dof];
 		}
 
 	/// const access to dof of currently accessible function fct
 		number operator()(size_t fct, size_t dof) const
 		{
 			check_dof(fct,dof);
-			return m_vvValueAcc[fct][dof];
+			return m_vValue[m_vAccOffset[fct] + dof];
 		}
 
 		///////////////////////////
@@ -367,16 +372,37 @@ class LocalVector
 		///////////////////////////
 
 	///	returns the number of all functions
-		size_t num_all_fct() const {return m_vvValue.size();}
+		size_t num_all_fct() const {return m_vOffset.size() - 1;}
 
 	///	returns the number of dofs for a function (unrestricted functions)
-		size_t num_all_dof(size_t fct) const {check_all_fct(fct); return m_vvValue[fct].size();}
+		size_t num_all_dof(size_t fct) const
+		{
+			check_all_fct(fct);
+			return m_vOffset[fct+1] - m_vOffset[fct];
+		}
 
 	/// access to dof of a fct (unrestricted functions)
-		number& value(size_t fct, size_t dof){check_all_dof(fct,dof);return m_vvValue[fct][dof];}
+		number& value(size_t fct, size_t dof)
+		{
+			check_all_dof(fct,dof);
+			return m_vValue[m_vOffset[fct] + dof];
+		}
 
 	/// const access to dof of a fct (unrestricted functions)
-		const number& value(size_t fct, size_t dof) const{check_all_dof(fct,dof);return m_vvValue[fct][dof];}
+		const number& value(size_t fct, size_t dof) const
+		{
+			check_all_dof(fct,dof);
+			return m_vValue[m_vOffset[fct] + dof];
+		}
+
+	///	returns the number of all dofs of all functions
+		size_t num_all_values() const {return m_vValue.size();}
+
+	///	access to the dofs of all functions (stored function by function)
+	/// \{
+		number* all_values() {return m_vValue.empty() ? NULL : &m_vValue[0];}
+		const number* all_values() const {return m_vValue.empty() ? NULL : &m_vValue[0];}
+	/// \}
 
 	protected:
 	///	checks correct fct index in debug mode
@@ -411,11 +437,14 @@ class LocalVector
 	/// Access Mapping
 		const FunctionIndexMapping* m_pFuncMap;
 
-	/// Entries (fct, dof)
-		std::vector<value_type*> m_vvValueAcc;
+	/// Offset of the first entry of a function in the value array (size: num_all_fct()+1)
+		std::vector<size_t> m_vOffset;
+
+	/// Offset of the first entry of an accessible function in the value array
+		std::vector<size_t> m_vAccOffset;
 
-	/// Entries (fct, dof)
-		std::vector<std::vector<value_type> > m_vvValue;
+	/// Entries (fct, dof), stored contiguously function by function
+		std::vector<value_type> m_vValue;
 };
 
 class LocalMatrix
@@ -431,7 +460,8 @@ class LocalMatrix
 	///	Constructor
 		LocalMatrix() :
 			m_pRowIndex(NULL), m_pColIndex(NULL) ,
-			m_pRowFuncMap(NULL), m_pColFuncMap(NULL)
+			m_pRowFuncMap(NULL), m_pColFuncMap(NULL),
+			m_vRowOffset(1, 0), m_vColOffset(1, 0), m_numAllColDoF(0)
 		{}
 
 	///	Constructor
@@ -445,20 +475,23 @@ class LocalMatrix
 		void resize(const LocalIndices& ind) {resize(ind, ind);}
 
 	///	resize for current local indices
+	/**
+	 * The entries are stored in one contiguous row-major array, where the
+	 * rows (resp. columns) are ordered function by function. The memory is
+	 * retained when resizing for smaller indices, i.e. the matrix does not
+	 * allocate in an element loop once it has been resized for the largest
+	 * element.
+	 */
 		void resize(const LocalIndices& rowInd, const LocalIndices& colInd)
 		{
 			m_pRowIndex = &rowInd;
 			m_pColIndex = &colInd;
 
-			m_CplMat.resize(rowInd.num_fct(), colInd.num_fct());
-			m_CplMatAcc.resize(rowInd.num_fct(), colInd.num_fct());
+			compute_offsets(m_vRowOffset, rowInd);
+			compute_offsets(m_vColOffset, colInd);
 
-			for(size_t fct1 = 0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2 = 0; fct2 < m_CplMat.num_cols(); ++fct2)
-				{
-					m_CplMat(fct1, fct2).resize(colInd.num_dof(fct1),
-												rowInd.num_dof(fct2));
-				}
+			m_numAllColDoF = m_vColOffset.back();
+			m_vValue.resize(m_vRowOffset.back() * m_numAllColDoF);
 
 			access_all();
 		}
@@ -476,9 +509,8 @@ class LocalMatrix
 	/// set all entries
 		this_type& operator=(number val)
 		{
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					m_CplMat(fct1,fct2) = val;
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] = val;
 			return *this;
 		}
 
@@ -491,9 +523,8 @@ class LocalMatrix
 	/// multiply matrix
 		this_type& operator*=(number val)
 		{
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					m_CplMat(fct1,fct2) *= val;
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] *= val;
 			return *this;
 		}
 
@@ -502,9 +533,8 @@ class LocalMatrix
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pRowIndex==rhs.m_pRowIndex &&
 			          m_pColIndex==rhs.m_pColIndex, "Not same indices.");
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					m_CplMat(fct1,fct2) += rhs.m_CplMat(fct1,fct2);
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] += rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -513,9 +543,8 @@ class LocalMatrix
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pRowIndex==rhs.m_pRowIndex &&
 			          m_pColIndex==rhs.m_pColIndex, "Not same indices.");
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					m_CplMat(fct1,fct2) -= rhs.m_CplMat(fct1,fct2);
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] -= rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -524,9 +553,8 @@ class LocalMatrix
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pRowIndex==rhs.m_pRowIndex &&
 					  m_pColIndex==rhs.m_pColIndex, "Not same indices.");
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					MatScaleAppend(m_CplMat(fct1,fct2), s, rhs.m_CplMat(fct1,fct2));
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] += s * rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -547,14 +575,13 @@ class LocalMatrix
 			m_pRowFuncMap = &rowFuncMap;
 			m_pColFuncMap = &colFuncMap;
 
-			for(size_t i = 0; i < m_pRowFuncMap->num_fct(); ++i)
-				for(size_t j = 0; j < m_pColFuncMap->num_fct(); ++j)
-				{
-					const size_t rowMapFct = rowFuncMap[i];
-					const size_t colMapFct = colFuncMap[j];
+			m_vRowAccOffset.resize(rowFuncMap.num_fct());
+			for(size_t i = 0; i < rowFuncMap.num_fct(); ++i)
+				m_vRowAccOffset[i] = m_vRowOffset[rowFuncMap[i]];
 
-					m_CplMatAcc(i,j) = &(m_CplMat(rowMapFct, colMapFct));
-				}
+			m_vColAccOffset.resize(colFuncMap.num_fct());
+			for(size_t j = 0; j < colFuncMap.num_fct(); ++j)
+				m_vColAccOffset[j] = m_vColOffset[colFuncMap[j]];
 		}
 
 	///	access all functions
@@ -563,41 +590,43 @@ class LocalMatrix
 			m_pRowFuncMap = NULL;
 			m_pColFuncMap = NULL;
 
-			if(m_pRowIndex==NULL) {m_CplMatAcc.resize(0,0); return;}
+			if(m_pRowIndex==NULL)
+			{
+				m_vRowAccOffset.clear();
+				m_vColAccOffset.clear();
+				return;
+			}
 
-			for(size_t i = 0; i < m_pRowIndex->num_fct(); ++i)
-				for(size_t j = 0; j < m_pColIndex->num_fct(); ++j)
-					m_CplMatAcc(i,j) = &(m_CplMat(i,j));
+			m_vRowAccOffset.assign(m_vRowOffset.begin(), m_vRowOffset.end() - 1);
+			m_vColAccOffset.assign(m_vColOffset.begin(), m_vColOffset.end() - 1);
 		}
 
 	///	returns the number of currently accessible (restricted) functions
 		size_t num_row_fct() const
 		{
 			if(m_pRowFuncMap != NULL) return m_pRowFuncMap->num_fct();
-			return m_CplMatAcc.num_rows();
+			return m_vRowAccOffset.size();
 		}
 
 	///	returns the number of currently accessible (restricted) functions
 		size_t num_col_fct() const
 		{
 			if(m_pColFuncMap != NULL) return m_pColFuncMap->num_fct();
-			return m_CplMatAcc.num_cols();
+			return m_vColAccOffset.size();
 		}
 
 	///	returns the number of dofs for the currently accessible (restricted) function
 		size_t num_row_dof(size_t fct) const
 		{
-			if(m_CplMat.num_rows()==0) return 0;
-			if(m_pRowFuncMap == NULL) return m_CplMat(fct, 0).num_rows();
-			else return m_CplMat( (*m_pRowFuncMap)[fct], 0).num_rows();
+			if(m_pRowFuncMap == NULL) return num_all_row_dof(fct);
+			else return num_all_row_dof((*m_pRowFuncMap)[fct]);
 		}
 
 	///	returns the number of dofs for the currently accessible (restricted) function
 		size_t num_col_dof(size_t fct) const
 		{
-			if(m_CplMat.num_cols()==0) return 0;
-			if(m_pRowFuncMap == NULL) return m_CplMat(0, fct).num_cols();
-			else return m_CplMat( 0, (*m_pColFuncMap)[fct]).num_cols();
+			if(m_pColFuncMap == NULL) return num_all_col_dof(fct);
+			else return num_all_col_dof((*m_pColFuncMap)[fct]);
 		}
 
 	/// access to (restricted) coupling (rowFct, rowDoF) x (colFct, colDoF)
@@ -605,7 +634,8 @@ class LocalMatrix
 		                   size_t colFct, size_t colDoF)
 		{
 			check_dof(rowFct, rowDoF, colFct, colDoF);
-			return (*m_CplMatAcc(rowFct,colFct))(rowDoF, colDoF);
+			return m_vValue[(m_vRowAccOffset[rowFct] + rowDoF) * m_numAllColDoF
+			                + m_vColAccOffset[colFct] + colDoF];
 		}
 
 	/// const access to (restricted) coupling (rowFct, rowDoF) x (colFct, colDoF)
@@ -613,7 +643,8 @@ class LocalMatrix
 		                        size_t colFct, size_t colDoF) const
 		{
 			check_dof(rowFct, rowDoF, colFct, colDoF);
-			return (*m_CplMatAcc(rowFct,colFct))(rowDoF, colDoF);
+			return m_vValue[(m_vRowAccOffset[rowFct] + rowDoF) * m_numAllColDoF
+			                + m_vColAccOffset[colFct] + colDoF];
 		}
 
 		///////////////////////////
@@ -621,23 +652,30 @@ class LocalMatrix
 		///////////////////////////
 
 	///	returns the number of all functions
-		size_t num_all_row_fct() const{	return m_CplMat.num_rows();}
+		size_t num_all_row_fct() const{return m_vRowOffset.size() - 1;}
 
 	///	returns the number of all functions
-		size_t num_all_col_fct() const{return m_CplMat.num_cols();}
+		size_t num_all_col_fct() const{return m_vColOffset.size() - 1;}
 
 	///	returns the number of dofs for a function
-		size_t num_all_row_dof(size_t fct) const {return m_CplMat(fct, 0).num_rows();}
+		size_t num_all_row_dof(size_t fct) const
+		{
+			return m_vRowOffset[fct+1] - m_vRowOffset[fct];
+		}
 
 	///	returns the number of dofs for a function
-		size_t num_all_col_dof(size_t fct) const {return m_CplMat(0, fct).num_cols();}
+		size_t num_all_col_dof(size_t fct) const
+		{
+			return m_vColOffset[fct+1] - m_vColOffset[fct];
+		}
 
 	/// access to coupling (rowFct, rowDoF) x (colFct, colDoF)
 		number& value(size_t rowFct, size_t rowDoF,
 		              size_t colFct, size_t colDoF)
 		{
 			check_all_dof(rowFct, rowDoF, colFct, colDoF);
-			return (m_CplMat(rowFct,colFct))(rowDoF, colDoF);
+			return m_vValue[(m_vRowOffset[rowFct] + rowDoF) * m_numAllColDoF
+			                + m_vColOffset[colFct] + colDoF];
 		}
 
 	/// const access to coupling (rowFct, rowDoF) x (colFct, colDoF)
@@ -645,10 +683,31 @@ class LocalMatrix
 		                   size_t colFct, size_t colDoF) const
 		{
 			check_all_dof(rowFct, rowDoF, colFct, colDoF);
-			return (m_CplMat(rowFct,colFct))(rowDoF, colDoF);
+			return m_vValue[(m_vRowOffset[rowFct] + rowDoF) * m_numAllColDoF
+			                + m_vColOffset[colFct] + colDoF];
 		}
 
+	///	returns the number of all couplings of all functions
+		size_t num_all_values() const {return m_vValue.size();}
+
+	///	access to the couplings of all functions (stored row by row)
+	/// \{
+		number* all_values() {return m_vValue.empty() ? NULL : &m_vValue[0];}
+		const number* all_values() const {return m_vValue.empty() ? NULL : &m_vValue[0];}
+	/// \}
+
 	protected:
+	///	computes the offsets of the functions in the rows (resp. columns)
+		static void compute_offsets(std::vector<size_t>& vOffset,
+		                            const LocalIndices& ind)
+		{
+			const size_t numFct = ind.num_fct();
+			vOffset.resize(numFct + 1);
+			vOffset[0] = 0;
+			for(size_t fct = 0; fct < numFct; ++fct)
+				vOffset[fct+1] = vOffset[fct] + ind.num_dof(fct);
+		}
+
 	///	checks correct (fct1,fct2) index in debug mode
 		inline void check_fct(size_t rowFct, size_t colFct) const
 		{
@@ -691,22 +750,17 @@ class LocalMatrix
 	/// Column Access Mapping
 		const FunctionIndexMapping* m_pColFuncMap;
 
-	//	\todo: Think of a better (faster) storage (one plain array?)
+	///	Offset of the first row (resp. column) of a function (size: num fct + 1)
+		std::vector<size_t> m_vRowOffset, m_vColOffset;
 
-	//	type of cpl matrices between two functions
-		typedef DenseMatrix<VariableArray2<value_type> > LocalCplMatrix;
+	///	Offset of the first row (resp. column) of an accessible function
+		std::vector<size_t> m_vRowAccOffset, m_vColAccOffset;
 
-	//	type of Func-Coupling matrices
-		typedef DenseMatrix<VariableArray2<LocalCplMatrix> > FctCplMatrix;
+	///	Number of all columns, i.e. the row stride of the value array
+		size_t m_numAllColDoF;
 
-	//	type of Func-Coupling pointer matrices
-		typedef DenseMatrix<VariableArray2<LocalCplMatrix*> > FctCplAccMatrix;
-
-	// 	Entries (fct1, fct2, dof1, dof2)
-		FctCplMatrix m_CplMat;
-
-	// 	Entries (fct1, fct2, dof1, dof2)
-		FctCplAccMatrix m_CplMatAcc;
+	// 	Entries (fct1, dof1, fct2, dof2), stored row-major
+		std::vector<value_type> m_vValue;
 };
 
 inline
@@ -788,6 +842,95 @@ void AddLocalMatrixToGlobal(TMatrix& mat, const LocalMatrix& lmat)
 		}
 }
 
+/// adds a local matrix to the global one using cached positions
+/**
+ * Works like AddLocalMatrixToGlobal, but stores the position of each entry in
+ * the value storage of the matrix in vPos (in the order the entries are
+ * added, starting at cursor). If the same local matrices are added again in
+ * the same order and the sparsity pattern has not changed, the values are
+ * added at the stored positions without searching the matrix rows. Each
+ * position is checked before use and looked up again if it does not match.
+ *
+ * \param[in,out]	mat		global matrix
+ * \param[in]		lmat	local matrix
+ * \param[in,out]	vPos	cached positions
+ * \param[in,out]	cursor	index of the first position of this local matrix
+ */
+template <typename TMatrix>
+void AddLocalMatrixToGlobal(TMatrix& mat, const LocalMatrix& lmat,
+                            std::vector<int>& vPos, size_t& cursor)
+{
+	const LocalIndices& rowInd = lmat.get_row_indices();
+	const LocalIndices& colInd = lmat.get_col_indices();
+
+	for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+		for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1)
+		{
+			const size_t rowIndex = rowInd.index(fct1,dof1);
+			const size_t rowComp = rowInd.comp(fct1,dof1);
+
+			for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+				for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2, ++cursor)
+				{
+					const size_t colIndex = colInd.index(fct2,dof2);
+					const size_t colComp = colInd.comp(fct2,dof2);
+
+					if(cursor == vPos.size())
+						vPos.push_back(mat.position(rowIndex, colIndex));
+					else if(!mat.is_position(rowIndex, colIndex, vPos[cursor]))
+						vPos[cursor] = mat.position(rowIndex, colIndex);
+
+					BlockRef(mat.value_at(vPos[cursor]), rowComp, colComp)
+								+= lmat.value(fct1,dof1,fct2,dof2);
+				}
+		}
+}
+
+template <typename TVector>
+void AddLocalMatVecToGlobal(TVector& vec, const LocalMatrix& lmat,
+                            const LocalVector& lvec)
+{
+	const LocalIndices& rowInd = lmat.get_row_indices();
+
+	for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+		for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1)
+		{
+			number sum = 0.0;
+			for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+				for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2)
+					sum += lmat.value(fct1,dof1,fct2,dof2) * lvec.value(fct2,dof2);
+
+			const size_t rowIndex = rowInd.index(fct1,dof1);
+			const size_t rowComp = rowInd.comp(fct1,dof1);
+			BlockRef(vec[rowIndex], rowComp) += sum;
+		}
+}
+
+template <typename TMatrix>
+void AddLocalMatrixDiagToGlobal(TMatrix& mat, const LocalMatrix& lmat)
+{
+	const LocalIndices& rowInd = lmat.get_row_indices();
+	const LocalIndices& colInd = lmat.get_col_indices();
+
+	for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+		for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1)
+		{
+			const size_t rowIndex = rowInd.index(fct1,dof1);
+			const size_t rowComp = rowInd.comp(fct1,dof1);
+
+			for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+				for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2)
+				{
+					const size_t colIndex = colInd.index(fct2,dof2);
+					if(colIndex != rowIndex) continue;
+
+					const size_t colComp = colInd.comp(fct2,dof2);
+					BlockRef(mat(rowIndex, colIndex), rowComp, colComp)
+								+= lmat.value(fct1,dof1,fct2,dof2);
+				}
+		}
+}
+
 } // end namespace ug
 
 #endif /* __H__UG__LIB_DISC__COMMON__LOCAL_ALGEBRA__ */
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "lagrange_sum_fact.h"
+#include "lagrange.h"
+#include "lib_disc/quadrature/gauss_legendre/gauss_legendre.h"
+
+namespace ug{
+
+template <typename TRefElem>
+void LagrangeSumFactorization<TRefElem>::init(size_t p, size_t quadOrder)
+{
+	if(p < 1)
+		UG_THROW("LagrangeSumFactorization: Order must be >= 1, but is "<<p);
+
+//	1d rule used for the tensor-product Gauss-Legendre rules
+	GaussLegendre rule1d(quadOrder);
+
+	m_p = p;
+	m_n = p+1;
+	m_q = rule1d.size();
+
+	m_nsh = 1; m_nip = 1;
+	for(int d = 0; d < dim; ++d) {m_nsh *= m_n; m_nip *= m_q;}
+
+//	1d shape values and derivatives at the 1d ips
+	m_vB.resize(m_q * m_n);
+	m_vD.resize(m_q * m_n);
+	for(size_t i = 0; i < m_n; ++i)
+	{
+		const Polynomial1D polynom = EquidistantLagrange1D(i, p);
+		const Polynomial1D dpolynom = polynom.derivative();
+
+		for(size_t q = 0; q < m_q; ++q)
+		{
+			m_vB[q*m_n + i] = polynom.value(rule1d.point(q)[0]);
+			m_vD[q*m_n + i] = dpolynom.value(rule1d.point(q)[0]);
+		}
+	}
+
+//	map shapes to lexicographic ordering (x fastest)
+	const FlexLagrangeLSFS<TRefElem> lsfs(p);
+	m_vLexIndex.resize(m_nsh);
+	for(size_t i = 0; i < m_nsh; ++i)
+	{
+		const MathVector<dim,int>& ind = lsfs.multi_index(i);
+
+		size_t lex = 0, stride = 1;
+		for(int d = 0; d < dim; ++d) {lex += ind[d] * stride; stride *= m_n;}
+		m_vLexIndex[i] = lex;
+	}
+
+//	map lexicographic ips (x fastest) to the ordering of the tensor rules, that
+//	loop the x direction slowest (cf. GaussQuadratureHexahedron)
+	m_vIPIndex.resize(m_nip);
+	m_vIP.resize(m_nip);
+	m_vWeight.resize(m_nip);
+	for(size_t l = 0; l < m_nip; ++l)
+	{
+		size_t qi[dim];
+		size_t rest = l;
+		for(int d = 0; d < dim; ++d) {qi[d] = rest % m_q; rest /= m_q;}
+
+		size_t ip = 0;
+		number weight = 1.0;
+		MathVector<dim> pos;
+		for(int d = 0; d < dim; ++d)
+		{
+			ip = ip * m_q + qi[d];
+			pos[d] = rule1d.point(qi[d])[0];
+			weight *= rule1d.weight(qi[d]);
+		}
+
+		m_vIPIndex[l] = ip;
+		m_vIP[ip] = pos;
+		m_vWeight[ip] = weight;
+	}
+
+//	work arrays
+	size_t maxSize = 1;
+	for(int d = 0; d < dim; ++d) maxSize *= std::max(m_n, m_q);
+
+	m_vLexCoeff.resize(m_nsh);
+	m_vLexRes.resize(m_nsh);
+	m_vLexTmp.resize(m_nsh);
+	m_vIPValue.resize(m_nip);
+	for(int d = 0; d < dim; ++d) m_vIPGrad[d].resize(m_nip);
+	m_vTmp1.resize(maxSize);
+	m_vTmp2.resize(maxSize);
+}
+
+template <typename TRefElem>
+void LagrangeSumFactorization<TRefElem>::
+contract(const number* vM[dim], const number* in, number* out, bool bTransposed) const
+{
+//	sizes of the input and output index of a contraction
+	const size_t k = bTransposed ? m_q : m_n;
+	const size_t m = bTransposed ? m_n : m_q;
+
+	const number* src = in;
+	for(int d = 0; d < dim; ++d)
+	{
+		number* dst = (d == dim-1) ? out : ((d % 2 == 0) ? &m_vTmp1[0] : &m_vTmp2[0]);
+
+	//	directions < d are already contracted, directions > d not yet
+		size_t inner = 1, outer = 1;
+		for(int e = 0; e < d; ++e) inner *= m;
+		for(int e = d+1; e < dim; ++e) outer *= k;
+
+		const number* M = vM[d];
+		for(size_t o = 0; o < outer; ++o)
+		{
+			for(size_t r = 0; r < m; ++r)
+			{
+				number* pOut = dst + (o*m + r)*inner;
+				for(size_t i = 0; i < inner; ++i) pOut[i] = 0.0;
+
+				for(size_t j = 0; j < k; ++j)
+				{
+					const number a = bTransposed ? M[j*m_n + r] : M[r*m_n + j];
+					if(a == 0.0) continue;
+
+					const number* pIn = src + (o*k + j)*inner;
+					for(size_t i = 0; i < inner; ++i)
+						pOut[i] += a * pIn[i];
+				}
+			}
+		}
+
+		src = dst;
+	}
+}
+
+template <typename TRefElem>
+void LagrangeSumFactorization<TRefElem>::gather(const number vCoeff[]) const
+{
+	for(size_t i = 0; i < m_nsh; ++i)
+		m_vLexCoeff[m_vLexIndex[i]] = vCoeff[i];
+}
+
+template <typename TRefElem>
+void LagrangeSumFactorization<TRefElem>::scatter(number vRes[]) const
+{
+	for(size_t i = 0; i < m_nsh; ++i)
+		vRes[i] += m_vLexRes[m_vLexIndex[i]];
+}
+
+template <typename TRefElem>
+void LagrangeSumFactorization<TRefElem>::
+values(number vValue[], const number vCoeff[]) const
+{
+	const number* vM[dim];
+	for(int d = 0; d < dim; ++d) vM[d] = &m_vB[0];
+
+	gather(vCoeff);
+	contract(vM, &m_vLexCoeff[0], &m_vIPValue[0], false);
+
+	for(size_t l = 0; l < m_nip; ++l)
+		vValue[m_vIPIndex[l]] = m_vIPValue[l];
+}
+
+template <typename TRefElem>
+void LagrangeSumFactorization<TRefElem>::
+gradients(grad_type vGrad[], const number vCoeff[]) const
+{
+	gather(vCoeff);
+
+	const number* vM[dim];
+	for(int d = 0; d < dim; ++d)
+	{
+		for(int e = 0; e < dim; ++e) vM[e] = (e == d) ? &m_vD[0] : &m_vB[0];
+		contract(vM, &m_vLexCoeff[0], &m_vIPGrad[d][0], false);
+	}
+
+	for(size_t l = 0; l < m_nip; ++l)
+		for(int d = 0; d < dim; ++d)
+			vGrad[m_vIPIndex[l]][d] = m_vIPGrad[d][l];
+}
+
+template <typename TRefElem>
+void LagrangeSumFactorization<TRefElem>::
+add_test_values(number vRes[], const number vValue[]) const
+{
+	const number* vM[dim];
+	for(int d = 0; d < dim; ++d) vM[d] = &m_vB[0];
+
+	for(size_t l = 0; l < m_nip; ++l)
+		m_vIPValue[l] = vValue[m_vIPIndex[l]];
+
+	contract(vM, &m_vIPValue[0], &m_vLexRes[0], true);
+	scatter(vRes);
+}
+
+template <typename TRefElem>
+void LagrangeSumFactorization<TRefElem>::
+add_test_gradients(number vRes[], const grad_type vGrad[]) const
+{
+	for(size_t l = 0; l < m_nip; ++l)
+		for(int d = 0; d < dim; ++d)
+			m_vIPGrad[d][l] = vGrad[m_vIPIndex[l]][d];
+
+	for(size_t i = 0; i < m_nsh; ++i) m_vLexRes[i] = 0.0;
+
+	const number* vM[dim];
+	for(int d = 0; d < dim; ++d)
+	{
+		for(int e = 0; e < dim; ++e) vM[e] = (e == d) ? &m_vD[0] : &m_vB[0];
+		contract(vM, &m_vIPGrad[d][0], &m_vLexTmp[0], true);
+
+		for(size_t i = 0; i < m_nsh; ++i) m_vLexRes[i] += m_vLexTmp[i];
+	}
+
+	scatter(vRes);
+}
+
+template <typename TRefElem>
+void LagrangeSumFactorization<TRefElem>::
+apply(number vRes[], const number vCoeff[],
+      const MathMatrix<dim,dim> vDiff[], const number vReac[]) const
+{
+	gather(vCoeff);
+
+//	gradients and values at ips
+	const number* vM[dim];
+	for(int d = 0; d < dim; ++d)
+	{
+		for(int e = 0; e < dim; ++e) vM[e] = (e == d) ? &m_vD[0] : &m_vB[0];
+		contract(vM, &m_vLexCoeff[0], &m_vIPGrad[d][0], false);
+	}
+
+	if(vReac != NULL)
+	{
+		for(int d = 0; d < dim; ++d) vM[d] = &m_vB[0];
+		contract(vM, &m_vLexCoeff[0], &m_vIPValue[0], false);
+	}
+
+//	apply coefficients at ips
+	for(size_t l = 0; l < m_nip; ++l)
+	{
+		const size_t ip = m_vIPIndex[l];
+
+		MathVector<dim> grad, flux;
+		for(int d = 0; d < dim; ++d) grad[d] = m_vIPGrad[d][l];
+		MatVecMult(flux, vDiff[ip], grad);
+		for(int d = 0; d < dim; ++d) m_vIPGrad[d][l] = flux[d];
+
+		if(vReac != NULL) m_vIPValue[l] *= vReac[ip];
+	}
+
+//	test with gradients and values
+	for(size_t i = 0; i < m_nsh; ++i) m_vLexRes[i] = 0.0;
+
+	for(int d = 0; d < dim; ++d)
+	{
+		for(int e = 0; e < dim; ++e) vM[e] = (e == d) ? &m_vD[0] : &m_vB[0];
+		contract(vM, &m_vIPGrad[d][0], &m_vLexTmp[0], true);
+
+		for(size_t i = 0; i < m_nsh; ++i) m_vLexRes[i] += m_vLexTmp[i];
+	}
+
+	if(vReac != NULL)
+	{
+		for(int d = 0; d < dim; ++d) vM[d] = &m_vB[0];
+		contract(vM, &m_vIPValue[0], &m_vLexTmp[0], true);
+
+		for(size_t i = 0; i < m_nsh; ++i) m_vLexRes[i] += m_vLexTmp[i];
+	}
+
+	scatter(vRes);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//	explicit template instantiations
+////////////////////////////////////////////////////////////////////////////////
+
+template class LagrangeSumFactorization<ReferenceQuadrilateral>;
+template class LagrangeSumFactorization<ReferenceHexahedron>;
+
+} // end namespace ug
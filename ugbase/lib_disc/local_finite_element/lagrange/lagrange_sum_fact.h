@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__LOCAL_SHAPE_FUNCTION_SET__LAGRANGE__LAGRANGE_SUM_FACT__
+#define __H__UG__LIB_DISC__LOCAL_SHAPE_FUNCTION_SET__LAGRANGE__LAGRANGE_SUM_FACT__
+
+#include <vector>
+
+#include "common/common.h"
+#include "common/math/ugmath.h"
+#include "lib_disc/reference_element/reference_element.h"
+
+namespace ug{
+
+/// sum-factorized evaluation of tensor-product Lagrange shape functions
+/**
+ * For Lagrange shape functions on Quadrilaterals and Hexahedra the shape
+ * functions are products of 1d Lagrange polynomials. At the integration points
+ * of a tensor-product Gauss-Legendre rule (GaussQuadratureQuadrilateral,
+ * GaussQuadratureHexahedron) the evaluation of a finite element function
+ *
+ * 	u(x_q) = \sum_i u_i \phi_i(x_q)
+ *
+ * can thus be carried out by successive 1d contractions along each reference
+ * direction ("sum factorization"), requiring O(d (p+1)^{d+1}) operations
+ * instead of O((p+1)^{2d}) for the full loop over all shapes and ips. The
+ * same holds for the gradients and for the transposed operation, i.e. the
+ * testing of ip values against all shape functions.
+ *
+ * The dofs are passed in the ordering of LagrangeLSFS / FlexLagrangeLSFS and
+ * the ip values are given in the ordering of GaussQuadratureQuadrilateral /
+ * GaussQuadratureHexahedron of the same order (type GAUSS_LEGENDRE in the
+ * QuadratureRuleProvider). All gradients are reference gradients.
+ *
+ * NOTE: The kernel uses internal work arrays, thus an instance must not be
+ * 		 shared between threads.
+ *
+ * \tparam	TRefElem	ReferenceQuadrilateral or ReferenceHexahedron
+ */
+template <typename TRefElem>
+class LagrangeSumFactorization
+{
+	public:
+	///	reference element dimension
+		static const int dim = TRefElem::dim;
+
+	///	gradient type
+		typedef MathVector<dim> grad_type;
+
+	public:
+	///	creates an empty kernel
+		LagrangeSumFactorization() : m_p(0), m_n(0), m_q(0), m_nsh(0), m_nip(0) {}
+
+	///	creates the kernel for a lagrange order and a quadrature order
+		LagrangeSumFactorization(size_t p, size_t quadOrder) {init(p, quadOrder);}
+
+	///	sets the lagrange order and the order of the Gauss-Legendre rule
+		void init(size_t p, size_t quadOrder);
+
+	///	returns the lagrange order
+		size_t order() const {return m_p;}
+
+	///	returns the number of shape functions
+		size_t num_sh() const {return m_nsh;}
+
+	///	returns the number of integration points
+		size_t num_ip() const {return m_nip;}
+
+	///	returns the number of integration points per direction
+		size_t num_ip_1d() const {return m_q;}
+
+	///	returns the local position of an integration point
+		const MathVector<dim>& ip(size_t q) const {return m_vIP[q];}
+
+	///	returns the weight of an integration point
+		number weight(size_t q) const {return m_vWeight[q];}
+
+	///	evaluates a finite element function at all integration points
+		void values(number vValue[], const number vCoeff[]) const;
+
+	///	evaluates the reference gradient of a function at all integration points
+		void gradients(grad_type vGrad[], const number vCoeff[]) const;
+
+	///	adds the ip values tested with all shapes, i.e. res_i += \sum_q \phi_i(x_q) f_q
+		void add_test_values(number vRes[], const number vValue[]) const;
+
+	///	adds the ip values tested with all gradients, i.e. res_i += \sum_q \nabla \phi_i(x_q) \cdot g_q
+		void add_test_gradients(number vRes[], const grad_type vGrad[]) const;
+
+	///	applies the element operator of a diffusion-reaction problem
+	/**
+	 * This computes for all shapes
+	 *
+	 * 	res_i += \sum_q (\nabla \phi_i(x_q))^T K_q \nabla u(x_q) + c_q \phi_i(x_q) u(x_q)
+	 *
+	 * where all geometry information (weights, determinants and inverse
+	 * jacobians) must be included in the reference tensors K_q and the
+	 * scalars c_q. This allows a matrix-free application of the element
+	 * operator without ever assembling the local matrix. If vReac is NULL,
+	 * the reaction term is skipped.
+	 *
+	 * \param[in,out]	vRes		result (size: num_sh)
+	 * \param[in]		vCoeff		dof values (size: num_sh)
+	 * \param[in]		vDiff		reference diffusion tensors (size: num_ip)
+	 * \param[in]		vReac		reaction scalars (size: num_ip), may be NULL
+	 */
+		void apply(number vRes[], const number vCoeff[],
+		           const MathMatrix<dim,dim> vDiff[],
+		           const number vReac[] = NULL) const;
+
+	protected:
+	///	contracts a tensor along all directions with the given 1d matrices
+	/**
+	 * The dof tensor (lexicographic, x fastest) is mapped to the ip tensor
+	 * (lexicographic, x fastest) applying the 1d matrices vM[d] (size q x n)
+	 * in direction d. If bTransposed is true, the transposed mapping is applied.
+	 */
+		void contract(const number* vM[dim], const number* in, number* out,
+		              bool bTransposed) const;
+
+	///	maps dof coefficients to lexicographic ordering
+		void gather(const number vCoeff[]) const;
+
+	///	adds the lexicographic result to the dof ordering
+		void scatter(number vRes[]) const;
+
+	protected:
+	///	lagrange order
+		size_t m_p;
+
+	///	number of 1d shapes
+		size_t m_n;
+
+	///	number of 1d integration points
+		size_t m_q;
+
+	///	number of shapes
+		size_t m_nsh;
+
+	///	number of integration points
+		size_t m_nip;
+
+	///	1d shape values (q x n, row-major)
+		std::vector<number> m_vB;
+
+	///	1d shape derivatives (q x n, row-major)
+		std::vector<number> m_vD;
+
+	///	lexicographic index for each shape
+		std::vector<size_t> m_vLexIndex;
+
+	///	index of ip in quadrature ordering for each lexicographic ip
+		std::vector<size_t> m_vIPIndex;
+
+	///	integration points and weights in quadrature ordering
+	/// \{
+		std::vector<MathVector<dim> > m_vIP;
+		std::vector<number> m_vWeight;
+	/// \}
+
+	///	work arrays
+	/// \{
+		mutable std::vector<number> m_vLexCoeff;
+		mutable std::vector<number> m_vLexRes;
+		mutable std::vector<number> m_vLexTmp;
+		mutable std::vector<number> m_vIPValue;
+		mutable std::vector<number> m_vIPGrad[dim];
+		mutable std::vector<number> m_vTmp1;
+		mutable std::vector<number> m_vTmp2;
+	/// \}
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__LOCAL_SHAPE_FUNCTION_SET__LAGRANGE__LAGRANGE_SUM_FACT__ */
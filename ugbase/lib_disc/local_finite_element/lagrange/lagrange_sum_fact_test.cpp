@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "lagrange_sum_fact_test.h"
+#include "lagrange_sum_fact.h"
+#include "lagrange.h"
+
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+namespace ug{
+
+///	returns the relative deviation of a computed value
+static inline number SumFactDeviation(number val, number ref)
+{
+	return fabs(val - ref) / (1.0 + fabs(ref));
+}
+
+///	returns the maximal deviation between sum factorization and direct evaluation
+template <typename TRefElem>
+static number SumFactMaxDeviation(size_t p)
+{
+	static const int dim = TRefElem::dim;
+	typedef MathVector<dim> grad_type;
+
+	const LagrangeSumFactorization<TRefElem> sf(p, 2*p);
+	const FlexLagrangeLSFS<TRefElem> lsfs(p);
+
+	const size_t nsh = sf.num_sh();
+	const size_t nip = sf.num_ip();
+	if(nsh != lsfs.num_sh())
+		UG_THROW("TestLagrangeSumFactorization: Number of shapes differs.");
+
+//	shape values and gradients at the ips
+	std::vector<number> vShape(nip*nsh);
+	std::vector<grad_type> vGrad(nip*nsh);
+	for(size_t ip = 0; ip < nip; ++ip)
+		for(size_t sh = 0; sh < nsh; ++sh)
+		{
+			vShape[ip*nsh + sh] = lsfs.shape(sh, sf.ip(ip));
+			lsfs.grad(vGrad[ip*nsh + sh], sh, sf.ip(ip));
+		}
+
+//	some data
+	std::vector<number> vCoeff(nsh), vIPValue(nip), vReac(nip);
+	std::vector<grad_type> vIPGrad(nip);
+	std::vector<MathMatrix<dim,dim> > vDiff(nip);
+	for(size_t sh = 0; sh < nsh; ++sh)
+		vCoeff[sh] = sin(1.0 + sh);
+	for(size_t ip = 0; ip < nip; ++ip)
+	{
+		vIPValue[ip] = cos(1.0 + ip);
+		vReac[ip] = 0.5 + 0.1 * sin(2.0 * ip);
+		for(int d = 0; d < dim; ++d)
+		{
+			vIPGrad[ip][d] = sin(1.0 + ip + 0.5*d);
+			for(int d2 = 0; d2 < dim; ++d2)
+				vDiff[ip](d, d2) = (d == d2) ? (1.0 + 0.1 * ip) : 0.2;
+		}
+	}
+
+	number maxDev = 0.0;
+
+//	values and gradients
+	std::vector<number> vValue(nip);
+	std::vector<grad_type> vGradU(nip);
+	sf.values(&vValue[0], &vCoeff[0]);
+	sf.gradients(&vGradU[0], &vCoeff[0]);
+	for(size_t ip = 0; ip < nip; ++ip)
+	{
+		number val = 0.0;
+		grad_type grad; grad = 0.0;
+		for(size_t sh = 0; sh < nsh; ++sh)
+		{
+			val += vCoeff[sh] * vShape[ip*nsh + sh];
+			VecScaleAppend(grad, vCoeff[sh], vGrad[ip*nsh + sh]);
+		}
+
+		maxDev = std::max(maxDev, SumFactDeviation(vValue[ip], val));
+		for(int d = 0; d < dim; ++d)
+			maxDev = std::max(maxDev, SumFactDeviation(vGradU[ip][d], grad[d]));
+	}
+
+//	testing with shapes and gradients, element operator
+	std::vector<number> vResVal(nsh, 0.0), vResGrad(nsh, 0.0), vResOp(nsh, 0.0);
+	sf.add_test_values(&vResVal[0], &vIPValue[0]);
+	sf.add_test_gradients(&vResGrad[0], &vIPGrad[0]);
+	sf.apply(&vResOp[0], &vCoeff[0], &vDiff[0], &vReac[0]);
+	for(size_t sh = 0; sh < nsh; ++sh)
+	{
+		number resVal = 0.0, resGrad = 0.0, resOp = 0.0;
+		for(size_t ip = 0; ip < nip; ++ip)
+		{
+			const number phi = vShape[ip*nsh + sh];
+			const grad_type& gradPhi = vGrad[ip*nsh + sh];
+
+			number u = 0.0;
+			grad_type gradU; gradU = 0.0;
+			for(size_t j = 0; j < nsh; ++j)
+			{
+				u += vCoeff[j] * vShape[ip*nsh + j];
+				VecScaleAppend(gradU, vCoeff[j], vGrad[ip*nsh + j]);
+			}
+			grad_type diffGradU;
+			MatVecMult(diffGradU, vDiff[ip], gradU);
+
+			resVal += phi * vIPValue[ip];
+			resGrad += VecDot(gradPhi, vIPGrad[ip]);
+			resOp += VecDot(gradPhi, diffGradU) + vReac[ip] * phi * u;
+		}
+
+		maxDev = std::max(maxDev, SumFactDeviation(vResVal[sh], resVal));
+		maxDev = std::max(maxDev, SumFactDeviation(vResGrad[sh], resGrad));
+		maxDev = std::max(maxDev, SumFactDeviation(vResOp[sh], resOp));
+	}
+
+	return maxDev;
+}
+
+bool TestLagrangeSumFactorization()
+{
+	const number tol = 1e-10;
+	bool bSuccess = true;
+
+	UG_LOG("TestLagrangeSumFactorization: max. relative deviation from direct evaluation\n");
+	for(size_t p = 1; p <= 5; ++p)
+	{
+		const number dev2d = SumFactMaxDeviation<ReferenceQuadrilateral>(p);
+		const number dev3d = SumFactMaxDeviation<ReferenceHexahedron>(p);
+		UG_LOG("  order " << p << ": quadrilateral " << dev2d
+		       << ", hexahedron " << dev3d << "\n");
+
+		if(dev2d > tol || dev3d > tol) bSuccess = false;
+	}
+
+	if(bSuccess) {UG_LOG("TestLagrangeSumFactorization: passed.\n");}
+	else {UG_LOG("TestLagrangeSumFactorization: FAILED.\n");}
+	return bSuccess;
+}
+
+} // end namespace ug
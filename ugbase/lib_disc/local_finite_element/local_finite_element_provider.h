@@ -44,6 +44,8 @@
 #include "local_finite_element_id.h"
 #include "lib_disc/local_finite_element/local_shape_function_set.h"
 #include "lib_disc/local_finite_element/local_dof_set.h"
+#include "lib_disc/local_finite_element/local_shape_table.h"
+#include "lib_disc/quadrature/quadrature_provider.h"
 
 namespace ug {
 
@@ -164,6 +166,26 @@ class LocalFiniteElementProvider {
 		template <int dim>
 		static std::map<LFEID, DimLocalDoFSets<dim> >& lds_map();
 
+	private:
+	//	key for shape tables: (trial space, reference object id, quadrature rule)
+		template <int dim>
+		struct ShapeTableKey{
+			ShapeTableKey(const LFEID& id_, ReferenceObjectID roid_, const QuadratureRule<dim>* rule_)
+				: id(id_), roid(roid_), rule(rule_) {}
+			bool operator<(const ShapeTableKey& o) const{
+				if(rule != o.rule) return rule < o.rule;
+				if(roid != o.roid) return roid < o.roid;
+				return id < o.id;
+			}
+			LFEID id;
+			ReferenceObjectID roid;
+			const QuadratureRule<dim>* rule;
+		};
+
+	//	returns map for shape tables (not thread-safe)
+		template <int dim>
+		static std::map<ShapeTableKey<dim>, ConstSmartPtr<LocalShapeTable<dim> > >& shape_table_map();
+
 	public:
 	/// register a local shape function set for a given reference element type
 	/**
@@ -247,6 +269,38 @@ class LocalFiniteElementProvider {
 
 	///returns if a Local Shape Function Set is continuous
 		static bool continuous(const LFEID& id, bool bCreate = true);
+
+	///	returns the table of shapes and local gradients at the points of a quadrature rule
+	/**
+	 * This function returns the shape values and local gradients of the Local
+	 * Shape Function Set for a reference element type and an Identifier,
+	 * evaluated at all points of a quadrature rule. The table is created on
+	 * first request and shared by all callers (e.g. all geometries of the
+	 * element discs), thus the shape functions are evaluated only once per
+	 * combination. The quadrature rule is identified by its address, which is
+	 * persistent for all rules handed out by the QuadratureRuleProvider.
+	 *
+	 * NOTE: The tables are stored in a static map that is not protected
+	 * 		 against concurrent access. Thus, this function must not be called
+	 * 		 from several threads at the same time.
+	 *
+	 * \param[in]	roid		Reference object id
+	 * \param[in]	id			Identifier for local shape function set
+	 * \param[in]	quadRule	quadrature rule for roid
+	 * \return 		table		A const reference to the table
+	 */
+	///\{
+		template <int dim>
+		static const LocalShapeTable<dim>&
+		get_shape_table(ReferenceObjectID roid, const LFEID& id,
+		                const QuadratureRule<dim>& quadRule);
+
+		template <int dim>
+		static const LocalShapeTable<dim>&
+		get_shape_table(ReferenceObjectID roid, const LFEID& id,
+		                size_t quadOrder, QuadType type = BEST)
+			{return get_shape_table<dim>(roid, id, QuadratureRuleProvider<dim>::get(roid, quadOrder, type));}
+	///\}
 };
 
 } // namespace ug
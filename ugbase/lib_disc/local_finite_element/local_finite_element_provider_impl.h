@@ -60,6 +60,15 @@ LocalFiniteElementProvider::lds_map()
 	return map;
 }
 
+template <int dim>
+std::map<LocalFiniteElementProvider::ShapeTableKey<dim>, ConstSmartPtr<LocalShapeTable<dim> > >&
+LocalFiniteElementProvider::shape_table_map()
+{
+	typedef std::map<ShapeTableKey<dim>, ConstSmartPtr<LocalShapeTable<dim> > > Map;
+	static Map map;
+	return map;
+}
+
 template <int dim, typename TShape, typename TGrad>
 void LocalFiniteElementProvider::
 register_set(const LFEID& id,
@@ -161,6 +170,32 @@ get(ReferenceObjectID roid, const LFEID& id, bool bCreate)
 				 " space is defined.)");
 }
 
+template <int dim>
+const LocalShapeTable<dim>&
+LocalFiniteElementProvider::
+get_shape_table(ReferenceObjectID roid, const LFEID& id,
+                const QuadratureRule<dim>& quadRule)
+{
+//	init provider and get map
+	typedef std::map<ShapeTableKey<dim>, ConstSmartPtr<LocalShapeTable<dim> > > Map;
+	Map& map = inst().shape_table_map<dim>();
+
+//	search for table
+	const ShapeTableKey<dim> key(id, roid, &quadRule);
+	typename Map::const_iterator iter = map.find(key);
+	if(iter != map.end()) return *(iter->second);
+
+//	create table
+	ConstSmartPtr<LocalShapeTable<dim> > spTable;
+	try{
+		spTable = make_sp(new LocalShapeTable<dim>(get<dim>(roid, id), quadRule));
+	}UG_CATCH_THROW("LocalFiniteElementProvider: Cannot create shape table for "
+					<<roid<<" and type = "<<id);
+
+	map.insert(typename Map::value_type(key, spTable));
+	return *spTable;
+}
+
 template <int dim>
 ConstSmartPtr<DimLocalDoFSet<dim> >
 LocalFiniteElementProvider::
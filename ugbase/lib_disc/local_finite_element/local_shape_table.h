@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__LOCAL_FINITE_ELEMENT__LOCAL_SHAPE_TABLE__
+#define __H__UG__LIB_DISC__LOCAL_FINITE_ELEMENT__LOCAL_SHAPE_TABLE__
+
+#include <vector>
+
+#include "common/math/ugmath.h"
+#include "lib_disc/local_finite_element/local_shape_function_set.h"
+#include "lib_disc/quadrature/quadrature.h"
+
+namespace ug {
+
+/// \ingroup lib_disc_local_finite_elements
+/// @{
+
+/// table of shape values and local gradients at the points of a quadrature rule
+/**
+ * This class holds the values and the local (reference) gradients of all shape
+ * functions of a LocalShapeFunctionSet evaluated at all points of a quadrature
+ * rule. The values are stored contiguously per integration point (row-major,
+ * size nip x nsh), such that the shapes and gradients at an ip can be passed
+ * as plain arrays. A table is immutable after construction; shared instances
+ * are provided by the LocalFiniteElementProvider. Note, that requesting a
+ * table from the provider is not thread-safe.
+ *
+ * \tparam 	dim		reference element dimension
+ */
+template <int dim>
+class LocalShapeTable
+{
+	public:
+	///	evaluates the shape function set at the quadrature points
+		LocalShapeTable(const LocalShapeFunctionSet<dim>& lsfs,
+		                const QuadratureRule<dim>& quadRule)
+			: m_nip(quadRule.size()), m_nsh(lsfs.num_sh()),
+			  m_vShape(m_nip*m_nsh), m_vGrad(m_nip*m_nsh)
+		{
+			if(m_nsh == 0) return;
+			for(size_t ip = 0; ip < m_nip; ++ip)
+			{
+				lsfs.shapes(&m_vShape[ip*m_nsh], quadRule.point(ip));
+				lsfs.grads(&m_vGrad[ip*m_nsh], quadRule.point(ip));
+			}
+		}
+
+	///	number of integration points
+		size_t num_ip() const {return m_nip;}
+
+	///	number of shape functions
+		size_t num_sh() const {return m_nsh;}
+
+	///	shape value at ip
+		number shape(size_t ip, size_t sh) const
+		{
+			UG_ASSERT(ip < m_nip && sh < m_nsh, "Wrong index");
+			return m_vShape[ip*m_nsh + sh];
+		}
+
+	///	all shape values at ip (size: nsh)
+		const number* shapes(size_t ip) const
+		{
+			UG_ASSERT(ip < m_nip && m_nsh > 0, "Wrong index");
+			return &m_vShape[ip*m_nsh];
+		}
+
+	///	local gradient at ip
+		const MathVector<dim>& local_grad(size_t ip, size_t sh) const
+		{
+			UG_ASSERT(ip < m_nip && sh < m_nsh, "Wrong index");
+			return m_vGrad[ip*m_nsh + sh];
+		}
+
+	///	all local gradients at ip (size: nsh)
+		const MathVector<dim>* local_grads(size_t ip) const
+		{
+			UG_ASSERT(ip < m_nip && m_nsh > 0, "Wrong index");
+			return &m_vGrad[ip*m_nsh];
+		}
+
+	protected:
+	///	number of integration points
+		size_t m_nip;
+
+	///	number of shape functions
+		size_t m_nsh;
+
+	///	shape values (size: nip x nsh)
+		std::vector<number> m_vShape;
+
+	///	local gradients (size: nip x nsh)
+		std::vector<MathVector<dim> > m_vGrad;
+};
+
+/// @}
+
+} // namespace ug
+
+#endif /* __H__UG__LIB_DISC__LOCAL_FINITE_ELEMENT__LOCAL_SHAPE_TABLE__ */
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_LINEAR_OPERATOR__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_LINEAR_OPERATOR__
+
+#include "lib_algebra/operator/interface/operator.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+
+#include "lib_disc/assemble_interface.h"
+
+namespace ug{
+
+///	linear operator applying the jacobian of a discretization without assembling it
+/**
+ * This operator computes d = J(u)*c by evaluating the element-local jacobians
+ * of the discretization on the fly in every application. No global sparse
+ * matrix is stored. Instead, the matrix part of this operator only holds the
+ * (block-)diagonal of J(u), such that smoothers that only access the diagonal
+ * (e.g. Jacobi) can be used as preconditioners. Smoothers accessing the
+ * off-diagonal entries (e.g. ILU, Gauss-Seidel) cannot be used with this
+ * operator.
+ *
+ * Rows of Dirichlet dofs are treated as identity rows, as in the assembled
+ * jacobian. The Dirichlet dofs are collected once in init(). Other
+ * constraints (e.g. hanging nodes) are not supported.
+ *
+ * \tparam	TAlgebra			algebra type
+ */
+template <typename TAlgebra>
+class MatrixFreeLinearOperator :
+	public virtual MatrixOperator<	typename TAlgebra::matrix_type,
+									typename TAlgebra::vector_type>
+{
+	public:
+	///	Type of Algebra
+		typedef TAlgebra algebra_type;
+
+	///	Type of Vector
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Type of Matrix
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Type of base class
+		typedef MatrixOperator<matrix_type,vector_type> base_type;
+
+	public:
+	///	Default Constructor
+		MatrixFreeLinearOperator()
+			: m_spAss(NULL), m_spMask(new vector_type) {};
+
+	///	Constructor
+		MatrixFreeLinearOperator(SmartPtr<IAssemble<TAlgebra> > ass)
+			: m_spAss(ass), m_spMask(new vector_type) {};
+
+	///	Constructor
+		MatrixFreeLinearOperator(SmartPtr<IAssemble<TAlgebra> > ass, const GridLevel& gl)
+			: m_spAss(ass), m_gridLevel(gl), m_spMask(new vector_type) {};
+
+	///	sets the discretization to be used
+		void set_discretization(SmartPtr<IAssemble<TAlgebra> > ass) {m_spAss = ass;}
+
+	///	returns the discretization to be used
+		SmartPtr<IAssemble<TAlgebra> > discretization() {return m_spAss;}
+
+	///	sets the level used for assembling
+		void set_level(const GridLevel& gl) {m_gridLevel = gl;}
+
+	///	returns the level
+		const GridLevel& level() const {return m_gridLevel;}
+
+	///	stores the current solution and assembles the diagonal of J(u)
+		virtual void init(const vector_type& u);
+
+	///	initializes the operator for a linear problem (J evaluated at u = 0)
+		virtual void init();
+
+	///	initializes the operator and assembles the passed rhs vector
+		void init_op_and_rhs(vector_type& b);
+
+	///	returns the mask of the Dirichlet dofs (zero entries), updated in init
+		ConstSmartPtr<vector_type> dirichlet_mask() const {return m_spMask;}
+
+	///	compute d = J(u)*c (matrix-free)
+		virtual void apply(vector_type& d, const vector_type& c);
+
+	///	Compute d := d - J(u)*c (matrix-free)
+		virtual void apply_sub(vector_type& d, const vector_type& c);
+
+	///	Set Dirichlet values
+		void set_dirichlet_values(vector_type& u);
+
+	///	Destructor
+		virtual ~MatrixFreeLinearOperator() {};
+
+	protected:
+	///	assembles the diagonal and the Dirichlet mask for the stored solution
+		void assemble_diagonal();
+
+	///	sets d_i := c_i for the Dirichlet dofs (identity rows)
+		void set_dirichlet_rows(vector_type& d, const vector_type& c) const;
+
+	///	checks storage types and sizes of the vectors
+		void check_vectors(const vector_type& d, const vector_type& c,
+		                   const char* func) const;
+
+	protected:
+	// 	assembling procedure
+		SmartPtr<IAssemble<TAlgebra> > m_spAss;
+
+	// 	DoF Distribution used
+		GridLevel m_gridLevel;
+
+	//	solution the jacobian is evaluated at
+		SmartPtr<vector_type> m_spU;
+
+	//	mask of the Dirichlet dofs (zero for Dirichlet dofs, one else)
+		SmartPtr<vector_type> m_spMask;
+};
+
+} // namespace ug
+
+// include implementation
+#include "matrix_free_linear_operator_impl.h"
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_LINEAR_OPERATOR__ */
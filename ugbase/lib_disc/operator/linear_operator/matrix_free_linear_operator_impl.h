@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_LINEAR_OPERATOR_IMPL__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_LINEAR_OPERATOR_IMPL__
+
+#include "matrix_free_linear_operator.h"
+#include "common/profiler/profiler.h"
+
+namespace ug{
+
+template <typename TAlgebra>
+void
+MatrixFreeLinearOperator<TAlgebra>::init(const vector_type& u)
+{
+	if(m_spAss.invalid())
+		UG_THROW("MatrixFreeLinearOperator: Assembling routine not set.");
+
+//	remember the solution, J(u) is evaluated for it in every application
+	m_spU = u.clone();
+
+	assemble_diagonal();
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeLinearOperator<TAlgebra>::init()
+{
+	vector_type b;
+	init_op_and_rhs(b);
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeLinearOperator<TAlgebra>::init_op_and_rhs(vector_type& b)
+{
+	if(m_spAss.invalid())
+		UG_THROW("MatrixFreeLinearOperator: Assembling routine not set.");
+
+//	assemble rhs, this also provides a correctly sized (zero) solution
+//	the jacobian of the linear problem is evaluated at
+	try{
+		m_spAss->assemble_rhs(b, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeLinearOperator::init_op_and_rhs: Cannot assemble Rhs.");
+
+	m_spU = b.clone_without_values();
+	m_spU->set(0.0);
+
+	assemble_diagonal();
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeLinearOperator<TAlgebra>::assemble_diagonal()
+{
+	PROFILE_FUNC_GROUP("discretization");
+	try{
+		m_spAss->assemble_jacobian_diagonal(*this, *m_spU, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeLinearOperator: Cannot assemble diagonal of Jacobian.");
+
+	try{
+		m_spAss->assemble_dirichlet_mask(*m_spMask, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeLinearOperator: Cannot assemble Dirichlet mask.");
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeLinearOperator<TAlgebra>::
+set_dirichlet_rows(vector_type& d, const vector_type& c) const
+{
+	const vector_type& mask = *m_spMask;
+	for(size_t j = 0; j < mask.size(); ++j)
+		for(size_t alpha = 0; alpha < GetSize(mask[j]); ++alpha)
+			if(BlockRef(mask[j], alpha) == 0.0)
+				BlockRef(d[j], alpha) = BlockRef(c[j], alpha);
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeLinearOperator<TAlgebra>::
+check_vectors(const vector_type& d, const vector_type& c, const char* func) const
+{
+	if(m_spU.invalid())
+		UG_THROW("MatrixFreeLinearOperator::"<<func<<": Operator not initialized.");
+
+#ifdef UG_PARALLEL
+	if(!c.has_storage_type(PST_CONSISTENT))
+		UG_THROW("Inadequate storage format of Vector c.");
+#endif
+
+//	perform check of sizes
+	if(c.size() != this->num_cols() || d.size() != this->num_rows())
+		UG_THROW("MatrixFreeLinearOperator::"<<func<<": Size of operator ["<<
+		        this->num_rows() << " x " << this->num_cols() << "] must match the "
+		        "sizes of vectors x ["<<c.size()<<"], b ["<<d.size()<<"].");
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeLinearOperator<TAlgebra>::apply(vector_type& d, const vector_type& c)
+{
+	PROFILE_FUNC_GROUP("discretization");
+	check_vectors(d, c, "apply");
+
+	try{
+		m_spAss->apply_jacobian(d, c, *m_spU, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeLinearOperator::apply: Cannot apply Jacobian.");
+
+	set_dirichlet_rows(d, c);
+}
+
+//	Compute d := d - J(u)*c
+template <typename TAlgebra>
+void
+MatrixFreeLinearOperator<TAlgebra>::apply_sub(vector_type& d, const vector_type& c)
+{
+	PROFILE_FUNC_GROUP("discretization");
+#ifdef UG_PARALLEL
+	if(!d.has_storage_type(PST_ADDITIVE))
+		UG_THROW("Inadequate storage format of Vector d.");
+#endif
+	check_vectors(d, c, "apply_sub");
+
+	SmartPtr<vector_type> spJc = d.clone_without_values();
+	try{
+		m_spAss->apply_jacobian(*spJc, c, *m_spU, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeLinearOperator::apply_sub: Cannot apply Jacobian.");
+
+	set_dirichlet_rows(*spJc, c);
+
+	VecScaleAdd(d, 1.0, d, -1.0, *spJc);
+}
+
+template <typename TAlgebra>
+void MatrixFreeLinearOperator<TAlgebra>::set_dirichlet_values(vector_type& u)
+{
+//	checks
+	if(m_spAss.invalid())
+		UG_THROW("MatrixFreeLinearOperator: Assembling routine not set.");
+
+//	set dirichlet values etc.
+	try{
+		m_spAss->adjust_solution(u, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeLinearOperator::set_dirichlet_values:"
+				" Cannot assemble solution.");
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_LINEAR_OPERATOR_IMPL__ */
@@ -48,6 +48,7 @@
 #include "lib_algebra/operator/interface/operator.h"
 #include "lib_algebra/operator/preconditioner/jacobi.h"
 #include "lib_algebra/operator/linear_solver/lu.h"
+#include "lib_algebra/algebra_common/rap_product.h"
 #include "lib_disc/dof_manager/dof_distribution.h"
 #include "lib_disc/operator/linear_operator/transfer_interface.h"
 //only for debugging!!!
@@ -151,18 +152,34 @@ class AssembledMultiGridCycle :
 	///	sets if smoothing is performed on surface rim
 		void set_smooth_on_surface_rim(bool bSmooth) {m_bSmoothOnSurfaceRim = bSmooth;}
 
-	///	sets the cycle type (1 = V-cycle, 2 = W-cycle, ...)
+	///	sets the cycle type (1 = V-cycle, 2 = W-cycle, ..., 0 = additive cycle)
 		void set_cycle_type(int type) {m_cycleType = type;}
 
-	///	sets the cycle type (1 = V-cycle, 2 = W-cycle, ...)
+	///	sets the cycle type ("V", "W", "F" or "A" for the additive cycle)
+	/**	The additive cycle restricts the defect to all levels first, then
+	 * computes the level corrections independently of each other (using the
+	 * presmoother on each level and the base solver on the base level) and
+	 * finally sums up the prolongated corrections. This is a BPX-like
+	 * preconditioner and is intended to be used within a krylov method.
+	 * Smoothing on the surface rim is not performed in the additive cycle.
+	 *
+	 * The levels are still processed one after another on each process, and
+	 * the smoothers and transfers keep their own (horizontal and vertical)
+	 * communication per level. Thus, the additive cycle does not execute the
+	 * levels concurrently and does not reduce the number of synchronisations
+	 * per cycle compared to the V-cycle.*/
 		void set_cycle_type(const std::string& type) {
 			if(TrimString(type) == "V") {m_cycleType = _V_;}
 			else if(TrimString(type) == "W") {m_cycleType = _W_;}
 			else if(TrimString(type) == "F") {m_cycleType = _F_;}
+			else if(TrimString(type) == "A") {m_cycleType = _A_;}
 			else {UG_THROW("GMG::set_cycle_type: option '"<<type<<"' not supported.");}
 		}
 
 	///	sets if communication and computation should be overlaped
+	/**	If set, the vertical communication of the ghost matrices (RAP), of the
+	 * defect before restriction and of the prolongated correction is started
+	 * non-blocking and completed after independent computations.*/
 		void set_comm_comp_overlap(bool bOverlap) {m_bCommCompOverlap = bOverlap;}
 
 	///	sets the number of pre-smoothing steps to be performed
@@ -272,14 +289,34 @@ class AssembledMultiGridCycle :
  	/// compute correction on level and update defect
 		void lmgc(int lev, int cycleType);
 
+	/// compute correction by an additive cycle over all levels
+		void additive_cycle();
+
 	////////////////////////////////////////////////////////////////
 	//	The methods in this section rely on each other and should be called in sequence
 	///	performs presmoothing on the given level
 		void presmooth_and_restriction(int lev);
 
+	///	smoothes the defect on the given level and adds to the level correction
+	/**	The correction of the last smoothing step is added by restriction()
+	 * (overlapped with the communication) or by the additive cycle.*/
+		void presmooth(int lev);
+
+	///	restricts the defect to the level below and resets its correction
+		void restriction(int lev);
+
+	///	adds the coarse correction to the surface and updates the rim defect (adaptive case)
+		void add_coarse_correction_to_surface(int lev);
+
 	///	performs prolongation to the level above
 		void prolongation_and_postsmooth(int lev);
 
+	///	prolongates the correction from the level below and adds it
+		void prolongation(int lev);
+
+	///	smoothes the defect on the given level after prolongation
+		void postsmooth(int lev);
+
 	///	compute base solver
 		void base_solve(int lev);
 	//	end of section
@@ -334,11 +371,12 @@ class AssembledMultiGridCycle :
 	///	base level (where exact inverse is computed)
 		int m_baseLev;
 
-	///	cylce type (1 = V-cycle, 2 = W-cylcle, ...)
+	///	cylce type (1 = V-cycle, 2 = W-cylcle, ..., 0 = additive cycle)
 		int m_cycleType;
 		static const int _V_ = 1;
 		static const int _W_ = 2;
 		static const int _F_ = -1;
+		static const int _A_ = 0;
 
 	///	number of Presmooth steps
 		int m_numPreSmooth;
@@ -450,6 +488,9 @@ class AssembledMultiGridCycle :
 
 		///	missing coarse grid correction
 			matrix_type RimCpl_Coarse_Fine;
+
+		///	pattern of the galerkin product computing A from the finer level
+			RAPProduct<matrix_type> RAP;
 			
 		/// debugging output information (number of calls of the pre-, postsmoothers, base solver etc)
 			int n_pre_calls, n_post_calls, n_base_calls, n_restr_calls, n_prolong_calls;
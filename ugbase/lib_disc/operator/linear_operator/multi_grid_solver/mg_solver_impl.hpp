@@ -236,7 +236,8 @@ apply(vector_type& rC, const vector_type& rD)
 
 	//	start mg-cycle
 		GMG_PROFILE_BEGIN(GMG_Apply_lmgc);
-		lmgc(m_topLev, m_cycleType);
+		if(m_cycleType == _A_) additive_cycle();
+		else lmgc(m_topLev, m_cycleType);
 		GMG_PROFILE_END();
 
 	//	project top lev to surface
@@ -955,8 +956,9 @@ init_rap_operator()
 		}
 		#endif
 
+	//	the pattern of the product is kept, if the matrix structure is const
 		GMG_PROFILE_BEGIN(GMG_BuildRAP_MultiplyRAP);
-		AddMultiplyOf(*lc.A, *R, *spA, *P);
+		lc.RAP.add_product(*lc.A, *R, *spA, *P, m_bMatrixStructureIsConst);
 		GMG_PROFILE_END();
 		UG_DLOG(LIB_DISC_MULTIGRID, 4, "  end   init_rap_operator: build rap on lev "<<lev<<"\n");
 	}
@@ -1685,6 +1687,14 @@ gathered_base_master() const
 template <typename TDomain, typename TAlgebra>
 void AssembledMultiGridCycle<TDomain, TAlgebra>::
 presmooth_and_restriction(int lev)
+{
+	presmooth(lev);
+	restriction(lev);
+}
+
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+presmooth(int lev)
 {
 	GMG_PROFILE_FUNC();
 	LevData& lf = *m_vLevData[lev];
@@ -1706,8 +1716,9 @@ presmooth_and_restriction(int lev)
 				UG_THROW("GMG: Smoothing step "<<nu+1<<" on level "<<lev<<" failed.");
 			leave_debug_writer_section(gw_gl);
 
-		//	b) handle patch rim.
-			if(!m_bSmoothOnSurfaceRim){
+		//	b) handle patch rim. In the additive cycle the coarse defect has
+		//	   already been restricted, thus the rim is not smoothed there.
+			if(!m_bSmoothOnSurfaceRim || m_cycleType == _A_){
 				const std::vector<size_t>& vShadowing = lf.vShadowing;
 				for(size_t i = 0; i < vShadowing.size(); ++i)
 					(*lf.st)[ vShadowing[i] ] = 0.0;
@@ -1737,6 +1748,15 @@ presmooth_and_restriction(int lev)
 	log_debug_data(lev, lf.n_restr_calls, "AfterPreSmooth_BeforeCom");
 	mg_stats_defect(*lf.sd, lev, mg_stats_type::AFTER_PRE_SMOOTH);
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - presmooth on level "<<lev<<"\n");
+}
+
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+restriction(int lev)
+{
+	GMG_PROFILE_FUNC();
+	LevData& lf = *m_vLevData[lev];
+	LevData& lc = *m_vLevData[lev-1];
 
 //	PARALLEL CASE:
 	SmartPtr<GF> spD = lf.sd;
@@ -1779,8 +1799,8 @@ presmooth_and_restriction(int lev)
 //	reset corr on coarse level
 	lc.sc->set(0.0);
 
-//	update last correction
-	if(m_numPreSmooth > 0)
+//	update last correction (the additive cycle smoothes after restriction)
+	if(m_numPreSmooth > 0 && m_cycleType != _A_)
 		(*lf.sc) += (*lf.st);
 	GMG_PROFILE_END();
 
@@ -1817,15 +1837,11 @@ presmooth_and_restriction(int lev)
 
 template <typename TDomain, typename TAlgebra>
 void AssembledMultiGridCycle<TDomain, TAlgebra>::
-prolongation_and_postsmooth(int lev)
+add_coarse_correction_to_surface(int lev)
 {
-	GMG_PROFILE_FUNC();
 	LevData& lf = *m_vLevData[lev];
 	LevData& lc = *m_vLevData[lev-1];
 
-	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - prolongation on level "<<lev<<"\n");
-	log_debug_data(lev, lf.n_prolong_calls, "BeforeProlong");
-
 //	ADAPTIVE CASE:
 	if(lev > m_LocalFullRefLevel)
 	{
@@ -1849,17 +1865,43 @@ prolongation_and_postsmooth(int lev)
 		GMG_PROFILE_END();
 	}
 	log_debug_data(lev, lf.n_prolong_calls, "AfterCoarseGridDefect");
+}
 
-//	PROLONGATE:
-	GridLevel gw_gl; enter_debug_writer_section(gw_gl, "Prolongation", lev, lf.n_prolong_calls);
-	SmartPtr<GF> spT = lf.st;
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+prolongation_and_postsmooth(int lev)
+{
+	prolongation(lev);
+	postsmooth(lev);
+}
+
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+prolongation(int lev)
+{
+	GMG_PROFILE_FUNC();
+	LevData& lf = *m_vLevData[lev];
+	LevData& lc = *m_vLevData[lev-1];
+
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - prolongation on level "<<lev<<"\n");
+	log_debug_data(lev, lf.n_prolong_calls, "BeforeProlong");
+
+//	if there are vertical interfaces, the prolongated correction is copied to
+//	the v-slaves. When overlapping, this is done while the coarse correction is
+//	added to the surface, since that does neither read nor write lf.t.
+	bool bVertCom = false;
 	#ifdef UG_PARALLEL
-	if( !lf.t->layouts()->vertical_slave().empty() ||
-		!lf.t->layouts()->vertical_master().empty())
-	{
-		spT = lf.t;
-	}
+	bVertCom = !lf.t->layouts()->vertical_slave().empty() ||
+				!lf.t->layouts()->vertical_master().empty();
 	#endif
+	const bool bOverlap = m_bCommCompOverlap && bVertCom;
+
+	if(!bOverlap)
+		add_coarse_correction_to_surface(lev);
+
+//	PROLONGATE:
+	GridLevel gw_gl; enter_debug_writer_section(gw_gl, "Prolongation", lev, lf.n_prolong_calls);
+	SmartPtr<GF> spT = bVertCom ? lf.t : lf.st;
 	GMG_PROFILE_BEGIN(GMG_Prolongate_Transfer);
 	try{
 		lf.Prolongation->prolongate(*spT, *lc.sc);
@@ -1869,8 +1911,7 @@ prolongation_and_postsmooth(int lev)
 
 //	PARALLEL CASE:
 #ifdef UG_PARALLEL
-	if( !lf.t->layouts()->vertical_slave().empty() ||
-		!lf.t->layouts()->vertical_master().empty())
+	if(bVertCom)
 	{
 		UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - copy_to_vertical_slaves\n");
 
@@ -1881,7 +1922,17 @@ prolongation_and_postsmooth(int lev)
 		ComPol_VecCopy<vector_type> cpVecCopy(lf.t.get());
 		m_Com.receive_data(lf.t->layouts()->vertical_slave(), cpVecCopy);
 		m_Com.send_data(lf.t->layouts()->vertical_master(), cpVecCopy);
-		m_Com.communicate();
+		m_Com.communicate_and_resume();
+		GMG_PROFILE_END();
+
+		if(bOverlap){
+			GMG_PROFILE_BEGIN(GMG_Prolongate_OverlapedComputation);
+			add_coarse_correction_to_surface(lev);
+			GMG_PROFILE_END();
+		}
+
+		GMG_PROFILE_BEGIN(GMG_Prolongate_RecieveAndExtract);
+		m_Com.wait();
 		GMG_PROFILE_END();
 
 		GMG_PROFILE_BEGIN(GMG_Prolongate_GhostToNoghost);
@@ -1906,6 +1957,16 @@ prolongation_and_postsmooth(int lev)
 	GMG_PROFILE_END();
 
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - prolongation on level "<<lev<<"\n");
+}
+
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+postsmooth(int lev)
+{
+	GMG_PROFILE_FUNC();
+	LevData& lf = *m_vLevData[lev];
+	LevData& lc = *m_vLevData[lev-1];
+
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - postsmooth on level "<<lev<<"\n");
 	// log_debug_data(lev, lf.n_prolong_calls, "BeforePostSmooth");
 
@@ -2135,6 +2196,57 @@ lmgc(int lev, int cycleType)
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - lmgc on level "<<lev<<"\n");
 }
 
+// performs an additive multi grid cycle on all levels
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+additive_cycle()
+{
+	GMG_PROFILE_FUNC();
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - additive cycle\n");
+
+//	restrict the unsmoothed defect down to the base level
+	for(int lev = m_topLev; lev > m_baseLev; --lev)
+	{
+		try{
+			restriction(lev);
+		}
+		UG_CATCH_THROW("GMG::additive_cycle: restriction failed on level "<<lev);
+	}
+
+//	compute the corrections of all levels. Those only depend on the restricted
+//	defect of the level, but not on the correction of any other level.
+//	NOTE: The levels are processed in sequence, each smoother communicating
+//		  on its own level. Merging these communications is not implemented.
+	for(int lev = m_topLev; lev > m_baseLev; --lev)
+	{
+		try{
+			presmooth(lev);
+		}
+		UG_CATCH_THROW("GMG::additive_cycle: smoothing failed on level "<<lev);
+
+	//	update last correction
+		LevData& lf = *m_vLevData[lev];
+		if(m_numPreSmooth > 0)
+			(*lf.sc) += (*lf.st);
+	}
+
+	try{
+		base_solve(m_baseLev);
+	}
+	UG_CATCH_THROW("GMG::additive_cycle: base solver failed on level "<<m_baseLev);
+
+//	sum up the corrections from base to top level
+	for(int lev = m_baseLev+1; lev <= m_topLev; ++lev)
+	{
+		try{
+			prolongation(lev);
+		}
+		UG_CATCH_THROW("GMG::additive_cycle: prolongation failed on level "<<lev);
+	}
+
+	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - additive cycle\n");
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Debug Methods
 ////////////////////////////////////////////////////////////////////////////////
@@ -2310,6 +2422,7 @@ config_string() const
 	if(m_cycleType == _V_) ss << "V-Cycle";
 	else if(m_cycleType == _W_) ss << "W-Cycle";
 	else if(m_cycleType == _F_) ss << "F-Cycle";
+	else if(m_cycleType == _A_) ss << "Additive-Cycle";
 	else ss << " " << m_cycleType << "-Cycle";
 	ss << ")\n";
 
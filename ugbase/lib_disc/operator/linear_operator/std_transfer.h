@@ -52,6 +52,11 @@ namespace ug{
  * This optimization is only valid if all elements have been refined with
  * standard refinement rules. If closure elements are generated, this optimization
  * has to be deactivated (use StdTransfer::enable_p1_lagrange_optimization(false)).
+ *
+ * The prolongation and restriction matrices are cached per level pair and
+ * frozen (see SparseMatrix::freeze). Applying a transfer is then a gather over
+ * the plain CRS rows of the cached matrix, executed multithreaded for
+ * sufficiently many rows.
  */
 template <typename TDomain, typename TAlgebra>
 class StdTransfer :
@@ -656,6 +656,9 @@ prolongation(const GridLevel& fineGL, const GridLevel& coarseGL,
 		P->set_storage_type(PST_CONSISTENT);
 		#endif
 
+	//	the pattern is final: store in plain CRS format for the transfer kernels
+		P->freeze();
+
 		write_debug(*P, "P", fineGL, coarseGL);
 	}
 
@@ -710,6 +713,9 @@ restriction(const GridLevel& coarseGL, const GridLevel& fineGL,
 			}
 		}
 
+	//	the pattern is final: store in plain CRS format for the transfer kernels
+		R->freeze();
+
 		write_debug(*R, "R", coarseGL, fineGL);
 	}
 
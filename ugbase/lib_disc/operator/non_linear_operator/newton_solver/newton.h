@@ -81,7 +81,7 @@ class NewtonSolver
 		             SmartPtr<ILineSearch<vector_type> > spLineSearch);
 
 	///	sets the linear solver
-		void set_linear_solver(SmartPtr<ILinearOperatorInverse<vector_type> > LinearSolver) {m_spLinearSolver = LinearSolver;}
+		void set_linear_solver(SmartPtr<ILinearOperatorInverse<vector_type> > LinearSolver) {m_spLinearSolver = LinearSolver; m_bJacobianValid = false;}
 
 	/// sets the convergence check
 		void set_convergence_check(SmartPtr<IConvergenceCheck<vector_type> > spConvCheck);
@@ -123,6 +123,7 @@ class NewtonSolver
 		int total_linsolver_steps() const;
 		double total_average_linear_steps() const;
 		int last_num_newton_steps() const	{return m_lastNumSteps;}
+		int last_num_jacobian_assemblies() const	{return m_lastNumJacobians;}
 	/// \}
 
 	/// resets average linear solver convergence
@@ -148,6 +149,15 @@ class NewtonSolver
 		void set_reassemble_J_freq(int freq)
 			{m_reassembe_J_freq = freq;};
 
+	///	sets if the Jacobian and the linear solver of the last call are reused in the first step
+	/**	This is useful if a sequence of similar problems is solved, e.g. time
+	 * steps of (nearly) the same size. The assembled Jacobian is not touched
+	 * between calls, thus the first step is a simplified newton step.*/
+		void set_reuse_jacobian(bool bReuse) {m_bReuseJacobian = bReuse;}
+
+	///	forces the reassembling of the Jacobian in the next call
+		void invalidate_jacobian() {m_bJacobianValid = false;}
+
 	private:
 	///	help functions for debug output
 	///	\{
@@ -178,9 +188,15 @@ class NewtonSolver
 	/// how often to reassemble the Jacobian (0 == 1 == in every step, i.e. classically)
 		int m_reassembe_J_freq;
 
+	///	reuse of the Jacobian from the last call
+		bool m_bReuseJacobian;
+	///	flag indicating that Jacobian and linear solver are initialized
+		bool m_bJacobianValid;
+
 	///	call counter
 		int m_dgbCall;
 		int m_lastNumSteps;
+		int m_lastNumJacobians;
 
 	/// convergence history of linear solver
 	/// \{
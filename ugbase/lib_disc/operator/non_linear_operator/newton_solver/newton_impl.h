@@ -65,8 +65,11 @@ NewtonSolver(SmartPtr<ILinearOperatorInverse<vector_type> > LinearSolver,
 			m_J(NULL),
 			m_spAss(NULL),
 			m_reassembe_J_freq(0),
+			m_bReuseJacobian(false),
+			m_bJacobianValid(false),
 			m_dgbCall(0),
-			m_lastNumSteps(0)
+			m_lastNumSteps(0),
+			m_lastNumJacobians(0)
 {};
 
 template <typename TAlgebra>
@@ -79,8 +82,11 @@ NewtonSolver() :
 	m_J(NULL),
 	m_spAss(NULL),
 	m_reassembe_J_freq(0),
+	m_bReuseJacobian(false),
+	m_bJacobianValid(false),
 	m_dgbCall(0),
-	m_lastNumSteps(0)
+	m_lastNumSteps(0),
+	m_lastNumJacobians(0)
 {};
 
 template <typename TAlgebra>
@@ -93,8 +99,11 @@ NewtonSolver(SmartPtr<IOperator<vector_type> > N) :
 	m_J(NULL),
 	m_spAss(NULL),
 	m_reassembe_J_freq(0),
+	m_bReuseJacobian(false),
+	m_bJacobianValid(false),
 	m_dgbCall(0),
-	m_lastNumSteps(0)
+	m_lastNumSteps(0),
+	m_lastNumJacobians(0)
 {
 	init(N);
 };
@@ -109,8 +118,11 @@ NewtonSolver(SmartPtr<IAssemble<TAlgebra> > spAss) :
 	m_J(NULL),
 	m_spAss(NULL),
 	m_reassembe_J_freq(0),
+	m_bReuseJacobian(false),
+	m_bJacobianValid(false),
 	m_dgbCall(0),
-	m_lastNumSteps(0)
+	m_lastNumSteps(0),
+	m_lastNumJacobians(0)
 {
 	m_spAss = spAss;
 	m_N = SmartPtr<AssembledOperator<TAlgebra> >(new AssembledOperator<TAlgebra>(m_spAss));
@@ -159,6 +171,7 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 //	Jacobian
 	if(m_J.invalid() || m_J->discretization() != m_spAss) {
 		m_J = make_sp(new AssembledLinearOperator<TAlgebra>(m_spAss));
+		m_bJacobianValid = false;
 	}
 	m_J->set_level(m_N->level());
 
@@ -182,6 +195,7 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 //	loop counts (for the the convergence rate statistics etc.)
 	int loopCnt = 0;
 	m_lastNumSteps = 0;
+	m_lastNumJacobians = 0;
 	
 //	write start defect for debug
 	char debug_name_ext[20];
@@ -219,12 +233,17 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 		for(size_t i = 0; i < m_innerStepUpdate.size(); ++i)
 			m_innerStepUpdate[i]->update();
 
+	//	in the first step, the Jacobian and the linear solver of the last call may be reused
+		const bool bReuseJ = (loopCnt == 0) && m_bReuseJacobian && m_bJacobianValid;
+
 	// 	Compute Jacobian
 		try{
-			if(m_reassembe_J_freq == 0 || loopCnt % m_reassembe_J_freq == 0) // if we need to reassemble
+			if(!bReuseJ && (m_reassembe_J_freq == 0 || loopCnt % m_reassembe_J_freq == 0)) // if we need to reassemble
 			{
 				NEWTON_PROFILE_BEGIN(NewtonComputeJacobian);
+				m_bJacobianValid = false;
 				m_J->init(u);
+				m_lastNumJacobians++;
 				NEWTON_PROFILE_END();
 			}
 		}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Jacobian failed.");
@@ -237,16 +256,20 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 		}
 
 	// 	Init Jacobi Inverse
-		try{
-			NEWTON_PROFILE_BEGIN(NewtonPrepareLinSolver);
-			if(!m_spLinearSolver->init(m_J, u))
-			{
-				UG_LOG("ERROR in 'NewtonSolver::apply': Cannot init Inverse Linear "
-						"Operator for Jacobi-Operator.\n");
-				return false;
-			}
-			NEWTON_PROFILE_END();
-		}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Linear Solver failed.");
+		if(!bReuseJ)
+		{
+			try{
+				NEWTON_PROFILE_BEGIN(NewtonPrepareLinSolver);
+				if(!m_spLinearSolver->init(m_J, u))
+				{
+					UG_LOG("ERROR in 'NewtonSolver::apply': Cannot init Inverse Linear "
+							"Operator for Jacobi-Operator.\n");
+					return false;
+				}
+				NEWTON_PROFILE_END();
+			}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Linear Solver failed.");
+			m_bJacobianValid = true;
+		}
 
 	// 	Solve Linearized System
 		try{
@@ -449,6 +472,7 @@ std::string NewtonSolver<TAlgebra>::config_string() const
 	if(m_spLineSearch.valid())		ss << ConfigShift(m_spLineSearch->config_string()) << "\n";
 	else							ss << " not set.\n";
 	if(m_reassembe_J_freq != 0)		ss << " Reassembling Jacobian only once per " << m_reassembe_J_freq << " step(s)\n";
+	if(m_bReuseJacobian)			ss << " Reusing Jacobian of previous call in first step\n";
 	return ss.str();
 }
 
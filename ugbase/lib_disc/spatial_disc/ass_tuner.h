@@ -33,6 +33,8 @@
 #ifndef __H__UG__LIB_DISC__SPATIAL_DISC__ASS_TUNER__
 #define __H__UG__LIB_DISC__SPATIAL_DISC__ASS_TUNER__
 
+#include <map>
+
 #include "lib_grid/tools/bool_marker.h"
 #include "lib_grid/tools/selector_grid.h"
 #include "lib_disc/spatial_disc/local_to_global/local_to_global_mapper.h"
@@ -82,6 +84,15 @@ class LocalToGlobalMapper
 	///	adds a local matrix to the global one
 		void add_local_mat_to_global(matrix_type& mat, const LocalMatrix& lmat) const
 			{ AddLocalMatrixToGlobal(mat, lmat);}
+
+	///	adds the product of a local matrix and a local vector to the global vector
+		void add_local_mat_vec_to_global(vector_type& vec, const LocalMatrix& lmat,
+		                                 const LocalVector& lvec) const
+			{ AddLocalMatVecToGlobal(vec, lmat, lvec);}
+
+	///	adds the (block-)diagonal of a local matrix to the global one
+		void add_local_mat_diag_to_global(matrix_type& mat, const LocalMatrix& lmat) const
+			{ AddLocalMatrixDiagToGlobal(mat, lmat);}
 };
 
 /// The AssemblingTuner class combines tools to adapt the assembling routine.
@@ -107,7 +118,10 @@ class AssemblingTuner
 		m_bSingleAssIndex(false), m_SingleAssIndex(0),
 		m_bForceRegGrid(false), m_bModifySolutionImplemented(false),
 		m_ConstraintTypesEnabled(CT_ALL), m_ElemTypesEnabled(EDT_ALL),
-		m_bMatrixIsConst(false), m_bMatrixStructureIsConst(false), m_bClearOnResize(true) {}
+		m_bMatrixIsConst(false), m_bMatrixStructureIsConst(false), m_bClearOnResize(true),
+		m_pScatterMat(NULL), m_pScatterPosMat(NULL), m_scatterCursor(0),
+		m_bIncJacobian(false), m_incJacTol(0.0), m_pIncJacStream(NULL),
+		m_numIncJacReused(0), m_numIncJacComputed(0) {}
 
 	/// destructor
 		virtual ~AssemblingTuner() {}
@@ -118,6 +132,9 @@ class AssemblingTuner
 			m_pMapper = pMapper;
 		}
 
+	///	returns if a custom local to global mapping is set
+		bool mapping_set() const {return m_pMapper != nullptr;}
+
 	/// LocalToGlobalMapper-function calls
 		void add_local_vec_to_global(vector_type& vec, const LocalVector& lvec,
 		                 ConstSmartPtr<DoFDistribution> dd) const
@@ -133,10 +150,31 @@ class AssemblingTuner
 		{
 			if (m_pMapper)
 				m_pMapper->add_local_mat_to_global(mat, lmat, dd);
+			else if (m_pScatterMat == &mat)
+				AddLocalMatrixToGlobal(mat, lmat, m_vScatterPos, m_scatterCursor);
 			else
 				m_defaultMapper.add_local_mat_to_global(mat, lmat);
 		}
 
+		void add_local_mat_vec_to_global(vector_type& vec, const LocalMatrix& lmat,
+		                                 const LocalVector& lvec,
+		                                 ConstSmartPtr<DoFDistribution> dd) const
+		{
+			if (m_pMapper)
+				UG_THROW("AssemblingTuner: Matrix-free application not "
+						"supported with a custom local-to-global mapping.");
+			m_defaultMapper.add_local_mat_vec_to_global(vec, lmat, lvec);
+		}
+
+		void add_local_mat_diag_to_global(matrix_type& mat, const LocalMatrix& lmat,
+		                                  ConstSmartPtr<DoFDistribution> dd) const
+		{
+			if (m_pMapper)
+				UG_THROW("AssemblingTuner: Diagonal assembling not "
+						"supported with a custom local-to-global mapping.");
+			m_defaultMapper.add_local_mat_diag_to_global(mat, lmat);
+		}
+
 		void modify_LocalSol(LocalVector& vecMod, const LocalVector& lvec,
 		                         ConstSmartPtr<DoFDistribution> dd) const
 		{
@@ -221,6 +259,12 @@ class AssemblingTuner
 		void resize(ConstSmartPtr<DoFDistribution> dd, vector_type& vec) const;
 		void resize(ConstSmartPtr<DoFDistribution> dd, matrix_type& mat) const;
 
+	protected:
+	///	creates the sparsity pattern of all couplings of the DoFDistribution
+		void create_pattern(ConstSmartPtr<DoFDistribution> dd, matrix_type& mat) const;
+
+	public:
+
 	///	gets the element iterator from the Selector
 		template <typename TElem>
 		void collect_selected_elements(std::vector<TElem*>& vElem, ConstSmartPtr<DoFDistribution> dd, int si) const;
@@ -250,8 +294,20 @@ class AssemblingTuner
 	 */
 		void set_matrix_is_const(bool bCh) {m_bMatrixIsConst = bCh;}
 
+	/**
+	 * specify whether the sparsity pattern of the matrix stays the same for
+	 * all assemblings. If set, an empty matrix gets the full pattern of the
+	 * DoFDistribution on resize, and the positions of the local entries in
+	 * the global matrix are cached during the assembling, so that further
+	 * assemblings add the local matrices without searching the matrix rows.
+	 *
+	 * @param b set true if the sparsity pattern does not change
+	 */
 		void set_matrix_structure_is_const(bool b) {m_bMatrixStructureIsConst = b;}
 
+	///	returns if the sparsity pattern of the matrix is kept between assemblings
+		bool matrix_structure_is_const() const {return m_bMatrixStructureIsConst;}
+
 	/**
 	 * whether matrix is to be modified by assembling
 	 *
@@ -259,6 +315,73 @@ class AssemblingTuner
 	 */
 		bool matrix_is_const() const {return m_bMatrixIsConst;}
 
+	/**
+	 * enables the incremental assembling of the Jacobian. If set, the local
+	 * solution and the local Jacobian of each element are stored when the
+	 * Jacobian is assembled. In subsequent assemblings, the stored local
+	 * Jacobian is added again for all elements whose local solution differs
+	 * by at most tol (maximum norm) from the stored one, i.e. only elements
+	 * with changed DoFs are recomputed. All stored contributions are
+	 * discarded if the time point or the scaling of the stiffness part
+	 * changes (i.e. for every new time step or stage), and elements are
+	 * recomputed if the order of traversal changes.
+	 *
+	 * This assumes, that the element contributions only depend on the local
+	 * solution (and, in the instationary case, on the time point and the
+	 * previous solutions). If other parameters of the discretization are
+	 * changed, invalidate_incremental_jacobian() must be called.
+	 *
+	 * @param bEnable	flag if incremental assembling is used
+	 * @param tol		tolerance for the change of the local solution
+	 */
+		void set_incremental_jacobian(bool bEnable, number tol)
+		{
+			m_bIncJacobian = bEnable; m_incJacTol = tol;
+			invalidate_incremental_jacobian();
+		}
+
+	///	returns if the Jacobian is assembled incrementally
+		bool incremental_jacobian_enabled() const {return m_bIncJacobian;}
+
+	///	discards all stored local Jacobians, i.e. forces a full reassembling
+		void invalidate_incremental_jacobian() const
+		{
+			m_mIncJacStream.clear(); m_pIncJacStream = NULL;
+		}
+
+	///	returns the number of reused (resp. recomputed) local Jacobians in the last assembling
+	///	\{
+		size_t num_incremental_jacobian_reused() const {return m_numIncJacReused;}
+		size_t num_incremental_jacobian_computed() const {return m_numIncJacComputed;}
+	///	\}
+
+	///	selects the stored local Jacobians for the assembling of elements
+	/**
+	 * Must be called before the element loop of the Jacobian assembling.
+	 * If the time point or the scaling differs from those of the stored
+	 * contributions, these are discarded.
+	 *
+	 * @param dd			DoF distribution
+	 * @param bInstationary	flag if instationary Jacobian is assembled
+	 * @param time			time point
+	 * @param s_a0			scaling of the stiffness part
+	 */
+		void prepare_incremental_jacobian(ConstSmartPtr<DoFDistribution> dd,
+		                                  bool bInstationary, number time,
+		                                  number s_a0) const;
+
+	///	copies the stored local Jacobian of an element, if it can be reused
+	/**
+	 * @return true if the stored local Jacobian is copied to locJ, false if
+	 * 		   the local Jacobian must be computed (and stored afterwards).
+	 */
+		bool reuse_local_jacobian(GridObject* elem, const LocalVector& locU,
+		                          LocalMatrix& locJ) const;
+
+	///	stores the local Jacobian of an element
+		void store_local_jacobian(GridObject* elem, const LocalVector& locU,
+		                          const LocalMatrix& locJ) const;
+
 	protected:
 	///	default LocalToGlobalMapper
 		LocalToGlobalMapper<TAlgebra> m_defaultMapper;
@@ -297,6 +420,61 @@ class AssemblingTuner
 
 	/// disables clearing of vector/matrix on resize
 		bool m_bClearOnResize;
+
+	///	matrix currently assembled using the scatter cache (NULL if not used)
+		mutable const matrix_type* m_pScatterMat;
+
+	///	matrix the cached scatter positions refer to
+		mutable const matrix_type* m_pScatterPosMat;
+
+	///	cached positions of the local matrix entries in the global matrix
+		mutable std::vector<int> m_vScatterPos;
+
+	///	current position in the scatter cache
+		mutable size_t m_scatterCursor;
+
+	///	stored local solutions and local Jacobians of the elements of one
+	///	DoF distribution in the order of traversal
+		struct IncJacobianStream
+		{
+			IncJacobianStream()
+				: bInstationary(false), time(0.0), s_a0(0.0), cursor(0)
+			{
+				vOffset.push_back(0);
+			}
+
+		///	time stepping setting the Jacobians have been computed for
+			bool bInstationary;
+			number time;
+			number s_a0;
+
+		///	elements, number of local dofs and offset of their values
+			std::vector<GridObject*> vElem;
+			std::vector<size_t> vNumDoF;
+			std::vector<size_t> vOffset;
+
+		///	local solution followed by local Jacobian for each element
+			std::vector<number> vValue;
+
+		///	current position in the stream
+			size_t cursor;
+		};
+
+	///	flag if the Jacobian is assembled incrementally
+		bool m_bIncJacobian;
+
+	///	tolerance for the change of the local solution
+		number m_incJacTol;
+
+	///	stored local Jacobians per DoF distribution
+		mutable std::map<const DoFDistribution*, IncJacobianStream> m_mIncJacStream;
+
+	///	stream used in the current assembling
+		mutable IncJacobianStream* m_pIncJacStream;
+
+	///	statistics of the last assembling
+		mutable size_t m_numIncJacReused;
+		mutable size_t m_numIncJacComputed;
 };
 
 } // end namespace ug
@@ -33,6 +33,8 @@
 #ifndef __H__UG__LIB_DISC__SPATIAL_DISC__ASS_TUNER_IMPL__
 #define __H__UG__LIB_DISC__SPATIAL_DISC__ASS_TUNER_IMPL__
 
+#include <algorithm>
+#include <cmath>
 #include "ass_tuner.h"
 
 namespace ug{
@@ -55,6 +57,13 @@ template <typename TAlgebra>
 void AssemblingTuner<TAlgebra>::resize(ConstSmartPtr<DoFDistribution> dd,
 								  matrix_type& mat) const
 {
+//	the scatter cache is only used for a constant matrix structure
+	m_pScatterMat = NULL;
+
+//	the next Jacobian assembling starts a new pass through the stored
+//	local Jacobians
+	m_pIncJacStream = NULL;
+
 	if (single_index_assembling_enabled())
 	{
 		if (m_bClearOnResize) mat.resize_and_clear(1, 1);
@@ -67,10 +76,19 @@ void AssemblingTuner<TAlgebra>::resize(ConstSmartPtr<DoFDistribution> dd,
 		{
 			if (m_bMatrixStructureIsConst)
 			{
+			//	the first assembling creates the pattern
+				if (mat.num_rows() == 0 && mat.num_cols() == 0)
+					create_pattern(dd, mat);
+
 				UG_COND_THROW(mat.num_rows() != dd->num_indices() || mat.num_cols() != dd->num_indices(),
 					"The assembling tuner is set to use a constant matrix structure, "
 					"but the number of indices in the new matrix is different from that in the old one.");
 				mat.clear_retain_structure();
+
+			//	start a new pass through the scatter cache
+				if (&mat != m_pScatterPosMat) m_vScatterPos.clear();
+				m_pScatterMat = m_pScatterPosMat = &mat;
+				m_scatterCursor = 0;
 			}
 			else
 				mat.resize_and_clear(numIndex, numIndex);
@@ -80,6 +98,140 @@ void AssemblingTuner<TAlgebra>::resize(ConstSmartPtr<DoFDistribution> dd,
 	}
 }
 
+template <typename TAlgebra>
+void AssemblingTuner<TAlgebra>::
+prepare_incremental_jacobian(ConstSmartPtr<DoFDistribution> dd,
+                             bool bInstationary, number time, number s_a0) const
+{
+	IncJacobianStream& stream = m_mIncJacStream[dd.get()];
+
+//	a new pass starts, if another stream has been used before
+	if(m_pIncJacStream != &stream){
+		m_pIncJacStream = &stream;
+		stream.cursor = 0;
+		m_numIncJacReused = m_numIncJacComputed = 0;
+	}
+
+//	contributions for another time point are invalid
+	if(stream.bInstationary != bInstationary || stream.time != time
+		|| stream.s_a0 != s_a0)
+	{
+		stream.bInstationary = bInstationary;
+		stream.time = time;
+		stream.s_a0 = s_a0;
+		stream.vElem.clear();
+		stream.vNumDoF.clear();
+		stream.vOffset.resize(1);
+		stream.vValue.clear();
+		stream.cursor = 0;
+	}
+}
+
+template <typename TAlgebra>
+bool AssemblingTuner<TAlgebra>::
+reuse_local_jacobian(GridObject* elem, const LocalVector& locU,
+                     LocalMatrix& locJ) const
+{
+	UG_ASSERT(m_pIncJacStream != NULL, "Incremental Jacobian not prepared.");
+	IncJacobianStream& stream = *m_pIncJacStream;
+
+//	check that the element has been stored at the current position
+	const size_t k = stream.cursor;
+	const size_t n = locU.num_all_values();
+	if(n == 0) return false;
+	if(k >= stream.vElem.size() || stream.vElem[k] != elem
+		|| stream.vNumDoF[k] != n || locJ.num_all_values() != n*n)
+		return false;
+
+//	check if the local solution changed
+	const number* vStoredU = &stream.vValue[stream.vOffset[k]];
+	const number* vU = locU.all_values();
+	for(size_t i = 0; i < n; ++i)
+		if(std::fabs(vU[i] - vStoredU[i]) > m_incJacTol)
+			return false;
+
+//	copy the stored local Jacobian
+	const number* vStoredJ = vStoredU + n;
+	number* vJ = locJ.all_values();
+	for(size_t i = 0; i < n*n; ++i)
+		vJ[i] = vStoredJ[i];
+
+	++stream.cursor;
+	++m_numIncJacReused;
+	return true;
+}
+
+template <typename TAlgebra>
+void AssemblingTuner<TAlgebra>::
+store_local_jacobian(GridObject* elem, const LocalVector& locU,
+                     const LocalMatrix& locJ) const
+{
+	UG_ASSERT(m_pIncJacStream != NULL, "Incremental Jacobian not prepared.");
+	IncJacobianStream& stream = *m_pIncJacStream;
+
+	const size_t k = stream.cursor;
+	const size_t n = locU.num_all_values();
+	if(n == 0) return;
+	UG_ASSERT(locJ.num_all_values() == n*n, "Local Jacobian not quadratic.");
+
+//	if the traversal changed, the remaining stream is discarded
+	if(k >= stream.vElem.size() || stream.vElem[k] != elem
+		|| stream.vNumDoF[k] != n)
+	{
+		stream.vElem.resize(k);
+		stream.vNumDoF.resize(k);
+		stream.vOffset.resize(k+1);
+		stream.vValue.resize(stream.vOffset[k]);
+
+		stream.vElem.push_back(elem);
+		stream.vNumDoF.push_back(n);
+		stream.vOffset.push_back(stream.vOffset[k] + n + n*n);
+		stream.vValue.resize(stream.vOffset[k+1]);
+	}
+
+//	write local solution and local Jacobian
+	number* vStored = &stream.vValue[stream.vOffset[k]];
+	const number* vU = locU.all_values();
+	for(size_t i = 0; i < n; ++i)
+		vStored[i] = vU[i];
+
+	const number* vJ = locJ.all_values();
+	for(size_t i = 0; i < n*n; ++i)
+		vStored[n + i] = vJ[i];
+
+	++stream.cursor;
+	++m_numIncJacComputed;
+}
+
+template <typename TAlgebra>
+void AssemblingTuner<TAlgebra>::create_pattern(ConstSmartPtr<DoFDistribution> dd,
+                                               matrix_type& mat) const
+{
+	const size_t numIndex = dd->num_indices();
+	mat.resize_and_clear(numIndex, numIndex);
+
+//	get the couplings of the indices via the grid
+	std::vector<std::vector<size_t> > vvConnection;
+	try{
+		dd->get_connections(vvConnection);
+	}
+	catch(UGError&){
+	//	not available for this dof distribution, the pattern is then
+	//	created by the first assembling
+		return;
+	}
+
+//	insert row-wise in ascending order, i.e. without moving entries
+	for(size_t r = 0; r < vvConnection.size(); ++r)
+	{
+		std::vector<size_t>& vConn = vvConnection[r];
+		std::sort(vConn.begin(), vConn.end());
+		for(size_t i = 0; i < vConn.size(); ++i)
+			mat(r, vConn[i]);
+	}
+	mat.defragment();
+}
+
 template <typename TAlgebra>
 template <typename TElem>
 bool AssemblingTuner<TAlgebra>::element_used(TElem* elem) const
@@ -46,21 +46,21 @@ DimFEGeometry<TWorldDim,TRefDim>::
 DimFEGeometry() :
 	m_roid(ROID_UNKNOWN), m_quadOrder(0),
 	m_lfeID(),
-	m_vIPLocal(NULL), m_vQuadWeight(NULL)
+	m_vIPLocal(NULL), m_vQuadWeight(NULL), m_pShapeTable(NULL)
 {}
 
 template <int TWorldDim, int TRefDim>
 DimFEGeometry<TWorldDim,TRefDim>::
 DimFEGeometry(size_t order, LFEID lfeid) :
 	m_roid(ROID_UNKNOWN), m_quadOrder(order), m_lfeID(lfeid),
-	m_vIPLocal(NULL), m_vQuadWeight(NULL)
+	m_vIPLocal(NULL), m_vQuadWeight(NULL), m_pShapeTable(NULL)
 {}
 
 template <int TWorldDim, int TRefDim>
 DimFEGeometry<TWorldDim,TRefDim>::
 DimFEGeometry(ReferenceObjectID roid, size_t order, LFEID lfeid) :
 	m_roid(roid), m_quadOrder(order), m_lfeID(lfeid),
-	m_vIPLocal(NULL), m_vQuadWeight(NULL)
+	m_vIPLocal(NULL), m_vQuadWeight(NULL), m_pShapeTable(NULL)
 {}
 
 template <int TWorldDim, int TRefDim>
@@ -83,41 +83,24 @@ update_local(ReferenceObjectID roid, const LFEID& lfeID, size_t orderQuad)
 	m_vIPLocal = quadRule.points();
 	m_vQuadWeight = quadRule.weights();
 
-	}UG_CATCH_THROW("FEGeometry::update: Quadrature Rule error.");
+//	request for shapes and local gradients at the ips (shared by all geometries)
+	m_pShapeTable = &LocalFiniteElementProvider::get_shape_table<dim>
+						(roid, m_lfeID, quadRule);
+
+//	copy shape infos
+	m_nsh = m_pShapeTable->num_sh();
+
+	}UG_CATCH_THROW("FEGeometry::update: Quadrature Rule or Shape Function error.");
 
 //	resize for number of integration points
 	m_vIPGlobal.resize(m_nip);
 	m_vJTInv.resize(m_nip);
 	m_vDetJ.resize(m_nip);
 
-	m_vvGradGlobal.resize(m_nip);
-	m_vvGradLocal.resize(m_nip);
-	m_vvShape.resize(m_nip);
-
-//	request for trial space
-	try{
-	const LocalShapeFunctionSet<dim>& lsfs
-		 = LocalFiniteElementProvider::get<dim>(roid, m_lfeID);
-
-//	copy shape infos
-	m_nsh = lsfs.num_sh();
-
 //	resize for number of shape functions
+	m_vvGradGlobal.resize(m_nip);
 	for(size_t ip = 0; ip < m_nip; ++ip)
-	{
 		m_vvGradGlobal[ip].resize(m_nsh);
-		m_vvGradLocal[ip].resize(m_nsh);
-		m_vvShape[ip].resize(m_nsh);
-	}
-
-//	get all shapes by on call
-	for(size_t ip = 0; ip < m_nip; ++ip)
-	{
-		lsfs.shapes(&(m_vvShape[ip][0]), m_vIPLocal[ip]);
-		lsfs.grads(&(m_vvGradLocal[ip][0]), m_vIPLocal[ip]);
-	}
-
-	}UG_CATCH_THROW("FEGeometry::update: Shape Function error.");
 }
 
 template <int TWorldDim, int TRefDim>
@@ -153,7 +136,7 @@ update(GridObject* pElem, const MathVector<worldDim>* vCorner,
 	for(size_t ip = 0; ip < m_nip; ++ip)
 		for(size_t sh = 0; sh < m_nsh; ++sh)
 			MatVecMult(m_vvGradGlobal[ip][sh],
-			           m_vJTInv[ip], m_vvGradLocal[ip][sh]);
+			           m_vJTInv[ip], m_pShapeTable->local_grad(ip, sh));
 
 	}UG_CATCH_THROW("FEGeometry::update: Reference Mapping error.");
 }
@@ -49,6 +49,9 @@ template <	typename TElem,	int TWorldDim,
 class FEGeometry
 {
 	public:
+	///	type of element
+		typedef TElem elem_type;
+
 	///	type of reference element
 		typedef typename reference_element_traits<TElem>::reference_element_type ref_elem_type;
 
@@ -77,6 +80,9 @@ class FEGeometry
 	///	Constructor
 		FEGeometry();
 
+	///	copies the element data of another geometry (e.g. from a GeomCache)
+		FEGeometry& operator=(const FEGeometry& v);
+
 	/// number of integration points
 		size_t num_ip() const {return nip;}
 
@@ -136,6 +142,13 @@ class FEGeometry
 			update(pElem, vCorner, LFEID(), m_rQuadRule.order());
 		}
 
+	/// update Geometry for corners (subset handler is not needed)
+		void update(GridObject* pElem, const MathVector<worldDim>* vCorner,
+		            const ISubsetHandler* ish)
+		{
+			update(pElem, vCorner);
+		}
+
 	/// update Geometry for corners
 		void update(GridObject* pElem, const MathVector<worldDim>* vCorner,
 		            const LFEID& lfeID, size_t orderQuad);
@@ -237,17 +250,15 @@ class DimFEGeometry
 	/// shape function at ip
 		number shape(size_t ip, size_t sh) const
 		{
-			UG_ASSERT(ip < m_vvShape.size(), "Wrong index");
-			UG_ASSERT(sh < m_vvShape[ip].size(), "Wrong index");
-			return m_vvShape[ip][sh];
+			UG_ASSERT(m_pShapeTable != NULL, "Local data not prepared");
+			return m_pShapeTable->shape(ip, sh);
 		}
 
 	/// local gradient at ip
 		const MathVector<dim>& local_grad(size_t ip, size_t sh) const
 		{
-			UG_ASSERT(ip < m_vvGradLocal.size(), "Wrong index");
-			UG_ASSERT(sh < m_vvGradLocal[ip].size(), "Wrong index");
-			return m_vvGradLocal[ip][sh];
+			UG_ASSERT(m_pShapeTable != NULL, "Local data not prepared");
+			return m_pShapeTable->local_grad(ip, sh);
 		}
 
 	/// global gradient at ip
@@ -457,13 +468,10 @@ class DimFEGeometry
 	///	number of shape functions
 		size_t m_nsh;
 
-	///	shape functions evaluated at ip (size = nip x nsh)
-		std::vector<std::vector<number> > m_vvShape;
+	///	shape functions and local gradients evaluated at ip (shared, size = nip x nsh)
+		const LocalShapeTable<dim>* m_pShapeTable;
 
 	///	global gradient evaluated at ip (size = nip x nsh)
-		std::vector<std::vector<MathVector<dim> > > m_vvGradLocal;
-
-	///	local gradient evaluated at ip (size = nip x nsh)
 		std::vector<std::vector<MathVector<worldDim> > > m_vvGradGlobal;
 };
 
@@ -54,6 +54,32 @@ FEGeometry()
 		}
 }
 
+template <	typename TElem,	int TWorldDim,
+			typename TTrialSpace, typename TQuadratureRule>
+FEGeometry<TElem,TWorldDim,TTrialSpace,TQuadratureRule>&
+FEGeometry<TElem,TWorldDim,TTrialSpace,TQuadratureRule>::
+operator=(const FEGeometry& v)
+{
+	if(this == &v) return *this;
+
+//	quadrature rule, trial space and local shapes are shared by all
+//	geometries of this type, thus only the element dependent data is copied
+	m_pElem = v.m_pElem;
+	m_mapping = v.m_mapping;
+
+	for(size_t ip = 0; ip < nip; ++ip)
+	{
+		m_vIPGlobal[ip] = v.m_vIPGlobal[ip];
+		m_vJTInv[ip] = v.m_vJTInv[ip];
+		m_vDetJ[ip] = v.m_vDetJ[ip];
+
+		for(size_t sh = 0; sh < nsh; ++sh)
+			m_vvGradGlobal[ip][sh] = v.m_vvGradGlobal[ip][sh];
+	}
+
+	return *this;
+}
+
 template <	typename TElem,	int TWorldDim,
 			typename TTrialSpace, typename TQuadratureRule>
 void
@@ -255,6 +255,41 @@ FV1Geometry_gen()
 	update_local_data();
 }
 
+template <typename TElem, int TWorldDim, bool TCondensed>
+FV1Geometry_gen<TElem, TWorldDim, TCondensed>&
+FV1Geometry_gen<TElem, TWorldDim, TCondensed>::
+operator=(const FV1Geometry_gen& v)
+{
+	if(this == &v) return *this;
+
+//	reference element and trial space are shared by all geometries of this
+//	type, thus only the element dependent data must be copied
+	m_pElem = v.m_pElem;
+	m_mapping = v.m_mapping;
+
+	for(int d = 0; d <= dim; ++d)
+		for(int i = 0; i < maxMid; ++i){
+			m_vvLocMid[d][i] = v.m_vvLocMid[d][i];
+			m_vvGloMid[d][i] = v.m_vvGloMid[d][i];
+		}
+
+	for(size_t i = 0; i < numSCVF; ++i){
+		m_vSCVF[i] = v.m_vSCVF[i];
+		m_vGlobSCVF_IP[i] = v.m_vGlobSCVF_IP[i];
+		m_vLocSCVF_IP[i] = v.m_vLocSCVF_IP[i];
+	}
+
+	for(size_t i = 0; i < numSCV; ++i){
+		m_vSCV[i] = v.m_vSCV[i];
+		m_vGlobSCV_IP[i] = v.m_vGlobSCV_IP[i];
+		m_vLocSCV_IP[i] = v.m_vLocSCV_IP[i];
+	}
+
+	m_mapVectorBF = v.m_mapVectorBF;
+
+	return *this;
+}
+
 template <typename TElem, int TWorldDim, bool TCondensed>
 void FV1Geometry_gen<TElem, TWorldDim, TCondensed>::
 update_local_data()
@@ -992,6 +1027,32 @@ FV1ManifoldGeometry() : m_pElem(NULL), m_rRefElem(Provider<ref_elem_type>::get()
 	}
 }
 
+template <typename TElem, int TWorldDim>
+FV1ManifoldGeometry<TElem, TWorldDim>&
+FV1ManifoldGeometry<TElem, TWorldDim>::
+operator=(const FV1ManifoldGeometry& v)
+{
+	if(this == &v) return *this;
+
+//	the reference element is shared by all geometries of this type
+	m_pElem = v.m_pElem;
+	m_rMapping = v.m_rMapping;
+
+	for(int d = 0; d <= dim; ++d)
+		for(size_t i = 0; i < m_numBF; ++i){
+			m_locMid[d][i] = v.m_locMid[d][i];
+			m_gloMid[d][i] = v.m_gloMid[d][i];
+		}
+
+	for(size_t i = 0; i < m_numBF; ++i)
+		m_vBF[i] = v.m_vBF[i];
+
+	m_vLocBFIP = v.m_vLocBFIP;
+	m_vGlobBFIP = v.m_vGlobBFIP;
+
+	return *this;
+}
+
 
 /// update data for given element
 template <typename TElem, int TWorldDim>
@@ -467,6 +467,9 @@ class FV1Geometry_gen : public FVGeometryBase
 	/// construct object and initialize local values and sizes
 		FV1Geometry_gen();
 
+	///	copies the element data of another geometry (e.g. from a GeomCache)
+		FV1Geometry_gen& operator=(const FV1Geometry_gen& v);
+
 	///	update local data
 		void update_local_data();
 
@@ -1325,6 +1328,9 @@ class FV1ManifoldGeometry
 	public:
 	/// constructor
 		FV1ManifoldGeometry();
+
+	///	copies the element data of another geometry (e.g. from a GeomCache)
+		FV1ManifoldGeometry& operator=(const FV1ManifoldGeometry& v);
 		
 	///	update data for given element
 		void update(GridObject* elem, const MathVector<worldDim>* vCornerCoords,
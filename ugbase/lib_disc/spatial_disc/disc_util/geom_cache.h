@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__SPATIAL_DISC__DISC_UTIL__GEOM_CACHE__
+#define __H__UG__LIB_DISC__SPATIAL_DISC__DISC_UTIL__GEOM_CACHE__
+
+#include <deque>
+
+#include "common/common.h"
+#include "common/math/ugmath_types.h"
+#include "common/util/thread_util.h"
+#include "lib_grid/grid/grid.h"
+#include "lib_grid/grid/grid_observer.h"
+#include "lib_grid/tools/subset_handler_interface.h"
+#include "lib_disc/reference_element/reference_element_traits.h"
+
+namespace ug{
+
+/// Cache of element geometries for static meshes
+/**
+ * Updating a finite volume or finite element geometry for an element (i.e.
+ * computing the midpoints, subcontrol volumes, Jacobians and global shape
+ * gradients from the corner coordinates) is repeated in every assembling
+ * pass, although the mesh usually does not change between Newton steps or
+ * time steps. This class memoizes the result of TGeom::update per element:
+ * an updated geometry is copied into the cache once and, on subsequent
+ * requests for the same element, the cached geometry is returned by reference
+ * instead of being recomputed. Thus, the assembling code must use the
+ * geometry returned by update() (or current()) rather than the one passed.
+ *
+ * The cache is opt-in. It is disabled by default, in which case update()
+ * simply forwards to the geometry. Once enabled for a grid, the position of
+ * the cache entry of an element is stored in a grid attachment. The entries
+ * are invalidated whenever grid objects are created or erased (e.g. during
+ * refinement) and a cached geometry is only used if the corner coordinates
+ * and the subset handler coincide with those used when it was stored.
+ *
+ * Since geometries are copied completely into the cache, run-time settings of the
+ * geometry (e.g. registered boundary subsets of FV1Geometry) are part of
+ * the entry: the cache must be cleared if those settings change.
+ *
+ * A memory budget can be specified. If storing an entry would exceed it, the
+ * geometry is computed as usual without being cached. Note, that the memory
+ * used by geometries with dynamically sized members (e.g. HFV1Geometry) is
+ * only estimated by the size of the geometry object.
+ *
+ * As the geometries provided by the GeomProvider, the cache is a singleton
+ * per geometry type and thread (cf. UG_THREAD_LOCAL). In a threaded
+ * assembling, each thread enables and fills its own cache.
+ *
+ * \tparam	TGeom	geometry type (providing elem_type, worldDim, update and
+ * 					an assignment operator copying the element data)
+ */
+template <typename TGeom>
+class GeomCache : public GridObserver
+{
+	public:
+	///	type of cached geometry
+		typedef TGeom geom_type;
+
+	///	type of element
+		typedef typename TGeom::elem_type elem_type;
+
+	///	base object type of element (used for attachment)
+		typedef typename elem_type::grid_base_object base_object;
+
+	///	world dimension
+		static const int worldDim = TGeom::worldDim;
+
+	///	number of corners of the element
+		static const int numCorners =
+			reference_element_traits<elem_type>::reference_element_type::numCorners;
+
+	///	invalid entry index
+		static const size_t INVALID = (size_t)(-1);
+
+	public:
+	///	returns the cache for the geometry type (of the calling thread)
+		static GeomCache<TGeom>& get(){
+			static UG_THREAD_LOCAL GeomCache<TGeom> inst;
+			return inst;
+		}
+
+	///	enables the cache for elements of the given grid
+	/**
+	 * \param[in]	grid		grid, whose elements are cached
+	 * \param[in]	maxMemory	memory budget in bytes (0 = unlimited)
+	 */
+		void enable(Grid& grid, size_t maxMemory = 0)
+		{
+			m_maxMemory = maxMemory;
+			if(m_pGrid == &grid) return;
+
+			disable();
+			m_pGrid = &grid;
+			m_pGrid->attach_to_dv<base_object>(m_aIndex, INVALID);
+			m_aaIndex.access(*m_pGrid, m_aIndex);
+			m_pGrid->register_observer(this, OT_FULL_OBSERVER);
+		}
+
+	///	disables the cache and releases all entries
+		void disable()
+		{
+			clear();
+			if(m_pGrid == NULL) return;
+
+			m_pGrid->unregister_observer(this);
+			m_aaIndex.invalidate();
+			m_pGrid->detach_from<base_object>(m_aIndex);
+			m_pGrid = NULL;
+		}
+
+	///	returns if the cache is enabled
+		bool enabled() const {return m_pGrid != NULL;}
+
+	///	invalidates all entries
+		void clear()
+		{
+			m_pCurrGeo = NULL;
+			if(!m_vEntry.empty()) m_vEntry.clear();
+		}
+
+	///	number of cached geometries
+		size_t num_entries() const {return m_vEntry.size();}
+
+	///	(estimated) memory used by the cached geometries in bytes
+		size_t memory() const {return m_vEntry.size() * sizeof(Entry);}
+
+	///	updates the geometry for an element, using the cached data if possible
+	/**
+	 * Returns the geometry holding the data of the element. This is either
+	 * the cached geometry or the passed one, if it has been updated.
+	 */
+		const TGeom& update(TGeom& geo, GridObject* elem,
+		                    const MathVector<worldDim>* vCornerCoords,
+		                    const ISubsetHandler* ish = NULL)
+		{
+		//	without cache, simply compute
+			if(m_pGrid == NULL){
+				geo.update(elem, vCornerCoords, ish);
+				return *(m_pCurrGeo = &geo);
+			}
+
+			UG_ASSERT(dynamic_cast<base_object*>(elem) != NULL, "Wrong element type.");
+			size_t& ind = m_aaIndex[static_cast<base_object*>(elem)];
+
+		//	use cached geometry if still valid
+			if(ind < m_vEntry.size()){
+				Entry& entry = m_vEntry[ind];
+				if(entry.elem == elem){
+					if(entry.is_valid(vCornerCoords, ish))
+						return *(m_pCurrGeo = &entry.geo);
+
+				//	corners moved: recompute and refresh entry
+					geo.update(elem, vCornerCoords, ish);
+					entry.set(geo, vCornerCoords, ish);
+					return *(m_pCurrGeo = &entry.geo);
+				}
+			}
+
+		//	compute geometry
+			geo.update(elem, vCornerCoords, ish);
+
+		//	store in cache, if memory budget allows
+			if(m_maxMemory > 0 && (m_vEntry.size() + 1) * sizeof(Entry) > m_maxMemory)
+				return *(m_pCurrGeo = &geo);
+
+			ind = m_vEntry.size();
+			m_vEntry.push_back(Entry(geo, elem, vCornerCoords, ish));
+			return *(m_pCurrGeo = &m_vEntry.back().geo);
+		}
+
+	///	returns the geometry returned by the last call of update()
+		const TGeom& current() const
+		{
+			UG_ASSERT(m_pCurrGeo != NULL, "No geometry updated.");
+			return *m_pCurrGeo;
+		}
+
+	public:
+	//	grid callbacks
+		virtual void grid_to_be_destroyed(Grid* grid)	{disable();}
+		virtual void elements_to_be_cleared(Grid* grid)	{clear();}
+
+	//	any change of the grid topology invalidates the cached geometries
+	/// \{
+		virtual void vertex_created(Grid* grid, Vertex* vrt,
+		                            GridObject* pParent, bool replacesParent)	{clear();}
+		virtual void edge_created(Grid* grid, Edge* e,
+		                          GridObject* pParent, bool replacesParent)		{clear();}
+		virtual void face_created(Grid* grid, Face* f,
+		                          GridObject* pParent, bool replacesParent)		{clear();}
+		virtual void volume_created(Grid* grid, Volume* vol,
+		                            GridObject* pParent, bool replacesParent)	{clear();}
+
+		virtual void vertex_to_be_erased(Grid* grid, Vertex* vrt, Vertex* replacedBy)	{clear();}
+		virtual void edge_to_be_erased(Grid* grid, Edge* e, Edge* replacedBy)			{clear();}
+		virtual void face_to_be_erased(Grid* grid, Face* f, Face* replacedBy)			{clear();}
+		virtual void volume_to_be_erased(Grid* grid, Volume* vol, Volume* replacedBy)	{clear();}
+	/// \}
+
+	protected:
+	///	constructor
+		GeomCache() : m_pGrid(NULL), m_maxMemory(0), m_pCurrGeo(NULL) {}
+
+	///	destructor
+		virtual ~GeomCache() {disable();}
+
+	///	cached geometry of an element
+		struct Entry
+		{
+			Entry(const TGeom& geo_, GridObject* elem_,
+			      const MathVector<worldDim>* vCornerCoords,
+			      const ISubsetHandler* ish_)
+				: geo(geo_), elem(elem_), ish(ish_)
+			{
+				for(int co = 0; co < numCorners; ++co)
+					vCorner[co] = vCornerCoords[co];
+			}
+
+		///	refreshes the entry
+			void set(const TGeom& geo_, const MathVector<worldDim>* vCornerCoords,
+			         const ISubsetHandler* ish_)
+			{
+				geo = geo_; ish = ish_;
+				for(int co = 0; co < numCorners; ++co)
+					vCorner[co] = vCornerCoords[co];
+			}
+
+		///	returns if the entry has been computed for the same data
+			bool is_valid(const MathVector<worldDim>* vCornerCoords,
+			              const ISubsetHandler* ish_) const
+			{
+				if(ish != ish_) return false;
+				for(int co = 0; co < numCorners; ++co)
+					for(int d = 0; d < worldDim; ++d)
+						if(vCorner[co][d] != vCornerCoords[co][d])
+							return false;
+				return true;
+			}
+
+			TGeom geo;
+			GridObject* elem;
+			const ISubsetHandler* ish;
+			MathVector<worldDim> vCorner[numCorners];
+		};
+
+	///	grid the cache is enabled for
+		Grid* m_pGrid;
+
+	///	memory budget in bytes (0 = unlimited)
+		size_t m_maxMemory;
+
+	///	cached geometries (deque: no reallocation of entries)
+		std::deque<Entry> m_vEntry;
+
+	///	geometry returned by the last update
+		const TGeom* m_pCurrGeo;
+
+	///	attachment storing the entry index per element
+		Attachment<size_t> m_aIndex;
+		Grid::AttachmentAccessor<base_object, Attachment<size_t> > m_aaIndex;
+};
+
+template <typename TGeom>
+const size_t GeomCache<TGeom>::INVALID;
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__SPATIAL_DISC__DISC_UTIL__GEOM_CACHE__ */
@@ -34,6 +34,7 @@
 #define __H__UG__LIB_DISC__SPATIAL_DISC__DISC_UTIL__GEOM_PROVIDER__
 
 #include <map>
+#include "common/util/thread_util.h"
 #include "lib_disc/local_finite_element/local_finite_element_id.h"
 
 namespace ug{
@@ -46,6 +47,11 @@ namespace ug{
  *
  * In addition, the object can be shared between unrelated code parts, if the
  * same object is intended to be used, but no passing is possible or wanted.
+ *
+ * If compiled with OpenMP, each thread has its own instances, such that the
+ * element discretizations of a threaded assembling do not update the same
+ * geometry. Thus, a reference to a provided geometry must not be stored in a
+ * (function-local) static variable.
  */
 template <typename TGeom>
 class GeomProvider
@@ -69,7 +75,7 @@ class GeomProvider
 
 		/// singleton provider
 		static GeomProvider<TGeom>& inst() {
-			static GeomProvider<TGeom> inst;
+			static UG_THREAD_LOCAL GeomProvider<TGeom> inst;
 			return inst;
 		}
 
@@ -91,7 +97,7 @@ class GeomProvider
 
 		/// vector holding instances
 		typedef std::map<LFEIDandQuadOrder, TGeom*> MapType;
-		static MapType m_mLFEIDandOrder;
+		static UG_THREAD_LOCAL MapType m_mLFEIDandOrder;
 
 		/// returns class based on identifier
 		static TGeom& get_class(const LFEID lfeID, const int quadOrder) {
@@ -139,21 +145,21 @@ class GeomProvider
 
 		///	returns a singleton based on the identifier
 		static inline TGeom& get(){
-			static TGeom inst;
+			static UG_THREAD_LOCAL TGeom inst;
 			if(!staticLocalData)
 				UG_THROW("GeomProvider: accessing geometry without keys, but"
 						 " geometry may change local data. Use access by keys instead.");
 			return inst;
 		}
 
-		///	clears all singletons
+		///	clears all singletons (of the calling thread)
 		static inline void clear(){
 			inst().clear_geoms();
 		}
 };
 
 template <typename TGeom>
-std::map<typename GeomProvider<TGeom>::LFEIDandQuadOrder, TGeom*> GeomProvider<TGeom>::m_mLFEIDandOrder
+UG_THREAD_LOCAL std::map<typename GeomProvider<TGeom>::LFEIDandQuadOrder, TGeom*> GeomProvider<TGeom>::m_mLFEIDandOrder
 						= std::map<typename GeomProvider<TGeom>::LFEIDandQuadOrder, TGeom*>();
 
 
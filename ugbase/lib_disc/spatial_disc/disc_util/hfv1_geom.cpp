@@ -61,6 +61,37 @@ HFV1Geometry()
 	m_locMid[dim][0] *= 1./(m_locMid[0].size());
 }
 
+template <typename TElem, int TWorldDim>
+HFV1Geometry<TElem, TWorldDim>&
+HFV1Geometry<TElem, TWorldDim>::
+operator=(const HFV1Geometry& v)
+{
+	if(this == &v) return *this;
+
+//	the reference element is shared by all geometries of this type
+	m_pElem = v.m_pElem;
+	m_rMapping = v.m_rMapping;
+	m_numSh = v.m_numSh;
+
+	for(int d = 0; d <= dim; ++d){
+		m_locMid[d] = v.m_locMid[d];
+		m_gloMid[d] = v.m_gloMid[d];
+	}
+
+	m_vSCVF = v.m_vSCVF;
+	m_vSCV = v.m_vSCV;
+
+	m_vGlobSCVFIP = v.m_vGlobSCVFIP;
+	m_vLocSCVFIP = v.m_vLocSCVFIP;
+	m_vGlobSCVIP = v.m_vGlobSCVIP;
+	m_vLocSCVIP = v.m_vLocSCVIP;
+
+	m_vNatEdgeInfo = v.m_vNatEdgeInfo;
+	m_vNewEdgeInfo = v.m_vNewEdgeInfo;
+
+	return *this;
+}
+
 
 template <typename TElem, int TWorldDim>
 void HFV1Geometry<TElem, TWorldDim>::
@@ -59,6 +59,10 @@ namespace ug{
  */
 template <	typename TElem, int TWorldDim>
 class HFV1Geometry : public FVGeometryBase{
+	public:
+	/// type of element
+		typedef TElem elem_type;
+
 	private:
 	/// type of reference element
 		typedef typename reference_element_traits<TElem>::reference_element_type ref_elem_type;
@@ -257,6 +261,9 @@ class HFV1Geometry : public FVGeometryBase{
 	///	constructor
 		HFV1Geometry();
 
+	///	copies the element data of another geometry (e.g. from a GeomCache)
+		HFV1Geometry& operator=(const HFV1Geometry& v);
+
 	///	update values for an element
 		void update(GridObject* pElem, const MathVector<worldDim>* vCornerCoords,
 		            			 const ISubsetHandler* ish = NULL);
@@ -341,6 +341,43 @@ public:
 		UG_THROW ("LSGFGlobAssembler::AssembleRhs: Cannot assemble the RHS in GF independently of the matrix");
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+// Matrix-free application: not available for the ghost-fluid method
+////////////////////////////////////////////////////////////////////////////////
+
+public:
+
+	template <typename TElem, typename TIterator>
+	static void
+	ApplyJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+					ConstSmartPtr<domain_type> spDomain,
+					ConstSmartPtr<DoFDistribution> dd,
+					TIterator iterBegin,
+					TIterator iterEnd,
+					int si, bool bNonRegularGrid,
+					vector_type& d,
+					const vector_type& c,
+					const vector_type& u,
+					ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+		UG_THROW ("LSGFGlobAssembler::ApplyJacobian: Matrix-free application not implemented for the Ghost-Fluid method.");
+	}
+
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleJacobianDiagonal(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+					ConstSmartPtr<domain_type> spDomain,
+					ConstSmartPtr<DoFDistribution> dd,
+					TIterator iterBegin,
+					TIterator iterEnd,
+					int si, bool bNonRegularGrid,
+					matrix_type& D,
+					const vector_type& u,
+					ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+		UG_THROW ("LSGFGlobAssembler::AssembleJacobianDiagonal: Matrix-free application not implemented for the Ghost-Fluid method.");
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Prepare and Finish Timestep: these version merely skip the outer elements
 ////////////////////////////////////////////////////////////////////////////////
@@ -267,6 +267,26 @@ class DomainDiscretizationBase
 		                                       const GridLevel& gl)
 		{assemble_stiffness_matrix(A, u, dd(gl));}
 
+	/// \copydoc IAssemble::apply_jacobian()
+		virtual void apply_jacobian(vector_type& d, const vector_type& c, const vector_type& u,
+		                            ConstSmartPtr<DoFDistribution> dd);
+		virtual void apply_jacobian(vector_type& d, const vector_type& c, const vector_type& u,
+		                            const GridLevel& gl)
+		{apply_jacobian(d, c, u, dd(gl));}
+
+	/// \copydoc IAssemble::assemble_jacobian_diagonal()
+		virtual void assemble_jacobian_diagonal(matrix_type& D, const vector_type& u,
+		                                        ConstSmartPtr<DoFDistribution> dd);
+		virtual void assemble_jacobian_diagonal(matrix_type& D, const vector_type& u,
+		                                        const GridLevel& gl)
+		{assemble_jacobian_diagonal(D, u, dd(gl));}
+
+	/// \copydoc IAssemble::assemble_dirichlet_mask()
+		virtual void assemble_dirichlet_mask(vector_type& mask,
+		                                     ConstSmartPtr<DoFDistribution> dd);
+		virtual void assemble_dirichlet_mask(vector_type& mask, const GridLevel& gl)
+		{assemble_dirichlet_mask(mask, dd(gl));}
+
 	///////////////////////////////////////////////////////////
 	// Error estimator										///
 public:
@@ -521,6 +541,9 @@ public:
 		
 	///	this object provides tools to adapt the assemble routine
 		SmartPtr<AssemblingTuner<TAlgebra> > m_spAssTuner;
+
+	///	revision of the approximation space the incremental Jacobian refers to
+		RevisionCounter m_incJacRevision;
 	
 	private:
 	//---- Auxiliary function templates for the assembling ----//
@@ -550,6 +573,22 @@ public:
 									int si, bool bNonRegularGrid,
 									vector_type& d,
 									const vector_type& u);
+	///	throws if constraints not supported in the matrix-free application are enabled
+	void check_matrix_free_constraints(const char* func) const;
+
+	template <typename TElem>
+	void ApplyJacobian(				const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+									ConstSmartPtr<DoFDistribution> dd,
+									int si, bool bNonRegularGrid,
+									vector_type& d,
+									const vector_type& c,
+									const vector_type& u);
+	template <typename TElem>
+	void AssembleJacobianDiagonal(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+									ConstSmartPtr<DoFDistribution> dd,
+									int si, bool bNonRegularGrid,
+									matrix_type& D,
+									const vector_type& u);
 	template <typename TElem>
 	void AssembleLinear( 			const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 									ConstSmartPtr<DoFDistribution> dd,
@@ -128,6 +128,15 @@ void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::update_disc_it
 {
 	update_elem_discs();
 	update_constraints();
+
+//	stored local Jacobians of the incremental assembling are invalid for a
+//	changed approximation space (e.g. after refinement or redistribution)
+	if(m_spAssTuner->incremental_jacobian_enabled()
+		&& m_incJacRevision != m_spApproxSpace->revision())
+	{
+		m_spAssTuner->invalidate_incremental_jacobian();
+		m_incJacRevision = m_spApproxSpace->revision();
+	}
 }
 
 template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
@@ -640,6 +649,373 @@ AssembleJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	}
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Matrix-free Jacobian (stationary)
+///////////////////////////////////////////////////////////////////////////////
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+check_matrix_free_constraints(const char* func) const
+{
+//	the modified solution is not supported in the matrix-free application
+	if(m_spAssTuner->modify_solution_enabled())
+		UG_THROW("DomainDiscretization::"<<func<<": Modification of the"
+				" solution not supported in matrix-free application.");
+
+//	only Dirichlet rows can be represented by the mask
+	for(int type = 1; type < CT_ALL; type = type << 1){
+		if(type == CT_DIRICHLET) continue;
+		if(!(m_spAssTuner->constraint_type_enabled(type))) continue;
+		for(size_t i = 0; i < m_vConstraint.size(); ++i)
+			if(m_vConstraint[i]->type() & type)
+				UG_THROW("DomainDiscretization::"<<func<<": Only Dirichlet"
+						" constraints supported in matrix-free application.");
+	}
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+assemble_dirichlet_mask(vector_type& mask, ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+	update_disc_items();
+	check_matrix_free_constraints("assemble_dirichlet_mask");
+
+//	the Dirichlet dofs are the zero entries of an adjusted vector of ones
+	mask.resize(dd->num_indices());
+#ifdef UG_PARALLEL
+	mask.set_layouts(dd->layouts());
+#endif
+	mask.set(1.0);
+	try{
+	if(m_spAssTuner->constraint_type_enabled(CT_DIRICHLET))
+		for(size_t i = 0; i < m_vConstraint.size(); ++i)
+			if(m_vConstraint[i]->type() & CT_DIRICHLET)
+			{
+				m_vConstraint[i]->set_ass_tuner(m_spAssTuner);
+				m_vConstraint[i]->adjust_correction(mask, dd, CT_DIRICHLET);
+			}
+	}UG_CATCH_THROW("DomainDiscretization::assemble_dirichlet_mask:"
+					" Cannot adjust mask.");
+
+#ifdef UG_PARALLEL
+	mask.set_storage_type(PST_CONSISTENT);
+#endif
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+apply_jacobian(vector_type& d,
+               const vector_type& c,
+               const vector_type& u,
+               ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+//	update the elem discs
+	update_disc_items();
+	check_matrix_free_constraints("apply_jacobian");
+	prep_assemble_loop(m_vElemDisc);
+
+//	resize and reset result to zero (independent of the tuner's clear flag)
+	d.resize(dd->num_indices());
+	d.set(0.0);
+
+//	Union of Subsets
+	SubsetGroup unionSubsets;
+	std::vector<SubsetGroup> vSSGrp;
+
+//	create list of all subsets
+	try{
+		CreateSubsetGroups(vSSGrp, unionSubsets, m_vElemDisc, dd->subset_handler());
+	}UG_CATCH_THROW("'DomainDiscretization': Can not create Subset Groups and Union.");
+
+//	loop subsets
+	for(size_t i = 0; i < unionSubsets.size(); ++i)
+	{
+	//	get subset
+		const int si = unionSubsets[i];
+
+	//	get dimension of the subset
+		const int dim = DimensionOfSubset(*dd->subset_handler(), si);
+
+	//	request if subset is regular grid
+		bool bNonRegularGrid = !unionSubsets.regular_grid(i);
+
+	//	overrule by regular grid if required
+		if(m_spAssTuner->regular_grid_forced()) bNonRegularGrid = false;
+
+	//	Elem Disc on the subset
+		std::vector<IElemDisc<TDomain>*> vSubsetElemDisc;
+
+	//	get all element discretizations that work on the subset
+		GetElemDiscOnSubset(vSubsetElemDisc, m_vElemDisc, vSSGrp, si);
+
+	//	assemble on suitable elements
+		try
+		{
+		switch(dim)
+		{
+		case 0:
+			this->template ApplyJacobian<RegularVertex>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, u);
+			break;
+		case 1:
+			this->template ApplyJacobian<RegularEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, u);
+			// When assembling over lower-dim manifolds that contain hanging nodes:
+			this->template ApplyJacobian<ConstrainingEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, u);
+			break;
+		case 2:
+			this->template ApplyJacobian<Triangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, u);
+			this->template ApplyJacobian<Quadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, u);
+			// When assembling over lower-dim manifolds that contain hanging nodes:
+			this->template ApplyJacobian<ConstrainingTriangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, u);
+			this->template ApplyJacobian<ConstrainingQuadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, u);
+			break;
+		case 3:
+			this->template ApplyJacobian<Tetrahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, u);
+			this->template ApplyJacobian<Pyramid>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, u);
+			this->template ApplyJacobian<Prism>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, u);
+			this->template ApplyJacobian<Hexahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, u);
+			this->template ApplyJacobian<Octahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, u);
+			break;
+		default:
+			UG_THROW("DomainDiscretization::apply_jacobian:"
+							"Dimension "<<dim<<"(subset="<<si<<") not supported");
+		}
+		}
+		UG_CATCH_THROW("DomainDiscretization::apply_jacobian:"
+						" Assembling of elements of Dimension " << dim << " in "
+						" subset "<<si<< " failed.");
+	}
+
+//	post process: the rows of Dirichlet dofs are set by the caller, using the
+//	mask of assemble_dirichlet_mask()
+	try{
+	post_assemble_loop(m_vElemDisc);
+	}UG_CATCH_THROW("DomainDiscretization::apply_jacobian:"
+					" Cannot execute post process.");
+
+//	Remember parallel storage type
+#ifdef UG_PARALLEL
+	d.set_storage_type(PST_ADDITIVE);
+#endif
+}
+
+/**
+ * This function adds the action of the Jacobian of all passed element
+ * discretizations on one given subset to the vector d in the stationary case.
+ *
+ * \param[in]		vElemDisc		element discretizations
+ * \param[in]		dd				DoF Distribution
+ * \param[in]		si				subset index
+ * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+ * \param[in,out]	d				result
+ * \param[in]		c				vector the jacobian is applied to
+ * \param[in]		u				solution
+ */
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+template <typename TElem>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+ApplyJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+				ConstSmartPtr<DoFDistribution> dd,
+				int si, bool bNonRegularGrid,
+				vector_type& d,
+				const vector_type& c,
+				const vector_type& u)
+{
+	//	check if only some elements are selected
+	if(m_spAssTuner->selected_elements_used())
+	{
+		std::vector<TElem*> vElem;
+		m_spAssTuner->collect_selected_elements(vElem, dd, si);
+
+		//	assembling is carried out only over those elements
+		//	which are selected and in subset si
+		gass_type::template ApplyJacobian<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd, vElem.begin(), vElem.end(), si,
+			 bNonRegularGrid, d, c, u, m_spAssTuner);
+	}
+	else
+	{
+		//	general case: assembling over all elements in subset si
+		gass_type::template ApplyJacobian<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd,
+				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+					bNonRegularGrid, d, c, u, m_spAssTuner);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Jacobian diagonal (stationary)
+///////////////////////////////////////////////////////////////////////////////
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+assemble_jacobian_diagonal(matrix_type& D,
+                           const vector_type& u,
+                           ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+//	update the elem discs
+	update_disc_items();
+	check_matrix_free_constraints("assemble_jacobian_diagonal");
+	prep_assemble_loop(m_vElemDisc);
+
+//	reset matrix to zero and resize
+	m_spAssTuner->resize(dd, D);
+
+//	Union of Subsets
+	SubsetGroup unionSubsets;
+	std::vector<SubsetGroup> vSSGrp;
+
+//	create list of all subsets
+	try{
+		CreateSubsetGroups(vSSGrp, unionSubsets, m_vElemDisc, dd->subset_handler());
+	}UG_CATCH_THROW("'DomainDiscretization': Can not create Subset Groups and Union.");
+
+//	loop subsets
+	for(size_t i = 0; i < unionSubsets.size(); ++i)
+	{
+	//	get subset
+		const int si = unionSubsets[i];
+
+	//	get dimension of the subset
+		const int dim = DimensionOfSubset(*dd->subset_handler(), si);
+
+	//	request if subset is regular grid
+		bool bNonRegularGrid = !unionSubsets.regular_grid(i);
+
+	//	overrule by regular grid if required
+		if(m_spAssTuner->regular_grid_forced()) bNonRegularGrid = false;
+
+	//	Elem Disc on the subset
+		std::vector<IElemDisc<TDomain>*> vSubsetElemDisc;
+
+	//	get all element discretizations that work on the subset
+		GetElemDiscOnSubset(vSubsetElemDisc, m_vElemDisc, vSSGrp, si);
+
+	//	assemble on suitable elements
+		try
+		{
+		switch(dim)
+		{
+		case 0:
+			this->template AssembleJacobianDiagonal<RegularVertex>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, u);
+			break;
+		case 1:
+			this->template AssembleJacobianDiagonal<RegularEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, u);
+			// When assembling over lower-dim manifolds that contain hanging nodes:
+			this->template AssembleJacobianDiagonal<ConstrainingEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, u);
+			break;
+		case 2:
+			this->template AssembleJacobianDiagonal<Triangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, u);
+			this->template AssembleJacobianDiagonal<Quadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, u);
+			// When assembling over lower-dim manifolds that contain hanging nodes:
+			this->template AssembleJacobianDiagonal<ConstrainingTriangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, u);
+			this->template AssembleJacobianDiagonal<ConstrainingQuadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, u);
+			break;
+		case 3:
+			this->template AssembleJacobianDiagonal<Tetrahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, u);
+			this->template AssembleJacobianDiagonal<Pyramid>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, u);
+			this->template AssembleJacobianDiagonal<Prism>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, u);
+			this->template AssembleJacobianDiagonal<Hexahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, u);
+			this->template AssembleJacobianDiagonal<Octahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, u);
+			break;
+		default:
+			UG_THROW("DomainDiscretization::assemble_jacobian_diagonal:"
+							"Dimension "<<dim<<"(subset="<<si<<") not supported");
+		}
+		}
+		UG_CATCH_THROW("DomainDiscretization::assemble_jacobian_diagonal:"
+						" Assembling of elements of Dimension " << dim << " in "
+						" subset "<<si<< " failed.");
+	}
+
+//	post process: identity rows of the Dirichlet dofs (the only constraints
+//	admitted by check_matrix_free_constraints)
+	try{
+	if(m_spAssTuner->constraint_type_enabled(CT_DIRICHLET))
+		for(size_t i = 0; i < m_vConstraint.size(); ++i)
+			if(m_vConstraint[i]->type() & CT_DIRICHLET)
+			{
+				m_vConstraint[i]->set_ass_tuner(m_spAssTuner);
+				m_vConstraint[i]->adjust_jacobian(D, u, dd, CT_DIRICHLET);
+			}
+	post_assemble_loop(m_vElemDisc);
+	}UG_CATCH_THROW("DomainDiscretization::assemble_jacobian_diagonal:"
+					" Cannot execute post process.");
+
+//	Remember parallel storage type
+#ifdef UG_PARALLEL
+	D.set_storage_type(PST_ADDITIVE);
+	D.set_layouts(dd->layouts());
+#endif
+}
+
+/**
+ * This function adds the (block-)diagonal of the Jacobian of all passed
+ * element discretizations on one given subset to the matrix D in the
+ * stationary case.
+ *
+ * \param[in]		vElemDisc		element discretizations
+ * \param[in]		dd				DoF Distribution
+ * \param[in]		si				subset index
+ * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+ * \param[in,out]	D				diagonal of the jacobian
+ * \param[in]		u				solution
+ */
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+template <typename TElem>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+AssembleJacobianDiagonal(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+				ConstSmartPtr<DoFDistribution> dd,
+				int si, bool bNonRegularGrid,
+				matrix_type& D,
+				const vector_type& u)
+{
+	//	check if only some elements are selected
+	if(m_spAssTuner->selected_elements_used())
+	{
+		std::vector<TElem*> vElem;
+		m_spAssTuner->collect_selected_elements(vElem, dd, si);
+
+		//	assembling is carried out only over those elements
+		//	which are selected and in subset si
+		gass_type::template AssembleJacobianDiagonal<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd, vElem.begin(), vElem.end(), si,
+			 bNonRegularGrid, D, u, m_spAssTuner);
+	}
+	else
+	{
+		//	general case: assembling over all elements in subset si
+		gass_type::template AssembleJacobianDiagonal<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd,
+				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+					bNonRegularGrid, D, u, m_spAssTuner);
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Defect (stationary)
 ///////////////////////////////////////////////////////////////////////////////
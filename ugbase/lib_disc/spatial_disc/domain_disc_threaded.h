@@ -0,0 +1,464 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__SPATIAL_DISC__DOMAIN_DISC_THREADED__
+#define __H__UG__LIB_DISC__SPATIAL_DISC__DOMAIN_DISC_THREADED__
+
+#include <vector>
+
+#include "common/common.h"
+#include "common/util/smart_pointer.h"
+#include "common/util/thread_util.h"
+#include "lib_disc/spatial_disc/domain_disc.h"
+
+namespace ug {
+
+/// \ingroup lib_disc_domain_assemble
+/// @{
+
+/// Global assembler processing the elements of a subset in several threads
+/**
+ * This global assembler distributes the element loops of the stationary
+ * assembling (stiffness matrix, mass matrix, jacobian and defect) to the
+ * threads of the shared-memory parallelization (cf. SetNumThreads).
+ *
+ * To avoid races when adding the local contributions to the global algebra,
+ * the elements are colored such that no two elements of the same color share
+ * an algebraic index. The colors are processed one after the other, the
+ * elements of one color concurrently. Since inserting new entries into a
+ * sparse matrix modifies its structure, all couplings are inserted in a
+ * sequential symbolic pass beforehand, so that the threads only add to
+ * existing entries.
+ *
+ * Each thread needs its own instances of the element discretizations and of
+ * their user data (they store element-wise data). These are obtained by
+ * IElemDisc::clone_for_thread. The geometries of the GeomProvider and the
+ * GeomCache are held per thread. Currently, NeumannBoundaryFV1 with constant
+ * user data supports this. If a discretization does not support this, or if
+ * a custom local-to-global mapping is set in the assembling tuner, the
+ * assembling falls back to the sequential loops of StdGlobAssembler. The instationary assemblings, the
+ * linear problem and the rhs are always assembled sequentially.
+ *
+ * \note The profiler is not thread-safe, therefore no profiling is done
+ * inside of the threaded element loops.
+ *
+ * \tparam TDomain		domain type
+ * \tparam TAlgebra		algebra type
+ */
+template <typename TDomain, typename TAlgebra>
+class ThreadedGlobAssembler : public StdGlobAssembler<TDomain, TAlgebra>
+{
+	///	Base class type
+	typedef StdGlobAssembler<TDomain, TAlgebra> base_type;
+
+	///	Domain type
+	typedef TDomain domain_type;
+
+	///	Algebra type
+	typedef TAlgebra algebra_type;
+
+	///	Vector type in the algebra
+	typedef typename algebra_type::vector_type vector_type;
+
+	///	Matrix type in the algebra
+	typedef typename algebra_type::matrix_type matrix_type;
+
+	///	type of the mask of colors used at an algebraic index (at most 64 colors)
+	typedef uint64 color_mask_type;
+
+	///	kind of local contribution computed in the threaded loop
+	enum LocalContribution {LC_STIFF, LC_MASS, LC_JACOBIAN, LC_DEFECT};
+
+public:
+	using base_type::AssembleStiffnessMatrix;
+	using base_type::AssembleMassMatrix;
+	using base_type::AssembleJacobian;
+	using base_type::AssembleDefect;
+
+	/// assembles the stiffness matrix (cf. StdGlobAssembler)
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleStiffnessMatrix(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+								ConstSmartPtr<domain_type> spDomain,
+								ConstSmartPtr<DoFDistribution> dd,
+								TIterator iterBegin,
+								TIterator iterEnd,
+								int si, bool bNonRegularGrid,
+								matrix_type& A,
+								const vector_type& u,
+								ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+		if(!AssembleThreaded<TElem>(LC_STIFF, vElemDisc, spDomain, dd, iterBegin, iterEnd,
+		                            si, bNonRegularGrid, &A, NULL, u, spAssTuner))
+			base_type::template AssembleStiffnessMatrix<TElem>
+				(vElemDisc, spDomain, dd, iterBegin, iterEnd, si, bNonRegularGrid,
+				 A, u, spAssTuner);
+	}
+
+	/// assembles the mass matrix (cf. StdGlobAssembler)
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleMassMatrix(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+						ConstSmartPtr<domain_type> spDomain,
+						ConstSmartPtr<DoFDistribution> dd,
+						TIterator iterBegin,
+						TIterator iterEnd,
+						int si, bool bNonRegularGrid,
+						matrix_type& M,
+						const vector_type& u,
+						ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+		if(!AssembleThreaded<TElem>(LC_MASS, vElemDisc, spDomain, dd, iterBegin, iterEnd,
+		                            si, bNonRegularGrid, &M, NULL, u, spAssTuner))
+			base_type::template AssembleMassMatrix<TElem>
+				(vElemDisc, spDomain, dd, iterBegin, iterEnd, si, bNonRegularGrid,
+				 M, u, spAssTuner);
+	}
+
+	/// assembles the (stationary) jacobian (cf. StdGlobAssembler)
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+						ConstSmartPtr<domain_type> spDomain,
+						ConstSmartPtr<DoFDistribution> dd,
+						TIterator iterBegin,
+						TIterator iterEnd,
+						int si, bool bNonRegularGrid,
+						matrix_type& J,
+						const vector_type& u,
+						ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+		if(!AssembleThreaded<TElem>(LC_JACOBIAN, vElemDisc, spDomain, dd, iterBegin, iterEnd,
+		                            si, bNonRegularGrid, &J, NULL, u, spAssTuner))
+			base_type::template AssembleJacobian<TElem>
+				(vElemDisc, spDomain, dd, iterBegin, iterEnd, si, bNonRegularGrid,
+				 J, u, spAssTuner);
+	}
+
+	/// assembles the (stationary) defect (cf. StdGlobAssembler)
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleDefect(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+					ConstSmartPtr<domain_type> spDomain,
+					ConstSmartPtr<DoFDistribution> dd,
+					TIterator iterBegin,
+					TIterator iterEnd,
+					int si, bool bNonRegularGrid,
+					vector_type& d,
+					const vector_type& u,
+					ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+	//	the modification of the local solution is not known to be thread-safe
+		if(spAssTuner->modify_solution_enabled()
+			|| !AssembleThreaded<TElem>(LC_DEFECT, vElemDisc, spDomain, dd, iterBegin, iterEnd,
+			                            si, bNonRegularGrid, NULL, &d, u, spAssTuner))
+			base_type::template AssembleDefect<TElem>
+				(vElemDisc, spDomain, dd, iterBegin, iterEnd, si, bNonRegularGrid,
+				 d, u, spAssTuner);
+	}
+
+protected:
+	/// computes the local contribution of an element and adds it to the global algebra
+	template <typename TElem>
+	static void
+	AssembleElem(LocalContribution type, DataEvaluator<domain_type>& Eval,
+	             TElem* elem, const MathVector<domain_type::dim>* vCornerCoords,
+	             const LocalIndices& ind, LocalVector& locU, LocalVector& locD,
+	             LocalVector& tmpLocD, LocalMatrix& locA,
+	             matrix_type* pA, vector_type* pD, const vector_type& u)
+	{
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+	//	read local values of u
+		locU.resize(ind);
+		GetLocalVector(locU, u);
+
+	//	prepare element
+		Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, type != LC_DEFECT);
+
+		if(type == LC_DEFECT)
+		{
+			locD.resize(ind); tmpLocD.resize(ind);
+
+		//	assemble A and rhs
+			locD = 0.0;
+			Eval.add_def_A_elem(locD, locU, elem, vCornerCoords);
+			tmpLocD = 0.0;
+			Eval.add_rhs_elem(tmpLocD, elem, vCornerCoords);
+			locD.scale_append(-1, tmpLocD);
+
+		//	send local to global defect (no custom mapping is set)
+			AddLocalVector(*pD, locD);
+		}
+		else
+		{
+			locA.resize(ind);
+			locA = 0.0;
+
+		//	assemble JA resp. JM
+			if(type == LC_MASS) Eval.add_jac_M_elem(locA, locU, elem, vCornerCoords);
+			else Eval.add_jac_A_elem(locA, locU, elem, vCornerCoords);
+
+		//	send local to global matrix (no custom mapping is set, and the
+		//	scatter cache of the tuner must not be used concurrently)
+			AddLocalMatrixToGlobal(*pA, locA);
+		}
+	}
+
+	/// threaded element loop
+	/**
+	 * Processes the elements in [iterBegin, iterEnd) using NumThreads()
+	 * threads and returns true. If the threaded assembling is not possible
+	 * (or not worthwhile), nothing is assembled and false is returned.
+	 */
+	template <typename TElem, typename TIterator>
+	static bool
+	AssembleThreaded(LocalContribution type,
+	                 const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+	                 ConstSmartPtr<domain_type> spDomain,
+	                 ConstSmartPtr<DoFDistribution> dd,
+	                 TIterator iterBegin,
+	                 TIterator iterEnd,
+	                 int si, bool bNonRegularGrid,
+	                 matrix_type* pA, vector_type* pD,
+	                 const vector_type& u,
+	                 ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+		const int numThreads = NumThreads();
+		if(numThreads <= 1 || spAssTuner->mapping_set()) return false;
+
+	//	the stored local Jacobians of the incremental assembling are read and
+	//	written in the order of traversal
+		if(type == LC_JACOBIAN && spAssTuner->incremental_jacobian_enabled())
+			return false;
+
+	//	collect the elements to assemble
+		std::vector<TElem*> vElem;
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+			if(spAssTuner->element_used(*iter)) vElem.push_back(*iter);
+		if(!UseThreads(vElem.size())) return false;
+
+	//	get an instance of the element discretizations for each thread,
+	//	the first thread uses the original ones
+		std::vector<std::vector<IElemDisc<domain_type>*> > vvElemDisc(numThreads, vElemDisc);
+		std::vector<SmartPtr<IElemDisc<domain_type> > > vspClone;
+		for(int t = 1; t < numThreads; ++t)
+			for(size_t i = 0; i < vElemDisc.size(); ++i)
+			{
+				SmartPtr<IElemDisc<domain_type> > spClone = vElemDisc[i]->clone_for_thread();
+				if(spClone.invalid()) return false;
+				spClone->set_approximation_space(vElemDisc[i]->approx_space());
+				vspClone.push_back(spClone);
+				vvElemDisc[t][i] = spClone.get();
+			}
+
+	//	hanging dofs are used if requested by any disc (cf. DataEvaluator)
+		bool bUseHanging = false;
+		if(bNonRegularGrid)
+			for(size_t i = 0; i < vElemDisc.size(); ++i)
+				bUseHanging |= vElemDisc[i]->use_hanging();
+
+	//	color the elements (greedy), such that the elements of one color do
+	//	not share an algebraic index; insert the matrix couplings meanwhile
+		std::vector<std::vector<TElem*> > vvColorElem;
+		{
+			std::vector<color_mask_type> vMask(dd->num_indices(), 0);
+			std::vector<size_t> vInd;
+			LocalIndices ind;
+			for(size_t e = 0; e < vElem.size(); ++e)
+			{
+				dd->indices(vElem[e], ind, bUseHanging);
+
+				vInd.clear();
+				for(size_t fct = 0; fct < ind.num_fct(); ++fct)
+					for(size_t dof = 0; dof < ind.num_dof(fct); ++dof)
+						vInd.push_back(ind.index(fct, dof));
+
+				color_mask_type used = 0;
+				for(size_t i = 0; i < vInd.size(); ++i) used |= vMask[vInd[i]];
+				if(~used == 0) return false;
+
+				size_t color = 0;
+				while(used & (color_mask_type(1) << color)) ++color;
+				for(size_t i = 0; i < vInd.size(); ++i)
+					vMask[vInd[i]] |= (color_mask_type(1) << color);
+
+				if(color >= vvColorElem.size()) vvColorElem.resize(color+1);
+				vvColorElem[color].push_back(vElem[e]);
+
+				if(pA != NULL)
+					for(size_t i = 0; i < vInd.size(); ++i)
+						for(size_t j = 0; j < vInd.size(); ++j)
+							(*pA)(vInd[i], vInd[j]);
+			}
+		}
+
+		for(size_t i = 0; i < vspClone.size(); ++i)
+			vspClone[i]->prep_assemble_loop();
+
+	//	errors are collected per thread and rethrown after the parallel region,
+	//	since exceptions must not leave it
+		std::vector<SmartPtr<UGError> > vErr(numThreads);
+		const int discPart = (type == LC_MASS) ? MASS
+							: ((type == LC_STIFF) ? STIFF : (STIFF | RHS));
+
+	#ifdef UG_OPENMP
+		#pragma omp parallel num_threads(numThreads)
+	#endif
+		{
+		#ifdef UG_OPENMP
+			const int t = omp_get_thread_num();
+		#else
+			const int t = 0;
+		#endif
+
+		//	the preparation of the loop creates the geometries of the thread,
+		//	registers geometry caches at the grid and may create shape function
+		//	sets in the process-wide providers, thus the threads do it one
+		//	after the other
+			SmartPtr<DataEvaluator<domain_type> > spEval;
+		#ifdef UG_OPENMP
+			#pragma omp critical (ThreadedGlobAssemblerPrepare)
+		#endif
+			{
+				try{
+					spEval = make_sp(new DataEvaluator<domain_type>(discPart,
+								vvElemDisc[t], dd->function_pattern(), bNonRegularGrid));
+					spEval->prepare_elem_loop(geometry_traits<TElem>::REFERENCE_OBJECT_ID, si);
+				}
+				catch(UGError& err){vErr[t] = make_sp(new UGError(err));}
+				catch(std::exception& ex){vErr[t] = make_sp(new UGError("Cannot create Data Evaluator.", ex, __FILE__, __LINE__));}
+			}
+		#ifdef UG_OPENMP
+			#pragma omp barrier
+		#endif
+
+			MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+			LocalIndices ind; LocalVector locU, locD, tmpLocD; LocalMatrix locA;
+
+		//	all threads must reach every worksharing loop, even after an error
+			for(size_t c = 0; c < vvColorElem.size(); ++c)
+			{
+				const std::vector<TElem*>& vColorElem = vvColorElem[c];
+				const int numColorElem = (int)vColorElem.size();
+
+			#ifdef UG_OPENMP
+				#pragma omp for schedule(dynamic, 16)
+			#endif
+				for(int e = 0; e < numColorElem; ++e)
+				{
+					if(vErr[t].valid()) continue;
+					try{
+						TElem* elem = vColorElem[e];
+						FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+						dd->indices(elem, ind, spEval->use_hanging());
+						AssembleElem<TElem>(type, *spEval, elem, vCornerCoords, ind,
+						                    locU, locD, tmpLocD, locA, pA, pD, u);
+					}
+					catch(UGError& err){vErr[t] = make_sp(new UGError(err));}
+					catch(std::exception& ex){vErr[t] = make_sp(new UGError("Cannot assemble element.", ex, __FILE__, __LINE__));}
+				}
+			}
+
+		//	the data evaluators share smart pointers (e.g. to the function
+		//	pattern), thus they are released one after the other as well
+		#ifdef UG_OPENMP
+			#pragma omp critical (ThreadedGlobAssemblerPrepare)
+		#endif
+			{
+				if(vErr[t].invalid())
+				{
+					try{spEval->finish_elem_loop();}
+					catch(UGError& err){vErr[t] = make_sp(new UGError(err));}
+				}
+				spEval = SPNULL;
+			}
+		}
+
+		for(size_t i = 0; i < vspClone.size(); ++i)
+			vspClone[i]->post_assemble_loop();
+
+		for(int t = 0; t < numThreads; ++t)
+			if(vErr[t].valid())
+			{
+				UGError err(*vErr[t]);
+				err.push_msg("ThreadedGlobAssembler: Threaded assembling failed.",
+				             __FILE__, __LINE__);
+				throw err;
+			}
+
+		return true;
+	}
+};
+
+/// domain discretization assembling the element contributions in several threads
+/**
+ * This class is a DomainDiscretization using the ThreadedGlobAssembler. The
+ * number of threads is set by SetNumThreads. The element discretizations must
+ * implement IElemDisc::clone_for_thread, otherwise the assembling is
+ * sequential.
+ *
+ * \tparam TDomain		domain type
+ * \tparam TAlgebra		algebra type
+ */
+template <typename TDomain, typename TAlgebra>
+class ThreadedDomainDiscretization
+:	public DomainDiscretizationBase<TDomain, TAlgebra, ThreadedGlobAssembler<TDomain, TAlgebra> >
+{
+	/// Type of the global assembler
+		typedef ThreadedGlobAssembler<TDomain, TAlgebra> gass_type;
+
+	public:
+	///	Type of Domain
+		typedef TDomain domain_type;
+
+	///	Type of algebra
+		typedef TAlgebra algebra_type;
+
+	///	Type of approximation space
+		typedef ApproximationSpace<TDomain>	approx_space_type;
+
+	public:
+	///	default Constructor
+		ThreadedDomainDiscretization(SmartPtr<approx_space_type> pApproxSpace)
+		: DomainDiscretizationBase<domain_type, algebra_type, gass_type> (pApproxSpace)
+		{};
+
+	/// virtual destructor
+		virtual ~ThreadedDomainDiscretization() {};
+};
+
+/// @}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__SPATIAL_DISC__DOMAIN_DISC_THREADED__ */
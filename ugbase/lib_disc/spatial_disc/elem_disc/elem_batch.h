@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__LIB_DISC__SPATIAL_DISC__ELEM_DISC__ELEM_BATCH__
+#define __H__UG__LIB_DISC__SPATIAL_DISC__ELEM_DISC__ELEM_BATCH__
+
+#include <vector>
+
+#include "common/common.h"
+#include "common/math/ugmath_types.h"
+#include "lib_disc/common/local_algebra.h"
+#include "lib_grid/grid/grid_base_objects.h"
+
+namespace ug{
+
+/// \ingroup lib_disc_elem_disc
+/// @{
+
+/// A batch of elements of one reference object type handed to an element disc
+/**
+ * The batch holds up to MAX_SIZE elements of the same reference object type
+ * with the same number of dofs per function. For each element the corner
+ * coordinates, the local indices, the local solution and local storage for
+ * the Jacobian, the defect and the right-hand side are available, e.g. to
+ * process the elements one by one.
+ *
+ * In addition, the corner coordinates and the local solution of all elements
+ * are provided in structure-of-arrays form ("lanes"): for a fixed corner and
+ * coordinate (resp. function and dof) the values of all elements of the batch
+ * are stored contiguously, allowing implementations to vectorize over the
+ * elements. The lanes are set up by pack() and are indexed by the functions
+ * accessible by the last access_by_map() (or all functions).
+ *
+ * \tparam	dim		world dimension
+ */
+template <int dim>
+class LocalElemBatch
+{
+	public:
+	///	maximal number of elements in a batch
+		static const size_t MAX_SIZE = 32;
+
+	public:
+	///	Constructor
+		LocalElemBatch() : m_roid(ROID_UNKNOWN), m_numCo(0), m_size(0) {}
+
+	///	initializes an empty batch for elements of a reference object type
+		void init(ReferenceObjectID roid, size_t numCo)
+		{
+			m_roid = roid;
+			m_numCo = numCo;
+			m_size = 0;
+			m_vElem.resize(MAX_SIZE);
+			m_vCornerCoords.resize(MAX_SIZE * numCo);
+			m_vIndex.resize(MAX_SIZE);
+			m_vU.resize(MAX_SIZE);
+			m_vD.resize(MAX_SIZE);
+			m_vRhs.resize(MAX_SIZE);
+			m_vJ.resize(MAX_SIZE);
+		}
+
+	///	removes all elements from the batch
+		void clear() {m_size = 0;}
+
+	///	returns the number of elements in the batch
+		size_t size() const {return m_size;}
+
+	///	returns if no element is in the batch
+		bool empty() const {return m_size == 0;}
+
+	///	returns the reference object id of the elements
+		ReferenceObjectID roid() const {return m_roid;}
+
+	///	returns the number of corners of the elements
+		size_t num_corners() const {return m_numCo;}
+
+	///	returns if an element with the given indices can be added to the batch
+		bool fits(const LocalIndices& ind) const
+		{
+			if(m_size == 0) return true;
+			if(m_size == MAX_SIZE) return false;
+
+			const LocalIndices& first = m_vIndex[0];
+			if(first.num_fct() != ind.num_fct()) return false;
+			for(size_t fct = 0; fct < ind.num_fct(); ++fct)
+				if(first.num_dof(fct) != ind.num_dof(fct)) return false;
+			return true;
+		}
+
+	///	adds an element to the batch and returns its position in the batch
+	/**
+	 * The local algebra of the element is resized for the indices, but the
+	 * values of the local solution have to be set by the caller.
+	 */
+		size_t push_back(GridObject* elem, const MathVector<dim> vCornerCoords[],
+		                 const LocalIndices& ind)
+		{
+			UG_ASSERT(fits(ind), "Element does not fit to the batch.");
+			const size_t e = m_size++;
+
+			m_vElem[e] = elem;
+			for(size_t co = 0; co < m_numCo; ++co)
+				m_vCornerCoords[e*m_numCo + co] = vCornerCoords[co];
+
+			m_vIndex[e] = ind;
+			m_vU[e].resize(m_vIndex[e]);
+			m_vD[e].resize(m_vIndex[e]);
+			m_vRhs[e].resize(m_vIndex[e]);
+			m_vJ[e].resize(m_vIndex[e]);
+			return e;
+		}
+
+	///	sets up the lanes from the local solutions and the corner coordinates
+		void pack()
+		{
+			if(m_size == 0) return;
+
+		//	offsets of the functions (same for all elements of the batch)
+			const LocalIndices& ind = m_vIndex[0];
+			m_vOffset.resize(ind.num_fct() + 1);
+			m_vOffset[0] = 0;
+			for(size_t fct = 0; fct < ind.num_fct(); ++fct)
+				m_vOffset[fct+1] = m_vOffset[fct] + ind.num_dof(fct);
+
+			m_vULanes.resize(m_vOffset.back() * MAX_SIZE);
+			for(size_t e = 0; e < m_size; ++e)
+				for(size_t fct = 0; fct < ind.num_fct(); ++fct)
+					for(size_t dof = 0; dof < ind.num_dof(fct); ++dof)
+						m_vULanes[(m_vOffset[fct] + dof) * MAX_SIZE + e]
+						          = m_vU[e].value(fct, dof);
+
+			m_vCoordLanes.resize(m_numCo * dim * MAX_SIZE);
+			for(size_t e = 0; e < m_size; ++e)
+				for(size_t co = 0; co < m_numCo; ++co)
+					for(int d = 0; d < dim; ++d)
+						m_vCoordLanes[(co * dim + d) * MAX_SIZE + e]
+						          = m_vCornerCoords[e*m_numCo + co][d];
+
+			access_all();
+		}
+
+	///	access only part of the functions using mapping (restrict functions)
+		void access_by_map(const FunctionIndexMapping& funcMap)
+		{
+			for(size_t e = 0; e < m_size; ++e)
+			{
+				m_vU[e].access_by_map(funcMap);
+				m_vD[e].access_by_map(funcMap);
+				m_vRhs[e].access_by_map(funcMap);
+				m_vJ[e].access_by_map(funcMap);
+			}
+
+			m_vAccOffset.resize(funcMap.num_fct());
+			for(size_t i = 0; i < funcMap.num_fct(); ++i)
+				m_vAccOffset[i] = m_vOffset[funcMap[i]];
+		}
+
+	///	access all functions
+		void access_all()
+		{
+			for(size_t e = 0; e < m_size; ++e)
+			{
+				m_vU[e].access_all();
+				m_vD[e].access_all();
+				m_vRhs[e].access_all();
+				m_vJ[e].access_all();
+			}
+
+			if(m_vOffset.empty()) {m_vAccOffset.clear(); return;}
+			m_vAccOffset.assign(m_vOffset.begin(), m_vOffset.end() - 1);
+		}
+
+		///////////////////////////
+		// per element access
+		///////////////////////////
+
+	///	returns the e'th element
+		GridObject* elem(size_t e) const {check_elem(e); return m_vElem[e];}
+
+	///	returns the corner coordinates of the e'th element
+		const MathVector<dim>* corner_coords(size_t e) const
+		{
+			check_elem(e);
+			return &m_vCornerCoords[e*m_numCo];
+		}
+
+	///	returns the local indices of the e'th element
+		const LocalIndices& indices(size_t e) const {check_elem(e); return m_vIndex[e];}
+
+	///	returns the local solution of the e'th element
+		LocalVector& u(size_t e) {check_elem(e); return m_vU[e];}
+
+	///	returns the local defect of the e'th element
+		LocalVector& d(size_t e) {check_elem(e); return m_vD[e];}
+
+	///	returns the local right-hand side of the e'th element
+		LocalVector& rhs(size_t e) {check_elem(e); return m_vRhs[e];}
+
+	///	returns the local Jacobian of the e'th element
+		LocalMatrix& J(size_t e) {check_elem(e); return m_vJ[e];}
+
+		///////////////////////////
+		// lane access
+		///////////////////////////
+
+	///	returns the coordinate d of corner co of all elements (MAX_SIZE entries)
+		const number* corner_coord_lanes(size_t co, size_t d) const
+		{
+			UG_ASSERT(co < m_numCo && d < (size_t)dim, "Wrong index.");
+			return &m_vCoordLanes[(co * dim + d) * MAX_SIZE];
+		}
+
+	///	returns the solution at (fct, dof) of all elements (MAX_SIZE entries)
+		const number* u_lanes(size_t fct, size_t dof) const
+		{
+			UG_ASSERT(fct < m_vAccOffset.size(), "Wrong index.");
+			return &m_vULanes[(m_vAccOffset[fct] + dof) * MAX_SIZE];
+		}
+
+	protected:
+	///	checks correct element index in debug mode
+		inline void check_elem(size_t e) const
+		{
+			UG_ASSERT(e < m_size, "Wrong index: "<<e<<" of batch size "<<m_size);
+		}
+
+	protected:
+	///	reference object id of the elements
+		ReferenceObjectID m_roid;
+
+	///	number of corners per element
+		size_t m_numCo;
+
+	///	number of elements in the batch
+		size_t m_size;
+
+	///	elements
+		std::vector<GridObject*> m_vElem;
+
+	///	corner coordinates (element by element)
+		std::vector<MathVector<dim> > m_vCornerCoords;
+
+	///	local indices, solutions, defects, right-hand sides and Jacobians
+	/// \{
+		std::vector<LocalIndices> m_vIndex;
+		std::vector<LocalVector> m_vU, m_vD, m_vRhs;
+		std::vector<LocalMatrix> m_vJ;
+	/// \}
+
+	///	offsets of the functions in the local solution (size: num fct + 1)
+		std::vector<size_t> m_vOffset;
+
+	///	offsets of the accessible functions
+		std::vector<size_t> m_vAccOffset;
+
+	///	lanes of the local solution and the corner coordinates
+	/// \{
+		std::vector<number> m_vULanes;
+		std::vector<number> m_vCoordLanes;
+	/// \}
+};
+
+/// @}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__SPATIAL_DISC__ELEM_DISC__ELEM_BATCH__ */
@@ -353,6 +353,19 @@ public:
 	//	prepare element loop
 		Eval.prepare_elem_loop(id, si);
 
+	//	incremental assembling: only elements with changed solution are computed
+		const bool bIncremental = spAssTuner->incremental_jacobian_enabled();
+		if(bIncremental)
+			spAssTuner->prepare_incremental_jacobian(dd, false, 0.0, 1.0);
+
+	//	assemble in batches of elements, if supported by the elem discs
+		if(!bIncremental && Eval.batch_assembling_possible(id, false))
+		{
+			AssembleJacobianBatched<TElem>(Eval, spDomain, dd, iterBegin, iterEnd,
+			                               J, u, spAssTuner);
+			return;
+		}
+
 	//	local indices and local algebra
 		LocalIndices ind; LocalVector locU; LocalMatrix locJ;
 
@@ -377,12 +390,324 @@ public:
 		//	read local values of u
 			GetLocalVector(locU, u);
 
+		//	compute local Jacobian, unless the stored one can be reused
+			if(!bIncremental || !spAssTuner->reuse_local_jacobian(elem, locU, locJ))
+			{
+			//	prepare element
+				try
+				{
+					Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+				}
+				UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot prepare element.");
+
+			//	reset local algebra
+				locJ = 0.0;
+
+			//	Assemble JA
+				try
+				{
+					Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords);
+				}
+				UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot compute Jacobian (A).");
+
+				if(bIncremental)
+					spAssTuner->store_local_jacobian(elem, locU, locJ);
+			}
+
+		// send local to global matrix
+			try{
+				spAssTuner->add_local_mat_to_global(J, locJ, dd);
+			}
+			UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot add local matrix.");
+		}
+
+	//	finish element loop
+		try
+		{
+			Eval.finish_elem_loop();
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot finish element loop.");
+
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot create Data Evaluator.");
+	}
+
+protected:
+	/**
+	 * This function assembles the Jacobian for the elements in a given
+	 * interval in batches of elements (see LocalElemBatch). The data evaluator
+	 * must have been prepared for the element loop and is finished here.
+	 */
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleJacobianBatched(DataEvaluator<domain_type>& Eval,
+							ConstSmartPtr<domain_type> spDomain,
+							ConstSmartPtr<DoFDistribution> dd,
+							TIterator iterBegin,
+							TIterator iterEnd,
+							matrix_type& J,
+							const vector_type& u,
+							ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+	//	storage for corner coordinates
+		MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+
+	//	local indices and batch of elements
+		LocalIndices ind;
+		LocalElemBatch<domain_type::dim> batch;
+		batch.init(id, TElem::NUM_VERTICES);
+
+	//	Loop over all elements
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get Element
+			TElem* elem = *iter;
+
+		//	check if elem is skipped from assembling
+			if(!spAssTuner->element_used(elem)) continue;
+
+		//	get corner coordinates and global indices
+			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			dd->indices(elem, ind, Eval.use_hanging());
+
+		//	assemble the batch, if full or not matching
+			if(!batch.fits(ind))
+				AssembleJacobianBatch(Eval, batch, dd, J, spAssTuner);
+
+		//	add element and read local values of u
+			const size_t e = batch.push_back(elem, vCornerCoords, ind);
+			GetLocalVector(batch.u(e), u);
+		}
+
+	//	assemble remaining elements
+		AssembleJacobianBatch(Eval, batch, dd, J, spAssTuner);
+
+	//	finish element loop
+		try
+		{
+			Eval.finish_elem_loop();
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot finish element loop.");
+	}
+
+	///	assembles the Jacobian of one batch and empties the batch
+	static void
+	AssembleJacobianBatch(DataEvaluator<domain_type>& Eval,
+						  LocalElemBatch<domain_type::dim>& batch,
+						  ConstSmartPtr<DoFDistribution> dd,
+						  matrix_type& J,
+						  ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+		if(batch.empty()) return;
+
+	//	reset local algebra
+		batch.pack();
+		for(size_t e = 0; e < batch.size(); ++e)
+			batch.J(e) = 0.0;
+
+	//	Assemble JA
+		try
+		{
+			Eval.add_jac_A_batch(batch);
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot compute Jacobian (A).");
+
+	// send local to global matrix
+		try{
+			for(size_t e = 0; e < batch.size(); ++e)
+				spAssTuner->add_local_mat_to_global(J, batch.J(e), dd);
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot add local matrix.");
+
+		batch.clear();
+	}
+
+	/**
+	 * This function assembles the defect for the elements in a given
+	 * interval in batches of elements (see LocalElemBatch). The data evaluator
+	 * must have been prepared for the element loop and is finished here.
+	 */
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleDefectBatched(DataEvaluator<domain_type>& Eval,
+						  ConstSmartPtr<domain_type> spDomain,
+						  ConstSmartPtr<DoFDistribution> dd,
+						  TIterator iterBegin,
+						  TIterator iterEnd,
+						  vector_type& d,
+						  const vector_type& u,
+						  ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+	//	storage for corner coordinates
+		MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+
+	//	local indices and batch of elements
+		LocalIndices ind;
+		LocalElemBatch<domain_type::dim> batch;
+		batch.init(id, TElem::NUM_VERTICES);
+
+	//	Loop over all elements
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get Element
+			TElem* elem = *iter;
+
+		//	check if elem is skipped from assembling
+			if(!spAssTuner->element_used(elem)) continue;
+
+		//	get corner coordinates and global indices
+			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			dd->indices(elem, ind, Eval.use_hanging());
+
+		//	assemble the batch, if full or not matching
+			if(!batch.fits(ind))
+				AssembleDefectBatch(Eval, batch, dd, d, spAssTuner);
+
+		//	add element and read local values of u
+			const size_t e = batch.push_back(elem, vCornerCoords, ind);
+			GetLocalVector(batch.u(e), u);
+		}
+
+	//	assemble remaining elements
+		AssembleDefectBatch(Eval, batch, dd, d, spAssTuner);
+
+	//	finish element loop
+		try
+		{
+			Eval.finish_elem_loop();
+		}
+		UG_CATCH_THROW("(stationary) AssembleDefect: Cannot finish element loop.");
+	}
+
+	///	assembles the defect of one batch and empties the batch
+	static void
+	AssembleDefectBatch(DataEvaluator<domain_type>& Eval,
+						LocalElemBatch<domain_type::dim>& batch,
+						ConstSmartPtr<DoFDistribution> dd,
+						vector_type& d,
+						ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+		if(batch.empty()) return;
+
+	//	reset local algebra
+		batch.pack();
+		for(size_t e = 0; e < batch.size(); ++e)
+		{
+			batch.d(e) = 0.0;
+			batch.rhs(e) = 0.0;
+		}
+
+	//	Assemble A and rhs
+		try
+		{
+			Eval.add_def_batch(batch);
+		}
+		UG_CATCH_THROW("(stationary) AssembleDefect: Cannot compute Defect.");
+
+	//	send local to global defect
+		try{
+			for(size_t e = 0; e < batch.size(); ++e)
+			{
+				batch.d(e).scale_append(-1, batch.rhs(e));
+				spAssTuner->add_local_vec_to_global(d, batch.d(e), dd);
+			}
+		}
+		UG_CATCH_THROW("(stationary) AssembleDefect: Cannot add local vector.");
+
+		batch.clear();
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+// Apply (stationary) Jacobian matrix-free
+////////////////////////////////////////////////////////////////////////////////
+
+public:
+	/**
+	 * This function adds the action of the Jacobian of all passed element
+	 * discretizations on one given subset to the vector d, i.e. d += J(u) c,
+	 * without assembling the global matrix. The element-local Jacobians are
+	 * recomputed on the fly. (This version processes elements in a given
+	 * interval.)
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		spDomain		domain
+	 * \param[in]		iterBegin		element iterator
+	 * \param[in]		iterEnd			element iterator
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in,out]	d				result
+	 * \param[in]		c				vector the jacobian is applied to
+	 * \param[in]		u				solution
+	 * \param[in]		spAssTuner		assemble adapter
+	 */
+	template <typename TElem, typename TIterator>
+	static void
+	ApplyJacobian(		const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+						ConstSmartPtr<domain_type> spDomain,
+						ConstSmartPtr<DoFDistribution> dd,
+						TIterator iterBegin,
+						TIterator iterEnd,
+						int si, bool bNonRegularGrid,
+						vector_type& d,
+						const vector_type& c,
+						const vector_type& u,
+						ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+	//	check if there are any elements at all, otherwise return immediately
+		if(iterBegin == iterEnd) return;
+
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+	//	storage for corner coordinates
+		MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+
+	//	prepare for given elem discs
+		try
+		{
+		DataEvaluator<domain_type> Eval(STIFF | RHS,
+						   vElemDisc, dd->function_pattern(), bNonRegularGrid);
+
+	//	prepare element loop
+		Eval.prepare_elem_loop(id, si);
+
+	//	local indices and local algebra
+		LocalIndices ind; LocalVector locU, locC; LocalMatrix locJ;
+
+	//	Loop over all elements
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get Element
+			TElem* elem = *iter;
+
+		//	get corner coordinates
+			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+
+		//	check if elem is skipped from assembling
+			if(!spAssTuner->element_used(elem)) continue;
+
+		//	get global indices
+			dd->indices(elem, ind, Eval.use_hanging());
+
+		//	adapt local algebra
+			locU.resize(ind); locC.resize(ind); locJ.resize(ind);
+
+		//	read local values of u and c
+			GetLocalVector(locU, u);
+			GetLocalVector(locC, c);
+
 		//	prepare element
 			try
 			{
 				Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
 			}
-			UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot prepare element.");
+			UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot prepare element.");
 
 		//	reset local algebra
 			locJ = 0.0;
@@ -392,13 +717,13 @@ public:
 			{
 				Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords);
 			}
-			UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot compute Jacobian (A).");
+			UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot compute Jacobian (A).");
 
-		// send local to global matrix
+		// send local product to global vector
 			try{
-				spAssTuner->add_local_mat_to_global(J, locJ, dd);
+				spAssTuner->add_local_mat_vec_to_global(d, locJ, locC, dd);
 			}
-			UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot add local matrix.");
+			UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot add local product.");
 		}
 
 	//	finish element loop
@@ -406,10 +731,115 @@ public:
 		{
 			Eval.finish_elem_loop();
 		}
-		UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot finish element loop.");
+		UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot finish element loop.");
 
 		}
-		UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot create Data Evaluator.");
+		UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot create Data Evaluator.");
+	}
+
+	/**
+	 * This function adds the (block-)diagonal of the Jacobian of all passed
+	 * element discretizations on one given subset to the matrix D. Only
+	 * couplings of a dof index with itself are written. (This version
+	 * processes elements in a given interval.)
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		spDomain		domain
+	 * \param[in]		iterBegin		element iterator
+	 * \param[in]		iterEnd			element iterator
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in,out]	D				diagonal of the jacobian
+	 * \param[in]		u				solution
+	 * \param[in]		spAssTuner		assemble adapter
+	 */
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleJacobianDiagonal(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+						ConstSmartPtr<domain_type> spDomain,
+						ConstSmartPtr<DoFDistribution> dd,
+						TIterator iterBegin,
+						TIterator iterEnd,
+						int si, bool bNonRegularGrid,
+						matrix_type& D,
+						const vector_type& u,
+						ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+	//	check if there are any elements at all, otherwise return immediately
+		if(iterBegin == iterEnd) return;
+
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+	//	storage for corner coordinates
+		MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+
+	//	prepare for given elem discs
+		try
+		{
+		DataEvaluator<domain_type> Eval(STIFF | RHS,
+						   vElemDisc, dd->function_pattern(), bNonRegularGrid);
+
+	//	prepare element loop
+		Eval.prepare_elem_loop(id, si);
+
+	//	local indices and local algebra
+		LocalIndices ind; LocalVector locU; LocalMatrix locJ;
+
+	//	Loop over all elements
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get Element
+			TElem* elem = *iter;
+
+		//	get corner coordinates
+			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+
+		//	check if elem is skipped from assembling
+			if(!spAssTuner->element_used(elem)) continue;
+
+		//	get global indices
+			dd->indices(elem, ind, Eval.use_hanging());
+
+		//	adapt local algebra
+			locU.resize(ind); locJ.resize(ind);
+
+		//	read local values of u
+			GetLocalVector(locU, u);
+
+		//	prepare element
+			try
+			{
+				Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+			}
+			UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot prepare element.");
+
+		//	reset local algebra
+			locJ = 0.0;
+
+		//	Assemble JA
+			try
+			{
+				Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords);
+			}
+			UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot compute Jacobian (A).");
+
+		// send local diagonal to global matrix
+			try{
+				spAssTuner->add_local_mat_diag_to_global(D, locJ, dd);
+			}
+			UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot add local matrix.");
+		}
+
+	//	finish element loop
+		try
+		{
+			Eval.finish_elem_loop();
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot finish element loop.");
+
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot create Data Evaluator.");
 	}
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -475,6 +905,12 @@ public:
 	//	prepare element loop
 		Eval.prepare_elem_loop(id, si);
 
+	//	incremental assembling: only elements with changed solution are computed
+	//	(the previous solutions do not change for a fixed time point)
+		const bool bIncremental = spAssTuner->incremental_jacobian_enabled();
+		if(bIncremental)
+			spAssTuner->prepare_incremental_jacobian(dd, true, vSol->time(0), s_a0);
+
 	//	local algebra
 		LocalIndices ind; LocalVector locU; LocalMatrix locJ;
 
@@ -500,38 +936,45 @@ public:
 		//	read local values of u
 			GetLocalVector(locU, u);
 
-		//	read local values of time series
-			if(Eval.time_series_needed())
-				locTimeSeries.read_values(vSol, ind);
-
-		//	prepare element
-			try
+		//	compute local Jacobian, unless the stored one can be reused
+			if(!bIncremental || !spAssTuner->reuse_local_jacobian(elem, locU, locJ))
 			{
-				Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
-			}
-			UG_CATCH_THROW("(instationary) AssembleJacobian: Cannot prepare element.");
+			//	read local values of time series
+				if(Eval.time_series_needed())
+					locTimeSeries.read_values(vSol, ind);
 
-		//	reset local algebra
-			locJ = 0.0;
+			//	prepare element
+				try
+				{
+					Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+				}
+				UG_CATCH_THROW("(instationary) AssembleJacobian: Cannot prepare element.");
 
-			//EL_PROFILE_BEGIN(Elem_add_JA);
-			//	Assemble JA
-			try
-			{
-				Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords, PT_INSTATIONARY);
-				locJ *= s_a0;
+			//	reset local algebra
+				locJ = 0.0;
 
-				Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords, PT_STATIONARY);
-			}
-			UG_CATCH_THROW("(instationary) AssembleJacobian: Cannot compute Jacobian (A).");
-			//EL_PROFILE_END();
+				//EL_PROFILE_BEGIN(Elem_add_JA);
+				//	Assemble JA
+				try
+				{
+					Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords, PT_INSTATIONARY);
+					locJ *= s_a0;
 
-		//	Assemble JM
-			try
-			{
-				Eval.add_jac_M_elem(locJ, locU, elem, vCornerCoords, PT_INSTATIONARY);
+					Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords, PT_STATIONARY);
+				}
+				UG_CATCH_THROW("(instationary) AssembleJacobian: Cannot compute Jacobian (A).");
+				//EL_PROFILE_END();
+
+			//	Assemble JM
+				try
+				{
+					Eval.add_jac_M_elem(locJ, locU, elem, vCornerCoords, PT_INSTATIONARY);
+				}
+				UG_CATCH_THROW("(instationary) AssembleJacobian: Cannot compute Jacobian (M).");
+
+				if(bIncremental)
+					spAssTuner->store_local_jacobian(elem, locU, locJ);
 			}
-			UG_CATCH_THROW("(instationary) AssembleJacobian: Cannot compute Jacobian (M).");
 
 		// send local to global matrix
 			try{
@@ -604,6 +1047,15 @@ public:
 	//	prepare element loop
 		Eval.prepare_elem_loop(id, si);
 
+	//	assemble in batches of elements, if supported by the elem discs
+		if(!spAssTuner->modify_solution_enabled()
+			&& Eval.batch_assembling_possible(id, true))
+		{
+			AssembleDefectBatched<TElem>(Eval, spDomain, dd, iterBegin, iterEnd,
+			                             d, u, spAssTuner);
+			return;
+		}
+
 	//	local indices and local algebra
 		LocalIndices ind; LocalVector locU, locD, tmpLocD;
 
@@ -37,7 +37,7 @@ namespace ug{
 
 template <typename TDomain>
 IElemDiscBase<TDomain>::IElemDiscBase(const char* functions, const char* subsets)
-	:	m_spApproxSpace(NULL), m_spFctPattern(0),
+	:	m_spApproxSpace(NULL), m_pSH(NULL), m_spFctPattern(0),
 	  	m_timePoint(0), m_pLocalVectorTimeSeries(NULL), m_bStationaryForced(false)
 		//,m_id(ROID_UNKNOWN)
 {
@@ -53,7 +53,7 @@ template <typename TDomain>
 IElemDiscBase<TDomain>::
 IElemDiscBase(const std::vector<std::string>& vFct,
                               const std::vector<std::string>& vSubset)
-	: 	m_spApproxSpace(NULL), m_spFctPattern(0),
+	: 	m_spApproxSpace(NULL), m_pSH(NULL), m_spFctPattern(0),
 		m_timePoint(0), m_pLocalVectorTimeSeries(NULL), m_bStationaryForced(false)
 		//,m_id(ROID_UNKNOWN)
 {
@@ -72,6 +72,7 @@ set_approximation_space(SmartPtr<ApproximationSpace<TDomain> > approxSpace)
 
 //	remember approx space
 	m_spApproxSpace = approxSpace;
+	m_pSH = approxSpace->domain()->subset_handler().get();
 
 //	set function pattern
 	set_function_pattern(approxSpace->dof_distribution_info());
@@ -99,6 +100,9 @@ void IElemAssembleFuncs<TLeaf, TDomain>::clear_add_fct(ReferenceObjectID id)
 	m_vElemdMFct[id] = NULL;
 
 	m_vElemRHSFct[id] = NULL;
+
+	m_vElemJABatchFct[id] = NULL;
+	m_vElemdBatchFct[id] = NULL;
 }
 
 
@@ -198,6 +202,9 @@ set_default_add_fct()
 		m_vElemdMFct[i] = &T::add_def_M_elem;
 
 		m_vElemRHSFct[i] = &T::add_rhs_elem;
+
+		m_vElemJABatchFct[i] = NULL;
+		m_vElemdBatchFct[i] = NULL;
 	}
 
 	for (size_t i = 0; i < bridge::NUM_ALGEBRA_TYPES; ++i)
@@ -657,6 +664,51 @@ do_add_rhs_elem(LocalVector& rhs, GridObject* elem, const MathVector<dim> vCorne
 	(this->*m_vElemRHSFct[m_roid])(rhs, elem, vCornerCoords);
 }
 
+template <typename TLeaf, typename TDomain>
+void IElemAssembleFuncs<TLeaf, TDomain>::
+do_add_jac_A_batch(LocalElemBatch<dim>& batch)
+{
+	//	process element by element, if no batched implementation given
+	if(m_vElemJABatchFct[m_roid] == NULL)
+	{
+		for(size_t e = 0; e < batch.size(); ++e)
+		{
+			do_prep_elem(batch.u(e), batch.elem(e), m_roid, batch.corner_coords(e));
+			do_add_jac_A_elem(batch.J(e), batch.u(e), batch.elem(e), batch.corner_coords(e));
+		}
+		return;
+	}
+
+	//	access by map
+	batch.access_by_map(asLeaf().map());
+
+	//	call assembling routine
+	(this->*m_vElemJABatchFct[m_roid])(batch);
+}
+
+template <typename TLeaf, typename TDomain>
+void IElemAssembleFuncs<TLeaf, TDomain>::
+do_add_def_batch(LocalElemBatch<dim>& batch)
+{
+	//	process element by element, if no batched implementation given
+	if(m_vElemdBatchFct[m_roid] == NULL)
+	{
+		for(size_t e = 0; e < batch.size(); ++e)
+		{
+			do_prep_elem(batch.u(e), batch.elem(e), m_roid, batch.corner_coords(e));
+			do_add_def_A_elem(batch.d(e), batch.u(e), batch.elem(e), batch.corner_coords(e));
+			do_add_rhs_elem(batch.rhs(e), batch.elem(e), batch.corner_coords(e));
+		}
+		return;
+	}
+
+	//	access by map
+	batch.access_by_map(asLeaf().map());
+
+	//	call assembling routine
+	(this->*m_vElemdBatchFct[m_roid])(batch);
+}
+
 template <typename TLeaf, typename TDomain>
 void IElemEstimatorFuncs<TLeaf, TDomain>::
 do_prep_err_est_elem_loop(const ReferenceObjectID roid, const int si)
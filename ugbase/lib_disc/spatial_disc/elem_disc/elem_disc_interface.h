@@ -48,6 +48,7 @@
 #include "lib_disc/domain_util.h"
 #include "lib_disc/domain_traits.h"
 #include "elem_modifier.h"
+#include "elem_batch.h"
 #include "lib_disc/spatial_disc/elem_disc/err_est_data.h"
 #include "bridge/util_algebra_dependent.h"
 #include "lib_disc/common/multi_index.h"
@@ -192,7 +193,27 @@ public:
 	void do_add_def_A_expl_elem(LocalVector& d, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[]);
 	void do_add_def_M_elem(LocalVector& d, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[]);
 	void do_add_rhs_elem(LocalVector& rhs, GridObject* elem, const MathVector<dim> vCornerCoords[]);
+	/// \}
 
+	///	function dispatching batched calls to implementation
+	/**
+	 * The batched functions prepare and assemble all elements of the batch.
+	 * The Jacobian function adds the stiffness part to J(e), the defect
+	 * function adds the stiffness part to d(e) and the right-hand side to
+	 * rhs(e). If no batched implementation is registered for the current
+	 * reference object id, the elements are processed one by one using the
+	 * registered per element functions (prep_elem and add_*_elem).
+	 * \{
+	 */
+	void do_add_jac_A_batch(LocalElemBatch<dim>& batch);
+	void do_add_def_batch(LocalElemBatch<dim>& batch);
+	/// \}
+
+	///	returns if a batched implementation is registered for the Jacobian (A)
+	bool has_add_jac_A_batch_fct(ReferenceObjectID id) const {return m_vElemJABatchFct[id] != NULL;}
+
+	///	returns if a batched implementation is registered for the defect
+	bool has_add_def_batch_fct(ReferenceObjectID id) const {return m_vElemdBatchFct[id] != NULL;}
 
 
 
@@ -214,6 +235,9 @@ protected:
 	template <typename TAssFunc> void set_add_def_M_elem_fct(ReferenceObjectID id, TAssFunc func);
 	template <typename TAssFunc> void set_add_rhs_elem_fct(ReferenceObjectID id, TAssFunc func);
 
+	template <typename TAssFunc> void set_add_jac_A_batch_fct(ReferenceObjectID id, TAssFunc func);
+	template <typename TAssFunc> void set_add_def_batch_fct(ReferenceObjectID id, TAssFunc func);
+
 
 
 	//	unregister functions
@@ -233,6 +257,9 @@ protected:
 	void remove_add_def_M_elem_fct(ReferenceObjectID id);
 	void remove_add_rhs_elem_fct(ReferenceObjectID id);
 
+	void remove_add_jac_A_batch_fct(ReferenceObjectID id);
+	void remove_add_def_batch_fct(ReferenceObjectID id);
+
 protected:
 	///	sets all assemble functions to the corresponding virtual ones
 	void set_default_add_fct();
@@ -269,6 +296,10 @@ private:
 // 	types of right hand side assemble functions
 	typedef void (T::*ElemRHSFct)(LocalVector& rhs, GridObject* elem, const MathVector<dim> vCornerCoords[]);
 
+// 	types of batched assemble functions
+	typedef void (T::*ElemJABatchFct)(LocalElemBatch<dim>& batch);
+	typedef void (T::*ElemdBatchFct)(LocalElemBatch<dim>& batch);
+
 
 private:
 // 	timestep function pointers
@@ -294,6 +325,10 @@ private:
 // 	Rhs function pointers
 	ElemRHSFct 	m_vElemRHSFct[NUM_REFERENCE_OBJECTS];
 
+// 	Batched function pointers (NULL: processed element by element)
+	ElemJABatchFct 	m_vElemJABatchFct[NUM_REFERENCE_OBJECTS];
+	ElemdBatchFct 	m_vElemdBatchFct[NUM_REFERENCE_OBJECTS];
+
 public:
 /// sets the geometric object type
 /**
@@ -513,15 +548,15 @@ class IElemDiscBase
 	///	returns the subset handler
 		typename TDomain::subset_handler_type& subset_handler()
 		{
-			UG_ASSERT(m_spApproxSpace.valid(), "ApproxSpace not set.");
-			return *m_spApproxSpace->domain()->subset_handler();
+			UG_ASSERT(m_pSH != NULL, "ApproxSpace not set.");
+			return *m_pSH;
 		}
 
 	///	returns the subset handler
 		const typename TDomain::subset_handler_type& subset_handler() const
 		{
-			UG_ASSERT(m_spApproxSpace.valid(), "ApproxSpace not set.");
-			return *m_spApproxSpace->domain()->subset_handler();
+			UG_ASSERT(m_pSH != NULL, "ApproxSpace not set.");
+			return *m_pSH;
 		}
 /*
 		void add_elem_modifier(SmartPtr<IElemDiscModifier<TDomain> > elemModifier )
@@ -539,6 +574,10 @@ class IElemDiscBase
 	///	Approximation Space
 		SmartPtr<ApproximationSpace<TDomain> > m_spApproxSpace;
 
+	///	subset handler of the domain (accessed per element, thus stored
+	///	without smart pointer, s.t. no reference counter is modified)
+		typename TDomain::subset_handler_type* m_pSH;
+
 	///	Approximation Space
 	//	std::vector<SmartPtr<IElemDiscModifier<TDomain> > > m_spElemModifier;
 
@@ -851,6 +890,19 @@ public:
 	std::vector<SmartPtr<IElemDiscModifier<TDomain> > >& get_elem_modifier()
 	{ return m_spElemModifier;}
 
+	///	returns an independent instance of this discretization for another thread
+	/**
+	 * Element discretizations store element-wise data (e.g. imports and the
+	 * user data connected to them), thus a threaded assembling needs one
+	 * instance per thread (cf. ThreadedDomainDiscretization). A discretization
+	 * supporting this returns a new instance with the same settings that does
+	 * not share any mutable data with this one. Geometries must be obtained
+	 * from the GeomProvider, which holds them per thread. The approximation
+	 * space is set by the caller. The default returns SPNULL, which makes the
+	 * threaded assembler fall back to the sequential assembling.
+	 */
+	virtual SmartPtr<IElemDisc<TDomain> > clone_for_thread() {return SPNULL;}
+
 protected:
 	///	Approximation Space
 	std::vector<SmartPtr<IElemDiscModifier<TDomain> > > m_spElemModifier;
@@ -175,6 +175,30 @@ void IElemAssembleFuncs<TLeaf, TDomain>::remove_add_rhs_elem_fct(ReferenceObject
 	m_vElemRHSFct[id] = NULL;
 };
 
+template <typename TLeaf, typename TDomain>
+template<typename TAssFunc>
+void IElemAssembleFuncs<TLeaf, TDomain>::set_add_jac_A_batch_fct(ReferenceObjectID id, TAssFunc func)
+{
+	m_vElemJABatchFct[id] = static_cast<ElemJABatchFct>(func);
+};
+template <typename TLeaf, typename TDomain>
+void IElemAssembleFuncs<TLeaf, TDomain>::remove_add_jac_A_batch_fct(ReferenceObjectID id)
+{
+	m_vElemJABatchFct[id] = NULL;
+};
+
+template <typename TLeaf, typename TDomain>
+template<typename TAssFunc>
+void IElemAssembleFuncs<TLeaf, TDomain>::set_add_def_batch_fct(ReferenceObjectID id, TAssFunc func)
+{
+	m_vElemdBatchFct[id] = static_cast<ElemdBatchFct>(func);
+};
+template <typename TLeaf, typename TDomain>
+void IElemAssembleFuncs<TLeaf, TDomain>::remove_add_def_batch_fct(ReferenceObjectID id)
+{
+	m_vElemdBatchFct[id] = NULL;
+};
+
 template <typename TLeaf, typename TDomain>
 template<typename TAssFunc>
 void IElemAssembleFuncs<TLeaf, TDomain>::set_fsh_timestep_fct(size_t algebra_id, TAssFunc func)
@@ -33,6 +33,7 @@
 #include "neumann_boundary_fv1.h"
 #include "lib_disc/spatial_disc/disc_util/fv1_geom.h"
 #include "lib_disc/spatial_disc/disc_util/geom_provider.h"
+#include "lib_disc/spatial_disc/disc_util/geom_cache.h"
 
 namespace ug{
 
@@ -43,7 +44,8 @@ namespace ug{
 
 template<typename TDomain>
 NeumannBoundaryFV1<TDomain>::NeumannBoundaryFV1(const char* function)
- :NeumannBoundaryBase<TDomain>(function)
+ :NeumannBoundaryBase<TDomain>(function),
+  m_bGeomCache(false), m_geomCacheMemory(0)
 {
 	register_all_funcs(false);
 }
@@ -97,6 +99,42 @@ void NeumannBoundaryFV1<TDomain>::update_subset_groups()
 		update_subset_groups(m_vVectorData[i]);
 }
 
+template<typename TDomain>
+SmartPtr<IElemDisc<TDomain> > NeumannBoundaryFV1<TDomain>::clone_for_thread()
+{
+	if(!this->m_spElemModifier.empty()) return SPNULL;
+
+	SmartPtr<this_type> spClone = make_sp(new this_type(this->symb_fcts()[0].c_str()));
+
+//	add copies of the user data for the same subsets
+	for(size_t i = 0; i < m_vNumberData.size(); ++i){
+		SmartPtr<CplUserData<number, dim> > spData
+			= m_vNumberData[i].import.user_data()->clone_for_thread();
+		if(spData.invalid()) return SPNULL;
+		spClone->add(spData, m_vNumberData[i].BndSubsetNames.c_str(),
+		             m_vNumberData[i].InnerSubsetNames.c_str());
+	}
+	for(size_t i = 0; i < m_vBNDNumberData.size(); ++i){
+		SmartPtr<CplUserData<number, dim, bool> > spData
+			= m_vBNDNumberData[i].functor->clone_for_thread();
+		if(spData.invalid()) return SPNULL;
+		spClone->add(spData, m_vBNDNumberData[i].BndSubsetNames.c_str(),
+		             m_vBNDNumberData[i].InnerSubsetNames.c_str());
+	}
+	for(size_t i = 0; i < m_vVectorData.size(); ++i){
+		SmartPtr<CplUserData<MathVector<dim>, dim> > spData
+			= m_vVectorData[i].functor->clone_for_thread();
+		if(spData.invalid()) return SPNULL;
+		spClone->add(spData, m_vVectorData[i].BndSubsetNames.c_str(),
+		             m_vVectorData[i].InnerSubsetNames.c_str());
+	}
+
+	spClone->set_subsets(this->symb_subsets());
+	spClone->set_stationary(this->m_bStationaryForced);
+	spClone->set_geometry_cache(m_bGeomCache, m_geomCacheMemory);
+	return spClone;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //	assembling functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -110,7 +148,8 @@ prep_elem_loop(const ReferenceObjectID roid, const int si)
 	m_si = si;
 
 //	register subsetIndex at Geometry
-	static TFVGeom& geo = GeomProvider<TFVGeom >::get();
+	TFVGeom& geo = GeomProvider<TFVGeom >::get();
+	const size_t numBndSubsets = geo.num_boundary_subsets();
 
 //	request subset indices as boundary subset. This will force the
 //	creation of boundary subsets when calling geo.update
@@ -137,6 +176,14 @@ prep_elem_loop(const ReferenceObjectID roid, const int si)
 		}
 	}
 
+//	enable geometry cache; cached geometries are invalid if boundary subsets
+//	have been added, since they lack the boundary faces of those subsets
+//	(the cache may have been enabled by another instance)
+	GeomCache<TFVGeom>& cache = GeomCache<TFVGeom>::get();
+	if(geo.num_boundary_subsets() != numBndSubsets) cache.clear();
+	if(m_bGeomCache)
+		cache.enable(*this->domain()->grid(), m_geomCacheMemory);
+
 //	clear imports, since we will set them afterwards
 	this->clear_imports();
 
@@ -160,17 +207,18 @@ template<typename TElem, typename TFVGeom>
 void NeumannBoundaryFV1<TDomain>::
 prep_elem(const LocalVector& u, GridObject* elem, const ReferenceObjectID roid, const MathVector<dim> vCornerCoords[])
 {
-//  update Geometry for this element
-	static TFVGeom& geo = GeomProvider<TFVGeom >::get();
+//  update Geometry for this element (the cache forwards to the geometry, if disabled)
+	TFVGeom& geo = GeomProvider<TFVGeom >::get();
 	try{
-		geo.update(elem, vCornerCoords, &(this->subset_handler()));
+		const TFVGeom& currGeo = GeomCache<TFVGeom>::get().update(geo, elem, vCornerCoords,
+		                                                          &(this->subset_handler()));
+
+		for(size_t i = 0; i < m_vNumberData.size(); ++i)
+			if(m_vNumberData[i].InnerSSGrp.contains(m_si))
+				m_vNumberData[i].template extract_bip<TElem, TFVGeom>(currGeo);
 	}
 	UG_CATCH_THROW("NeumannBoundaryFV1::prep_elem: "
 						"Cannot update Finite Volume Geometry.");
-
-	for(size_t i = 0; i < m_vNumberData.size(); ++i)
-		if(m_vNumberData[i].InnerSSGrp.contains(m_si))
-			m_vNumberData[i].template extract_bip<TElem, TFVGeom>(geo);
 }
 
 template<typename TDomain>
@@ -178,7 +226,7 @@ template<typename TElem, typename TFVGeom>
 void NeumannBoundaryFV1<TDomain>::
 add_rhs_elem(LocalVector& d, GridObject* elem, const MathVector<dim> vCornerCoords[])
 {
-	const static TFVGeom& geo = GeomProvider<TFVGeom >::get();
+	const TFVGeom& geo = GeomCache<TFVGeom>::get().current();
 	typedef typename TFVGeom::BF BF;
 
 //	Number Data
@@ -233,13 +281,118 @@ add_rhs_elem(LocalVector& d, GridObject* elem, const MathVector<dim> vCornerCoor
 	}
 }
 
+template<typename TDomain>
+template<typename TElem, typename TFVGeom>
+void NeumannBoundaryFV1<TDomain>::
+add_jac_A_batch(LocalElemBatch<dim>& batch)
+{
+//	the boundary condition does not depend on the solution, if no imports
+//	are registered. Thus, there is nothing to assemble and the geometries
+//	need not be updated.
+}
+
+template<typename TDomain>
+template<typename TElem, typename TFVGeom>
+void NeumannBoundaryFV1<TDomain>::
+add_def_batch(LocalElemBatch<dim>& batch)
+{
+	TFVGeom& provGeo = GeomProvider<TFVGeom >::get();
+	typedef typename TFVGeom::BF BF;
+
+	UG_ASSERT(this->num_imports() == 0, "Batched assembling with imports.");
+
+//	reset integration points of the vector data (one entry per data and subset)
+	size_t numBatchIPs = 0;
+	for(size_t data = 0; data < m_vVectorData.size(); ++data)
+		if(m_vVectorData[data].InnerSSGrp.contains(m_si))
+			numBatchIPs += m_vVectorData[data].BndSSGrp.size();
+	m_vBatchIPs.resize(numBatchIPs);
+	for(size_t k = 0; k < m_vBatchIPs.size(); ++k){
+		m_vBatchIPs[k].vGloIP.clear();
+		m_vBatchIPs[k].vNormal.clear();
+		m_vBatchIPs[k].vElem.clear();
+		m_vBatchIPs[k].vNode.clear();
+	}
+
+	for(size_t e = 0; e < batch.size(); ++e)
+	{
+	//  update Geometry for this element
+		const TFVGeom* pGeo = NULL;
+		try{
+			pGeo = &GeomCache<TFVGeom>::get().update(provGeo, batch.elem(e), batch.corner_coords(e),
+			                                         &(this->subset_handler()));
+		}
+		UG_CATCH_THROW("NeumannBoundaryFV1::add_def_batch: "
+							"Cannot update Finite Volume Geometry.");
+		const TFVGeom& geo = *pGeo;
+
+		LocalVector& rhs = batch.rhs(e);
+
+	//	conditional Number Data
+		for(size_t data = 0; data < m_vBNDNumberData.size(); ++data){
+			if(!m_vBNDNumberData[data].InnerSSGrp.contains(m_si)) continue;
+			for(size_t s = 0; s < m_vBNDNumberData[data].BndSSGrp.size(); ++s)	{
+				const int si = m_vBNDNumberData[data].BndSSGrp[s];
+				const std::vector<BF>& vBF = geo.bf(si);
+
+				for(size_t i = 0; i < vBF.size(); ++i){
+					number val = 0.0;
+					if(!(*m_vBNDNumberData[data].functor)(val, vBF[i].global_ip(), this->time(), si))
+						continue;
+
+					const int co = vBF[i].node_id();
+					rhs(_C_, co) -= val * vBF[i].volume();
+				}
+			}
+		}
+
+	// 	vector data: collect integration points
+		size_t k = 0;
+		for(size_t data = 0; data < m_vVectorData.size(); ++data){
+			if(!m_vVectorData[data].InnerSSGrp.contains(m_si)) continue;
+			for(size_t s = 0; s < m_vVectorData[data].BndSSGrp.size(); ++s, ++k){
+				const int si = m_vVectorData[data].BndSSGrp[s];
+				const std::vector<BF>& vBF = geo.bf(si);
+				BatchIPs& bips = m_vBatchIPs[k];
+
+				for(size_t i = 0; i < vBF.size(); ++i){
+					bips.vGloIP.push_back(vBF[i].global_ip());
+					bips.vNormal.push_back(vBF[i].normal());
+					bips.vElem.push_back(e);
+					bips.vNode.push_back(vBF[i].node_id());
+				}
+			}
+		}
+	}
+
+// 	vector data: evaluate for all integration points of the batch at once
+	size_t k = 0;
+	for(size_t data = 0; data < m_vVectorData.size(); ++data){
+		if(!m_vVectorData[data].InnerSSGrp.contains(m_si)) continue;
+		for(size_t s = 0; s < m_vVectorData[data].BndSSGrp.size(); ++s, ++k){
+			const int si = m_vVectorData[data].BndSSGrp[s];
+			BatchIPs& bips = m_vBatchIPs[k];
+			const size_t nip = bips.vGloIP.size();
+			if(nip == 0) continue;
+
+			bips.vValue.resize(nip);
+			(*m_vVectorData[data].functor)(&bips.vValue[0], &bips.vGloIP[0],
+			                               this->time(), si, nip);
+
+			for(size_t ip = 0; ip < nip; ++ip)
+				batch.rhs(bips.vElem[ip])(_C_, bips.vNode[ip])
+					-= VecDot(bips.vValue[ip], bips.vNormal[ip]);
+		}
+	}
+}
+
 template<typename TDomain>
 template<typename TElem, typename TGeom>
 void NeumannBoundaryFV1<TDomain>::
 fsh_elem_loop()
 {
 //	remove subsetIndex from Geometry
-	static TGeom& geo = GeomProvider<TGeom >::get();
+	TGeom& geo = GeomProvider<TGeom >::get();
 
 
 //	unrequest subset indices as boundary subset. This will force the
@@ -510,7 +663,7 @@ lin_def(const LocalVector& u,
             const size_t nip)
 {
 //  get finite volume geometry
-	const static TFVGeom& geo = GeomProvider<TFVGeom>::get();
+	const TFVGeom& geo = GeomCache<TFVGeom>::get().current();
 	typedef typename TFVGeom::BF BF;
 
 	for(size_t s = 0; s < this->BndSSGrp.size(); ++s)
@@ -633,6 +786,9 @@ void NeumannBoundaryFV1<TDomain>::register_func()
 	this->set_add_def_A_elem_fct(	 id, &T::template add_def_A_elem<TElem, TFVGeom>);
 	this->set_add_def_M_elem_fct(	 id, &T::template add_def_M_elem<TElem, TFVGeom>);
 
+	this->set_add_jac_A_batch_fct(id, &T::template add_jac_A_batch<TElem, TFVGeom>);
+	this->set_add_def_batch_fct(  id, &T::template add_def_batch<TElem, TFVGeom>);
+
 	// error estimator parts
 	this->set_prep_err_est_elem_loop(id, &T::template prep_err_est_elem_loop<TElem, TFVGeom>);
 	this->set_prep_err_est_elem(id, &T::template prep_err_est_elem<TElem, TFVGeom>);
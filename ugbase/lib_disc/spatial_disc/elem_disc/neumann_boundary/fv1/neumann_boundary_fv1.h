@@ -70,6 +70,28 @@ class NeumannBoundaryFV1
 		void add(SmartPtr<CplUserData<MathVector<dim>, dim> > user, 	const char* BndSubsets, const char* InnerSubsets);
 	/// \}
 
+	///	enables caching of the element geometries (for static meshes)
+	/**
+	 * If enabled, the finite volume geometries are memoized per element
+	 * (see GeomCache) and reused in subsequent assemblings. The cache is
+	 * shared by all instances using the same geometry type in one thread.
+	 *
+	 * \param[in]	bCache		flag if geometries are cached
+	 * \param[in]	maxMemory	memory budget per element type in bytes (0 = unlimited)
+	 */
+		void set_geometry_cache(bool bCache, size_t maxMemory = 0)
+		{
+			m_bGeomCache = bCache; m_geomCacheMemory = maxMemory;
+		}
+
+	///	returns an independent instance for another thread
+	/**
+	 * The clone uses copies of the user data (cf. CplUserData::clone_for_thread).
+	 * SPNULL is returned, if a user data or an element modifier can not be
+	 * copied.
+	 */
+		virtual SmartPtr<IElemDisc<TDomain> > clone_for_thread();
+
 	protected:
 		using typename base_type::Data;
 
@@ -138,6 +160,25 @@ class NeumannBoundaryFV1
 	///	current inner subset
 		int m_si;
 
+	///	flag if element geometries are cached
+		bool m_bGeomCache;
+
+	///	memory budget of the geometry cache
+		size_t m_geomCacheMemory;
+
+	///	boundary integration points of a batch for one vector data and subset
+		struct BatchIPs
+		{
+			std::vector<MathVector<dim> > vGloIP;
+			std::vector<MathVector<dim> > vNormal;
+			std::vector<MathVector<dim> > vValue;
+			std::vector<size_t> vElem;
+			std::vector<int> vNode;
+		};
+
+	///	integration points of the vector data collected in the batched assembling
+		std::vector<BatchIPs> m_vBatchIPs;
+
 	public:
 	///	type of trial space for each function used
 		virtual void prepare_setting(const std::vector<LFEID>& vLfeID, bool bNonRegularGrid);
@@ -154,6 +195,20 @@ class NeumannBoundaryFV1
 		template<typename TElem, typename TFVGeom>
 		void add_rhs_elem(LocalVector& d, GridObject* elem, const MathVector<dim> vCornerCoords[]);
 
+	///	batched assembling of the stiffness part (empty, no imports present)
+		template<typename TElem, typename TFVGeom>
+		void add_jac_A_batch(LocalElemBatch<dim>& batch);
+
+	///	batched assembling of the right-hand side
+	/**
+	 * Batched assembling is only used, if no imports are registered, i.e. if
+	 * no unconditional number data is given for the current subset. The
+	 * vector data is evaluated once for the boundary integration points of
+	 * all elements of the batch.
+	 */
+		template<typename TElem, typename TFVGeom>
+		void add_def_batch(LocalElemBatch<dim>& batch);
+
 	///	prepares the loop over all elements of one type for the computation of the error estimator
 		template <typename TElem, typename TFVGeom>
 		void prep_err_est_elem_loop(const ReferenceObjectID roid, const int si);
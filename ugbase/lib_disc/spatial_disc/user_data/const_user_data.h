@@ -170,6 +170,10 @@ class ConstUserNumber
 	/// get value
 		number get() const {return m_Number;}
 
+	///	returns a copy of this data for another thread
+		virtual SmartPtr<CplUserData<number, dim> > clone_for_thread() const
+			{return make_sp(new ConstUserNumber<dim>(m_Number));}
+
 	protected:
 		number m_Number;
 };
@@ -214,6 +218,14 @@ class ConstUserVector
 	/// evaluate
 		inline void evaluate (MathVector<dim>& value) const{value = m_Vector;}
 
+	///	returns a copy of this data for another thread
+		virtual SmartPtr<CplUserData<MathVector<dim>, worldDim> > clone_for_thread() const
+		{
+			SmartPtr<ConstUserVector<dim, worldDim> > sp = make_sp(new ConstUserVector<dim, worldDim>());
+			sp->m_Vector = m_Vector;
+			return sp;
+		}
+
 	protected:
 		MathVector<dim> m_Vector;
 };
@@ -267,6 +279,14 @@ class ConstUserMatrix
 	///	evaluate
 		inline void evaluate (MathMatrix<N, M>& value) const{value = m_Tensor;}
 
+	///	returns a copy of this data for another thread
+		virtual SmartPtr<CplUserData<MathMatrix<N, M>, worldDim> > clone_for_thread() const
+		{
+			SmartPtr<ConstUserMatrix<N, M, worldDim> > sp = make_sp(new ConstUserMatrix<N, M, worldDim>());
+			sp->m_Tensor = m_Tensor;
+			return sp;
+		}
+
 	protected:
 		MathMatrix<N, M> m_Tensor;
 };
@@ -292,6 +312,14 @@ class ConstUserTensor
 	///	evaluate
 		inline void evaluate (MathTensor<TRank, dim>& value) const{value = m_Tensor;}
 
+	///	returns a copy of this data for another thread
+		virtual SmartPtr<CplUserData<MathTensor<TRank, dim>, dim> > clone_for_thread() const
+		{
+			SmartPtr<ConstUserTensor<TRank, dim> > sp = make_sp(new ConstUserTensor<TRank, dim>());
+			sp->m_Tensor = m_Tensor;
+			return sp;
+		}
+
 	protected:
 		MathTensor<TRank, dim> m_Tensor;
 };
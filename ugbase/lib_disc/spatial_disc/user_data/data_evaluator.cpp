@@ -31,6 +31,7 @@
  */
 
 #include <sstream>
+#include <set>
 
 #include "data_evaluator.h"
 #include "lib_disc/common/groups_util.h"
@@ -83,8 +84,70 @@ prepare_elem_loop(const ReferenceObjectID id, int si)
 				   " (e.g. Linker or Export) is not ready for evaluation.");
 
 //	evaluate constant data
+//	NOTE: linkers depending on constant data only are constant themselves and
+//		  thus evaluated here once for the whole element loop
 	for(size_t i = 0; i < m_vConstData.size(); ++i)
 		m_vConstData[i]->compute((LocalVector*)NULL, NULL, NULL, false);
+
+//	plan the evaluation of the dependent data
+	build_dependent_eval_plan();
+}
+
+template <typename TDomain>
+void DataEvaluator<TDomain>::build_dependent_eval_plan()
+{
+//	The dependent data is already sorted such that needed data is computed
+//	first. Data may evaluate some of its needed data within its own evaluation
+//	(fused, e.g. nested ScaleAddLinkers), reading the values of the inputs of
+//	the needed data instead of its values. Data, whose values are read neither
+//	by an import nor by other data, is thus not computed per element at all.
+	std::set<const ICplUserData<dim>*> sRead;
+	for(size_t d = 0; d < m_vElemDisc[PT_ALL].size(); ++d)
+	{
+		IElemDisc<TDomain>* disc = m_vElemDisc[PT_ALL][d];
+		for(size_t i = 0; i < disc->num_imports(); ++i)
+			if(disc->get_import(i).data_given())
+				sRead.insert(disc->get_import(i).data().get());
+	}
+
+	std::vector<SmartPtr<ICplUserData<dim> > >* vvData[3] =
+		{&m_vConstData, &m_vPosData, &m_vDependentData};
+	for(size_t l = 0; l < 3; ++l)
+		for(size_t d = 0; d < vvData[l]->size(); ++d)
+		{
+			ICplUserData<dim>& data = *(*vvData[l])[d];
+			for(size_t i = 0; i < data.num_needed_data(); ++i)
+				if(!data.fuses_needed_data(i))
+					sRead.insert(data.needed_data(i).get());
+		}
+
+//	For the remaining data, the smart pointers are resolved and the cases
+//	are detected, where the access map of the local vector does not change
+//	between two subsequent data (e.g. in chains of linkers), so that the per
+//	element loop only remaps the local vector when needed.
+	m_vDependentPlan.clear();
+	for(size_t i = 0; i < m_vDependentData.size(); ++i)
+	{
+		if(sRead.find(m_vDependentData[i].get()) == sRead.end()) continue;
+
+		DependentEvalStep step;
+		step.pData = m_vDependentData[i].get();
+		step.bRemap = true;
+
+		if(!m_vDependentPlan.empty())
+		{
+			const FunctionIndexMapping& map = step.pData->map();
+			const FunctionIndexMapping& prevMap = m_vDependentPlan.back().pData->map();
+			if(map.num_fct() == prevMap.num_fct())
+			{
+				step.bRemap = false;
+				for(size_t fct = 0; fct < map.num_fct(); ++fct)
+					if(map[fct] != prevMap[fct]) {step.bRemap = true; break;}
+			}
+		}
+
+		m_vDependentPlan.push_back(step);
+	}
 }
 
 template <typename TDomain>
@@ -176,15 +239,17 @@ prepare_elem(LocalVector& u, GridObject* elem, const ReferenceObjectID roid, con
 //	compute the data
 	try{
 		if (! time_series_needed ()) { // assemble for the given LocalVector
-			for(size_t i = 0; i < m_vDependentData.size(); ++i){
-				u.access_by_map(m_vDependentData[i]->map());
-				m_vDependentData[i]->compute(&u, elem, vCornerCoords, bDeriv);
+			for(size_t i = 0; i < m_vDependentPlan.size(); ++i){
+				const DependentEvalStep& step = m_vDependentPlan[i];
+				if(step.bRemap) u.access_by_map(step.pData->map());
+				step.pData->compute(&u, elem, vCornerCoords, bDeriv);
 			}
 		}
 		else { // assemble for LocalVectorTimeSeries
-			for(size_t i = 0; i < m_vDependentData.size(); ++i){
-				u.access_by_map(m_vDependentData[i]->map());
-				m_vDependentData[i]->compute(m_pLocTimeSeries, elem, vCornerCoords, bDeriv);
+			for(size_t i = 0; i < m_vDependentPlan.size(); ++i){
+				const DependentEvalStep& step = m_vDependentPlan[i];
+				if(step.bRemap) u.access_by_map(step.pData->map());
+				step.pData->compute(m_pLocTimeSeries, elem, vCornerCoords, bDeriv);
 			}
 		}
 	}
@@ -332,6 +397,66 @@ add_rhs_elem(LocalVector& rhs, GridObject* elem, const MathVector<dim> vCornerCo
 	UG_CATCH_THROW("DataEvaluatorBase::add_rhs_elem: Cannot assemble rhs");
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Batched assemble routines
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename TDomain>
+bool DataEvaluator<TDomain>::
+batch_assembling_possible(const ReferenceObjectID id, bool bDefect) const
+{
+	if(time_series_needed()) return false;
+	if(!m_vPosData.empty() || !m_vDependentData.empty()) return false;
+
+	for(int type = 0; type < MAX_PROCESS; ++type)
+		for(int part = 0; part < MAX_PART; ++part)
+			if(!m_vImport[type][part].empty()) return false;
+
+//	imports of data with zero derivative are not listed in m_vImport, but
+//	are evaluated per element as well
+	for(size_t i = 0; i < m_vElemDisc[PT_ALL].size(); ++i)
+		for(size_t imp = 0; imp < m_vElemDisc[PT_ALL][i]->num_imports(); ++imp)
+			if(m_vElemDisc[PT_ALL][i]->get_import(imp).data_given()) return false;
+
+	for(size_t i = 0; i < m_vElemDisc[PT_ALL].size(); ++i)
+	{
+		if(bDefect && m_vElemDisc[PT_ALL][i]->has_add_def_batch_fct(id)) return true;
+		if(!bDefect && m_vElemDisc[PT_ALL][i]->has_add_jac_A_batch_fct(id)) return true;
+	}
+	return false;
+}
+
+template <typename TDomain>
+void DataEvaluator<TDomain>::
+add_jac_A_batch(LocalElemBatch<dim>& batch)
+{
+	UG_ASSERT(m_discPart & STIFF, "Using add_jac_A_batch, but not STIFF requested.");
+	UG_ASSERT(batch_assembling_possible(batch.roid(), false),
+	          "Batched assembling not possible.");
+
+	try{
+		for(size_t i = 0; i < m_vElemDisc[PT_ALL].size(); ++i)
+			m_vElemDisc[PT_ALL][i]->do_add_jac_A_batch(batch);
+	}
+	UG_CATCH_THROW("DataEvaluatorBase::add_jac_A_batch: Cannot assemble Jacobian (A)");
+}
+
+template <typename TDomain>
+void DataEvaluator<TDomain>::
+add_def_batch(LocalElemBatch<dim>& batch)
+{
+	UG_ASSERT((m_discPart & STIFF) && (m_discPart & RHS),
+	          "Using add_def_batch, but not STIFF and RHS requested.");
+	UG_ASSERT(batch_assembling_possible(batch.roid(), true),
+	          "Batched assembling not possible.");
+
+	try{
+		for(size_t i = 0; i < m_vElemDisc[PT_ALL].size(); ++i)
+			m_vElemDisc[PT_ALL][i]->do_add_def_batch(batch);
+	}
+	UG_CATCH_THROW("DataEvaluatorBase::add_def_batch: Cannot assemble Defect");
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //	explicit template instantiations
 ////////////////////////////////////////////////////////////////////////////////
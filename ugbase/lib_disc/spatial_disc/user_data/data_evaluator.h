@@ -227,6 +227,26 @@ public:
 		///	compute local rhs for all IElemDiscs
 			void add_rhs_elem(LocalVector& rhs, GridObject* elem, const MathVector<dim> vCornerCoords[], ProcessType type = PT_ALL);
 
+	////////////////////////////////////////////
+	// Batched assembling
+	///////////////////////////////////////////
+
+		///	returns if the elements of a type should be assembled in batches
+		/**
+		 * Batches are used if at least one IElemDisc has a batched
+		 * implementation for the reference object id and no data has to be
+		 * evaluated per element by this class, i.e. if there are no imports,
+		 * no position dependent or dependent user data and no local time
+		 * series is needed.
+		 */
+			bool batch_assembling_possible(const ReferenceObjectID id, bool bDefect) const;
+
+		///	prepares the elements and computes local stiffness matrices of a batch for all IElemDiscs
+			void add_jac_A_batch(LocalElemBatch<dim>& batch);
+
+		///	prepares the elements and computes local stiffness defects and rhs of a batch for all IElemDiscs
+			void add_def_batch(LocalElemBatch<dim>& batch);
+
 			using base_type::time_series_needed;
 protected:
 
@@ -241,6 +261,18 @@ protected:
 	using base_type::clear_positions_in_user_data;
 	using base_type::extract_imports_and_userdata;
 
+	///	builds the evaluation plan for the dependent data
+		void build_dependent_eval_plan();
+
+	///	step of the evaluation plan for dependent data
+		struct DependentEvalStep
+		{
+			ICplUserData<dim>* pData;	//< data to compute
+			bool bRemap;				//< flag if access map differs from previous step
+		};
+
+	///	dependent data to compute per element, in evaluation order (built once per element loop)
+		std::vector<DependentEvalStep> m_vDependentPlan;
 };
 
 
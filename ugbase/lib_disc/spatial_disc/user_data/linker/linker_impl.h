@@ -130,7 +130,8 @@ void StdDataLinker<TImpl,TData,dim>::
 compute(LocalVector* u, GridObject* elem,
         const MathVector<dim> vCornerCoords[], bool bDeriv){
 
-	UG_ASSERT(elem->base_object_id() == this->dim_local_ips(),
+//	NOTE: constant linkers are evaluated without an element
+	UG_ASSERT(elem == NULL || elem->base_object_id() == this->dim_local_ips(),
 	          "local ip dimension and reference element dimension mismatch.");
 
 	switch(this->dim_local_ips()){
@@ -146,7 +147,8 @@ void StdDataLinker<TImpl,TData,dim>::
 compute(LocalVectorTimeSeries* u, GridObject* elem,
         const MathVector<dim> vCornerCoords[], bool bDeriv){
 
-	UG_ASSERT(elem->base_object_id() == this->dim_local_ips(),
+//	NOTE: constant linkers are evaluated without an element
+	UG_ASSERT(elem == NULL || elem->base_object_id() == this->dim_local_ips(),
 	          "local ip dimension and reference element dimension mismatch.");
 
 	switch(this->dim_local_ips()){
@@ -34,6 +34,7 @@
 #define __H__UG__LIB_DISC__SPATIAL_DISC__SCALE_ADD_LINKER__
 
 #include "linker.h"
+#include "linker_traits.h"
 
 namespace ug{
 
@@ -42,6 +43,34 @@ namespace ug{
 // Scaled adding of Data
 ////////////////////////////////////////////////////////////////////////////////
 
+/// traits for the fused evaluation of nested ScaleAddLinkers
+/**
+ * Nested linkers are only fused for scalar scalings of linkers returning
+ * their data type, since only then the scalings of the nested linkers
+ * multiply to a scalar. For all other types, fusable is false and the
+ * remaining members are not used.
+ */
+template <typename TData, typename TDataScale, typename TRet>
+struct scale_add_fusion_traits
+{
+	static const bool fusable = false;
+	static const number* factors(const TDataScale* vScale) {return NULL;}
+	static number factor(number f, const TDataScale& s) {return 0.0;}
+	static void mult_add(TRet& out, const TData& in1, number s) {}
+};
+
+template <typename TData>
+struct scale_add_fusion_traits<TData, number, TData>
+{
+	static const bool fusable = true;
+	static const number* factors(const number* vScale) {return vScale;}
+	static number factor(number f, number s) {return f * s;}
+	static void mult_add(TData& out, const TData& in1, number s)
+	{
+		linker_traits<TData, number>::mult_add(out, in1, s);
+	}
+};
+
 /**
  * This linker recombines the data like
  *
@@ -51,6 +80,13 @@ namespace ug{
  * scaling factor of a (possibly) different type, that is applicable to the
  * data type
  *
+ * If an input i_c is a ScaleAddLinker itself, depending on the solution, and
+ * its scaling s_c is a scalar not depending on the solution, the input is
+ * evaluated within this linker (fused), i.e. the summands of i_c are added
+ * with the scalings multiplied by s_c. The values and derivatives of i_c are
+ * then not read, and the DataEvaluator does not compute them, if no other
+ * data needs them.
+ *
  * \tparam		TData		exported and combined Data type
  * \tparam		dim			world dimension
  * \tparam		TDataScale 	type of scaling data
@@ -111,7 +147,48 @@ class ScaleAddLinker
 		                    std::vector<std::vector<TRet> > vvvDeriv[],
 		                    const MathMatrix<refDim, dim>* vJT = NULL) const;
 
+	///	returns if the linker is constant
+	/**
+	 * The linker is constant if all summands and all scaling factors are
+	 * constant. In this case the linker is evaluated only once per element
+	 * loop (together with the other constant data) instead of per element.
+	 */
+		virtual bool constant() const;
+
+	///	returns if the needed data is evaluated within this linker
+		virtual bool fuses_needed_data(size_t i) const
+		{
+			return (i % 2 == 0) && fused_input(i / 2) != NULL;
+		}
+
 	protected:
+	///	returns the input c, if it is a ScaleAddLinker evaluated within this linker
+		ScaleAddLinker* fused_input(size_t c) const;
+
+	///	adds the values of this linker for series s, scaled by the factors
+	/**	The values are computed from the inputs, not read from the storage.*/
+		void add_fused_values(TRet vValue[], const size_t nip, const size_t s,
+		                      const number* vFactor, bool bConstFactor) const;
+
+	///	adds the derivatives of this linker for series s, scaled by the factors
+	/**	The derivatives are computed from the inputs, not read from the
+	 * storage. The function fct of this linker is the function vFctMap[fct]
+	 * of vvvDeriv.*/
+		void add_fused_derivs(std::vector<std::vector<TRet> > vvvDeriv[],
+		                      const size_t nip, const size_t s,
+		                      const number* vFactor, bool bConstFactor,
+		                      const size_t* vFctMap) const;
+
+	///	multiplies the factors with the scaling c of series s into m_vFusedFactor
+		const number* fused_factors(const size_t nip, const size_t c, const size_t s,
+		                            const number* vFactor, bool bConstFactor) const;
+
+	///	recomputes the values, if the linker is constant
+		virtual void value_storage_changed(const size_t seriesID);
+
+	///	computes the values of a series from the values of the inputs
+		void eval_values(TRet vValue[], const size_t nip, const size_t s) const;
+
 	///	data at ip of input
 		const TData& input_value(size_t i, size_t s, size_t ip) const
 		{
@@ -168,6 +245,18 @@ class ScaleAddLinker
 
 	///	data input casted to dependend data
 		std::vector<SmartPtr<DependentUserData<TData, dim> > > m_vpDependData;
+
+	///	data input casted to ScaleAddLinker (NULL for other data)
+		std::vector<ScaleAddLinker*> m_vpLinkerData;
+
+	///	fusion traits
+		typedef scale_add_fusion_traits<TData, TDataScale, TRet> fusion_traits;
+
+	///	work arrays for the fused evaluation
+	/// \{
+		mutable std::vector<number> m_vFusedFactor;
+		mutable std::vector<size_t> m_vFusedFctMap;
+	/// \}
 };
 
 } // end namespace ug
@@ -69,11 +69,13 @@ add(SmartPtr<CplUserData<TDataScale, dim> > scale, SmartPtr<CplUserData<TData, d
 	m_vpDependData.resize(numInput+1);
 	m_vpScaleData.resize(numInput+1);
 	m_vpScaleDependData.resize(numInput+1);
+	m_vpLinkerData.resize(numInput+1);
 
 //	remember userdata
 	UG_ASSERT(data.valid(), "Null Pointer as Input set.");
 	m_vpUserData[numInput] = data;
 	m_vpDependData[numInput] = data.template cast_dynamic<DependentUserData<TData, dim> >();
+	m_vpLinkerData[numInput] = dynamic_cast<ScaleAddLinker*>(data.get());
 
 //	remember userdata
 	UG_ASSERT(scale.valid(), "Null Pointer as Scale set.");
@@ -166,6 +168,206 @@ evaluate(TRet vValue[],
 	}
 }
 
+template <typename TData, int dim, typename TDataScale, typename TRet>
+bool ScaleAddLinker<TData,dim,TDataScale,TRet>::constant() const
+{
+	for(size_t c = 0; c < m_vpUserData.size(); ++c)
+		if(!m_vpUserData[c]->constant() || !m_vpScaleData[c]->constant())
+			return false;
+	return true;
+}
+
+template <typename TData, int dim, typename TDataScale, typename TRet>
+void ScaleAddLinker<TData,dim,TDataScale,TRet>::
+value_storage_changed(const size_t seriesID)
+{
+//	constant linkers are not evaluated per element, thus the values must be
+//	kept up to date whenever the storage changes (as for StdConstData)
+	if(!constant()) return;
+
+	eval_values(this->values(seriesID), this->num_ip(seriesID), seriesID);
+}
+
+template <typename TData, int dim, typename TDataScale, typename TRet>
+void ScaleAddLinker<TData,dim,TDataScale,TRet>::
+eval_values(TRet vValue[], const size_t nip, const size_t s) const
+{
+	if(nip == 0) return;
+
+//	reset value
+	for(size_t ip = 0; ip < nip; ++ip)
+		vValue[ip] = 0.0;
+
+//	add contribution of each summand, looping the contiguous value arrays of
+//	the inputs. A constant scaling is the same at all ips and thus fetched once.
+	for(size_t c = 0; c < m_vpUserData.size(); ++c)
+	{
+		const TData* vData = m_vpUserData[c]->values(this->series_id(2*c,s));
+		const TDataScale* vScale = m_vpScaleData[c]->values(this->series_id(2*c+1,s));
+
+	//	nested linker: add its summands directly
+		if(const ScaleAddLinker* pLinker = fused_input(c))
+		{
+			pLinker->add_fused_values(vValue, nip, this->series_id(2*c,s),
+			                          fusion_traits::factors(vScale),
+			                          m_vpScaleData[c]->constant());
+			continue;
+		}
+
+		if(m_vpScaleData[c]->constant())
+		{
+			const TDataScale& scale = vScale[0];
+			for(size_t ip = 0; ip < nip; ++ip)
+				linker_traits<TData, TDataScale,TRet>::
+				mult_add(vValue[ip], vData[ip], scale);
+		}
+		else
+		{
+			for(size_t ip = 0; ip < nip; ++ip)
+				linker_traits<TData, TDataScale,TRet>::
+				mult_add(vValue[ip], vData[ip], vScale[ip]);
+		}
+	}
+}
+
+template <typename TData, int dim, typename TDataScale, typename TRet>
+ScaleAddLinker<TData,dim,TDataScale,TRet>*
+ScaleAddLinker<TData,dim,TDataScale,TRet>::fused_input(size_t c) const
+{
+	ScaleAddLinker* pLinker = m_vpLinkerData[c];
+	if(!fusion_traits::fusable || pLinker == NULL) return NULL;
+
+//	constant linkers are evaluated once per element loop and position
+//	dependent ones together with the other position dependent data
+	if(pLinker->constant() || pLinker->zero_derivative()) return NULL;
+
+//	the derivative of a solution dependent scaling needs the input values
+	if(!m_vpScaleData[c]->zero_derivative()) return NULL;
+
+	return pLinker;
+}
+
+template <typename TData, int dim, typename TDataScale, typename TRet>
+const number* ScaleAddLinker<TData,dim,TDataScale,TRet>::
+fused_factors(const size_t nip, const size_t c, const size_t s,
+              const number* vFactor, bool bConstFactor) const
+{
+	const TDataScale* vScale = m_vpScaleData[c]->values(this->series_id(2*c+1,s));
+	const bool bConstScale = m_vpScaleData[c]->constant();
+
+	m_vFusedFactor.resize((bConstFactor && bConstScale) ? 1 : nip);
+	for(size_t ip = 0; ip < m_vFusedFactor.size(); ++ip)
+		m_vFusedFactor[ip] = fusion_traits::factor(vFactor[bConstFactor ? 0 : ip],
+		                                           vScale[bConstScale ? 0 : ip]);
+	return &m_vFusedFactor[0];
+}
+
+template <typename TData, int dim, typename TDataScale, typename TRet>
+void ScaleAddLinker<TData,dim,TDataScale,TRet>::
+add_fused_values(TRet vValue[], const size_t nip, const size_t s,
+                 const number* vFactor, bool bConstFactor) const
+{
+	if(nip == 0) return;
+
+	for(size_t c = 0; c < m_vpUserData.size(); ++c)
+	{
+		const bool bConst = bConstFactor && m_vpScaleData[c]->constant();
+		const number* vCombFactor = fused_factors(nip, c, s, vFactor, bConstFactor);
+
+		if(const ScaleAddLinker* pLinker = fused_input(c))
+		{
+			pLinker->add_fused_values(vValue, nip, this->series_id(2*c,s),
+			                          vCombFactor, bConst);
+			continue;
+		}
+
+		const TData* vData = m_vpUserData[c]->values(this->series_id(2*c,s));
+		for(size_t ip = 0; ip < nip; ++ip)
+			fusion_traits::mult_add(vValue[ip], vData[ip], vCombFactor[bConst ? 0 : ip]);
+	}
+}
+
+template <typename TData, int dim, typename TDataScale, typename TRet>
+void ScaleAddLinker<TData,dim,TDataScale,TRet>::
+add_fused_derivs(std::vector<std::vector<TRet> > vvvDeriv[],
+                 const size_t nip, const size_t s,
+                 const number* vFactor, bool bConstFactor,
+                 const size_t* vFctMap) const
+{
+	for(size_t c = 0; c < m_vpUserData.size(); ++c)
+	{
+	//	nested linker: map its functions to the functions of vvvDeriv
+		if(const ScaleAddLinker* pLinker = fused_input(c))
+		{
+			const bool bConst = bConstFactor && m_vpScaleData[c]->constant();
+			const number* vCombFactor = fused_factors(nip, c, s, vFactor, bConstFactor);
+
+			m_vFusedFctMap.resize(input_num_fct(c));
+			for(size_t fct = 0; fct < m_vFusedFctMap.size(); ++fct)
+				m_vFusedFctMap[fct] = vFctMap[input_common_fct(c, fct)];
+
+			pLinker->add_fused_derivs(vvvDeriv, nip, this->series_id(2*c,s),
+			                          vCombFactor, bConst,
+			                          m_vFusedFctMap.empty() ? NULL : &m_vFusedFctMap[0]);
+			continue;
+		}
+
+		const TDataScale* vScale = m_vpScaleData[c]->values(this->series_id(2*c+1,s));
+
+	//	check if input has derivative
+		if(!m_vpUserData[c]->zero_derivative())
+		{
+			const DependentUserData<TData, dim>& rInput = *m_vpDependData[c];
+			const size_t inSeries = this->series_id(2*c,s);
+
+			for(size_t ip = 0; ip < nip; ++ip)
+			{
+				const number scale = fusion_traits::factor(vFactor[bConstFactor ? 0 : ip], vScale[ip]);
+
+				for(size_t fct = 0; fct < input_num_fct(c); ++fct)
+				{
+					const size_t commonFct = input_common_fct(c, fct);
+					const size_t numSh = this->num_sh(commonFct);
+					if(numSh == 0) continue;
+
+					const TData* vDeriv = rInput.deriv(inSeries, ip, fct);
+					TRet* vRes = &vvvDeriv[ip][vFctMap[commonFct]][0];
+
+					for(size_t sh = 0; sh < numSh; ++sh)
+						fusion_traits::mult_add(vRes[sh], vDeriv[sh], scale);
+				}
+			}
+		}
+
+	//	check if scaling has derivative
+		if(!m_vpScaleData[c]->zero_derivative())
+		{
+			const TData* vData = m_vpUserData[c]->values(this->series_id(2*c,s));
+			const DependentUserData<TDataScale, dim>& rScale = *m_vpScaleDependData[c];
+			const size_t scaleSeries = this->series_id(2*c+1,s);
+
+			for(size_t ip = 0; ip < nip; ++ip)
+			{
+				const number factor = vFactor[bConstFactor ? 0 : ip];
+
+				for(size_t fct = 0; fct < scale_num_fct(c); ++fct)
+				{
+					const size_t commonFct = scale_common_fct(c, fct);
+					const size_t numSh = this->num_sh(commonFct);
+					if(numSh == 0) continue;
+
+					const TDataScale* vDeriv = rScale.deriv(scaleSeries, ip, fct);
+					TRet* vRes = &vvvDeriv[ip][vFctMap[commonFct]][0];
+
+					for(size_t sh = 0; sh < numSh; ++sh)
+						fusion_traits::mult_add(vRes[sh], vData[ip],
+						                        fusion_traits::factor(factor, vDeriv[sh]));
+				}
+			}
+		}
+	}
+}
+
 template <typename TData, int dim, typename TDataScale, typename TRet>
 template <int refDim>
 void ScaleAddLinker<TData,dim,TDataScale,TRet>::
@@ -186,20 +388,7 @@ eval_and_deriv(TRet vValue[],
 	UG_ASSERT(m_vpUserData.size() == m_vpScaleData.size(), "Wrong num Scales.");
 
 //	compute value
-	for(size_t ip = 0; ip < nip; ++ip)
-	{
-	//	reset value
-		vValue[ip] = 0.0;
-
-	//	add contribution of each summand
-		for(size_t c = 0; c < m_vpUserData.size(); ++c)
-		{
-			linker_traits<TData, TDataScale,TRet>::
-			mult_add(vValue[ip],
-					 input_value(c, s, ip),
-					 scale_value(c, s, ip));
-		}
-	}
+	eval_values(vValue, nip, s);
 
 //	check if derivative is required
 	if(!bDeriv || this->zero_derivative()) return;
@@ -214,25 +403,50 @@ eval_and_deriv(TRet vValue[],
 //	loop all inputs
 	for(size_t c = 0; c < m_vpUserData.size(); ++c)
 	{
+		const TData* vData = m_vpUserData[c]->values(this->series_id(2*c,s));
+		const TDataScale* vScale = m_vpScaleData[c]->values(this->series_id(2*c+1,s));
+
+	//	nested linker: add the derivatives of its summands directly. The
+	//	scaling of a fused input does not depend on the solution.
+		if(const ScaleAddLinker* pLinker = fused_input(c))
+		{
+			m_vFusedFctMap.resize(input_num_fct(c));
+			for(size_t fct = 0; fct < m_vFusedFctMap.size(); ++fct)
+				m_vFusedFctMap[fct] = input_common_fct(c, fct);
+
+			pLinker->add_fused_derivs(vvvDeriv, nip, this->series_id(2*c,s),
+			                          fusion_traits::factors(vScale),
+			                          m_vpScaleData[c]->constant(),
+			                          m_vFusedFctMap.empty() ? NULL : &m_vFusedFctMap[0]);
+			continue;
+		}
+
 	//	check if input has derivative
 		if(!m_vpUserData[c]->zero_derivative())
 		{
+			const DependentUserData<TData, dim>& rInput = *m_vpDependData[c];
+			const size_t inSeries = this->series_id(2*c,s);
+
 			for(size_t ip = 0; ip < nip; ++ip)
 			{
+			//	scaling is the same for all functions and dofs at the ip
+				const TDataScale& scale = vScale[ip];
+
 			//	loop functions
 				for(size_t fct = 0; fct < input_num_fct(c); ++fct)
 				{
 				//	get common fct id for this function
 					const size_t commonFct = input_common_fct(c, fct);
+					const size_t numSh = this->num_sh(commonFct);
+					if(numSh == 0) continue;
+
+					const TData* vDeriv = rInput.deriv(inSeries, ip, fct);
+					TRet* vRes = &vvvDeriv[ip][commonFct][0];
 
 				//	loop dofs
-					for(size_t sh = 0; sh < this->num_sh(fct); ++sh)
-					{
+					for(size_t sh = 0; sh < numSh; ++sh)
 						linker_traits<TData, TDataScale,TRet>::
-						mult_add(vvvDeriv[ip][commonFct][sh],
-								 input_deriv(c, s, ip, fct, sh),
-								 scale_value(c, s, ip));
-					}
+						mult_add(vRes[sh], vDeriv[sh], scale);
 				}
 			}
 		}
@@ -240,22 +454,29 @@ eval_and_deriv(TRet vValue[],
 	//	check if scaling has derivative
 		if(!m_vpScaleData[c]->zero_derivative())
 		{
+			const DependentUserData<TDataScale, dim>& rScale = *m_vpScaleDependData[c];
+			const size_t scaleSeries = this->series_id(2*c+1,s);
+
 			for(size_t ip = 0; ip < nip; ++ip)
 			{
+			//	input value is the same for all functions and dofs at the ip
+				const TData& data = vData[ip];
+
 			//	loop functions
 				for(size_t fct = 0; fct < scale_num_fct(c); ++fct)
 				{
 				//	get common fct id for this function
 					const size_t commonFct = scale_common_fct(c, fct);
+					const size_t numSh = this->num_sh(commonFct);
+					if(numSh == 0) continue;
+
+					const TDataScale* vDeriv = rScale.deriv(scaleSeries, ip, fct);
+					TRet* vRes = &vvvDeriv[ip][commonFct][0];
 
 				//	loop dofs
-					for(size_t sh = 0; sh < this->num_sh(fct); ++sh)
-					{
+					for(size_t sh = 0; sh < numSh; ++sh)
 						linker_traits<TData, TDataScale,TRet>::
-						mult_add(vvvDeriv[ip][commonFct][sh],
-								 input_value(c, s, ip),
-								 scale_deriv(c, s, ip, fct, sh));
-					}
+						mult_add(vRes[sh], data, vDeriv[sh]);
 				}
 			}
 		}
@@ -48,6 +48,12 @@ namespace ug{
  *
  * inline TRet evaluate(TData& D, const MathVector<dim>& x, number time, int si) const
  *
+ * In order to evaluate all integration points at once (e.g. to vectorize over
+ * the points), the deriving class may in addition implement the method:
+ *
+ * inline void evaluate_at_ips(TData vValue[], const MathVector<dim> vGlobIP[],
+ *                             number time, int si, const size_t nip) const
+ *
  */
 template <typename TImpl, typename TData, int dim, typename TRet = void>
 class StdGlobPosData
@@ -64,6 +70,14 @@ class StdGlobPosData
 		virtual void operator()(TData vValue[],
 								const MathVector<dim> vGlobIP[],
 								number time, int si, const size_t nip) const
+		{
+			this->getImpl().evaluate_at_ips(vValue, vGlobIP, time, si, nip);
+		}
+
+	///	evaluates the data at all points (default: point by point)
+		inline void evaluate_at_ips(TData vValue[],
+		                            const MathVector<dim> vGlobIP[],
+		                            number time, int si, const size_t nip) const
 		{
 			for(size_t ip = 0; ip < nip; ++ip)
 				this->getImpl().evaluate(vValue[ip], vGlobIP[ip], time, si);
@@ -80,8 +94,7 @@ class StdGlobPosData
 		                     LocalVector* u,
 		                     const MathMatrix<refDim, dim>* vJT = NULL) const
 		{
-			for(size_t ip = 0; ip < nip; ++ip)
-				this->getImpl().evaluate(vValue[ip],vGlobIP[ip],time,si);
+			this->getImpl().evaluate_at_ips(vValue, vGlobIP, time, si, nip);
 		}
 
 	///	implement as a UserData
@@ -92,8 +105,7 @@ class StdGlobPosData
 			const int si = this->subset();
 
 			for(size_t s = 0; s < this->num_series(); ++s)
-				for(size_t ip = 0; ip < this->num_ip(s); ++ip)
-					this->getImpl().evaluate(this->value(s,ip), this->ip(s, ip), t, si);
+				this->getImpl().evaluate_at_ips(this->values(s), this->ips(s), t, si, this->num_ip(s));
 		}
 
 	///	implement as a UserData
@@ -103,8 +115,7 @@ class StdGlobPosData
 			const int si = this->subset();
 
 			for(size_t s = 0; s < this->num_series(); ++s)
-				for(size_t ip = 0; ip < this->num_ip(s); ++ip)
-					this->getImpl().evaluate(this->value(s,ip), this->ip(s, ip), this->time(s), si);
+				this->getImpl().evaluate_at_ips(this->values(s), this->ips(s), this->time(s), si, this->num_ip(s));
 		}
 
 	///	returns if data is constant
@@ -268,6 +268,15 @@ class ICplUserData : virtual public UserDataInfo
 	///	return needed data
 		virtual SmartPtr<ICplUserData> needed_data(size_t i) {return SPNULL;}
 
+	///	returns if the needed data is evaluated within the evaluation of this data
+	/**
+	 * If true, this data does not read the values of the needed data i, but
+	 * computes its contribution from the inputs of the needed data (fused
+	 * evaluation). If no other data or import reads its values, the needed
+	 * data is then not computed by the DataEvaluator.
+	 */
+		virtual bool fuses_needed_data(size_t i) const {return false;}
+
 	/// compute values (and derivatives iff compDeriv == true)
 		virtual void compute(LocalVector* u,
 		                     GridObject* elem,
@@ -521,6 +530,16 @@ class CplUserData : public ICplUserData<dim>, public UserData<TData,dim,TRet>
 	///	register all callbacks registered by class
 		void unregister_storage_callback(DataImport<TData,dim>* obj);
 
+	///	returns an independent instance of this data for another thread
+	/**
+	 * The data stores the values at the integration points of the currently
+	 * assembled element, thus a threaded assembling needs one instance per
+	 * thread (cf. IElemDisc::clone_for_thread). A data supporting this returns
+	 * a new instance with the same settings, that can be evaluated
+	 * concurrently to this one. The default returns SPNULL.
+	 */
+		virtual SmartPtr<CplUserData<TData, dim, TRet> > clone_for_thread() const {return SPNULL;}
+
 	protected:
 	///	checks in debug mode the correct index
 		inline void check_series(size_t s) const;
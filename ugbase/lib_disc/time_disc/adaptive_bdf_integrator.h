@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+
+#ifndef __H__UG__LIB_DISC__TIME_DISC__ADAPTIVE_BDF_INTEGRATOR__
+#define __H__UG__LIB_DISC__TIME_DISC__ADAPTIVE_BDF_INTEGRATOR__
+
+// extern libraries
+#include <string>
+
+// other ug libraries
+#include "common/common.h"
+#include "lib_algebra/operator/interface/operator_inverse.h"
+
+// module-intern libraries
+#include "lib_disc/function_spaces/grid_function.h"
+#include "lib_disc/time_disc/theta_time_step.h"
+#include "lib_disc/time_disc/time_integrator_subject.hpp"
+#include "lib_disc/operator/non_linear_operator/newton_solver/newton.h"
+
+namespace ug{
+
+/// \ingroup lib_disc_time_assemble
+/// @{
+
+/// time integrator with error controlled step size for variable step BDF schemes
+/**
+ * This class integrates from t0 to tEnd using a BDF scheme and chooses the
+ * step sizes such that an estimate of the local error stays below the given
+ * tolerances.
+ *
+ * The local error is estimated by the difference between the BDF(k) solution
+ * and the polynomial extrapolation of the previous k+1 solutions (predictor of
+ * order k, "Milne's device"). For equidistant steps, the error constants of
+ * predictor and corrector give
+ *
+ * 		err ~ || u - u_pred || / (k+2),
+ *
+ * that is used for smoothly varying step sizes as well. The norm is the root
+ * mean square over all unknowns, each weighted by absTol + relTol * |u_i|,
+ * such that the step is accepted if err <= 1. The estimate comes
+ * without any additional solve; the predictor is also used as start iterate
+ * of the nonlinear solver. The order is ramped up from BDF(1) to the maximal
+ * order as previous solutions become available. The very first step has no
+ * history for the estimate and is always accepted, thus the start step size
+ * should be chosen small enough.
+ *
+ * The new step size is chosen by a PI controller
+ *
+ * 		dt_new = dt * safety * (1/err)^(kI/(k+1)) * (err_prev/err)^(kP/(k+1)),
+ *
+ * a rejected step is repeated with dt * safety * (1/err)^(1/(k+1)). If the
+ * nonlinear solver fails, the step is repeated with a reduced step size.
+ *
+ * If a NewtonSolver is used and the step size (and order) changed by less than
+ * a given tolerance since the Jacobian has actually been assembled last, the Jacobian and
+ * the preconditioner are reused in the first newton step. If newton fails
+ * with the reused Jacobian, the step is repeated with a new Jacobian before the
+ * step size is reduced.
+ *
+ * Observers are notified by the stages of the TimeIntegratorSubject. Rejected
+ * steps are reported through the rewind stage.
+ *
+ * \tparam	TDomain		Domain type
+ * \tparam	TAlgebra	Algebra type
+ */
+template <typename TDomain, typename TAlgebra>
+class AdaptiveBDFIntegrator
+	: public TimeIntegratorSubject<TDomain, TAlgebra>
+{
+	public:
+	/// Type of algebra
+		typedef TAlgebra algebra_type;
+
+	/// Type of algebra vector
+		typedef typename algebra_type::vector_type vector_type;
+
+	///	Type of grid function
+		typedef GridFunction<TDomain, TAlgebra> grid_function_type;
+
+	///	Type of time discretization
+		typedef BDF<TAlgebra> time_disc_type;
+
+	public:
+	///	constructor
+		AdaptiveBDFIntegrator(SmartPtr<time_disc_type> spTimeDisc,
+		                      SmartPtr<IOperatorInverse<vector_type> > spSolver);
+
+	///	sets the maximal order of the BDF scheme
+		void set_max_order(size_t order) {m_maxOrder = order;}
+
+	///	sets the relative and absolute tolerance for the local error
+		void set_tolerance(number relTol, number absTol) {m_relTol = relTol; m_absTol = absTol;}
+
+	///	sets the step size of the first step
+		void set_dt_start(number dt) {m_dtStart = dt;}
+
+	///	sets the minimal step size (integration fails below)
+		void set_dt_min(number dt) {m_dtMin = dt;}
+
+	///	sets the maximal step size
+		void set_dt_max(number dt) {m_dtMax = dt;}
+
+	///	sets the safety factor for the step size prediction
+		void set_safety(number safety) {m_safety = safety;}
+
+	///	sets the bounds for the step size change per step
+		void set_step_factors(number minFac, number maxFac) {m_minFac = minFac; m_maxFac = maxFac;}
+
+	///	sets the step size reduction if the nonlinear solver fails
+		void set_failure_factor(number fac) {m_failFac = fac;}
+
+	///	sets the parameters of the PI controller (kP = 0 gives the I controller)
+		void set_pi_parameters(number kI, number kP) {m_kI = kI; m_kP = kP;}
+
+	///	sets the relative change of the step size, for that the Jacobian is reused (0 == never)
+		void set_jacobian_reuse_tolerance(number tol) {m_reuseTol = tol;}
+
+	///	integrates from t0 to tEnd, u is the start value on entry and the solution at tEnd on exit
+		bool apply(SmartPtr<grid_function_type> u, number t0, number tEnd);
+
+	///	statistics of the last call of apply
+	/// \{
+		int num_accepted_steps() const {return m_numAccepted;}
+		int num_rejected_steps() const {return m_numRejected;}
+		int num_failed_steps() const {return m_numFailed;}
+		int num_jacobian_reuses() const {return m_numReuse;}
+		void print_statistics() const;
+	/// \}
+
+	///	returns the step size proposed for the step following the last one
+		number last_dt() const {return m_dtLast;}
+
+	///	returns information about configuration parameters
+		std::string config_string() const;
+
+	protected:
+	///	computes the polynomial extrapolation of the order+1 latest solutions
+		void extrapolate(vector_type& pred, number time, size_t order);
+
+	///	tries to solve a time step, returns true if solver converged
+		bool solve_step(SmartPtr<grid_function_type> spU, SmartPtr<vector_type> spPred,
+		                number dt, size_t order, int step);
+
+	protected:
+	///	time discretization
+		SmartPtr<time_disc_type> m_spTimeDisc;
+
+	///	nonlinear solver
+		SmartPtr<IOperatorInverse<vector_type> > m_spSolver;
+
+	///	newton solver (if used) for the reuse of the Jacobian
+		SmartPtr<NewtonSolver<TAlgebra> > m_spNewton;
+
+	///	previous solutions
+		SmartPtr<VectorTimeSeries<vector_type> > m_spSolTimeSeries;
+
+	///	maximal order
+		size_t m_maxOrder;
+
+	///	tolerances
+		number m_relTol, m_absTol;
+
+	///	step sizes
+		number m_dtStart, m_dtMin, m_dtMax, m_dtLast;
+
+	///	step size control parameters
+		number m_safety, m_minFac, m_maxFac, m_failFac, m_kI, m_kP;
+
+	///	reuse of Jacobian
+	/// \{
+		number m_reuseTol;
+		bool m_bJacobianValid;
+		number m_dtJacobian;
+		size_t m_orderJacobian;
+	/// \}
+
+	///	statistics
+		int m_numAccepted, m_numRejected, m_numFailed, m_numReuse;
+};
+
+/// @}
+
+} // end namespace ug
+
+// include implementation
+#include "adaptive_bdf_integrator_impl.h"
+
+#endif /* __H__UG__LIB_DISC__TIME_DISC__ADAPTIVE_BDF_INTEGRATOR__ */
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+
+#ifndef __H__UG__LIB_DISC__TIME_DISC__ADAPTIVE_BDF_INTEGRATOR_IMPL__
+#define __H__UG__LIB_DISC__TIME_DISC__ADAPTIVE_BDF_INTEGRATOR_IMPL__
+
+#include <cmath>
+#include <algorithm>
+#include <sstream>
+
+#include "adaptive_bdf_integrator.h"
+#include "lib_disc/operator/non_linear_operator/assembled_non_linear_operator.h"
+
+namespace ug{
+
+template <typename TDomain, typename TAlgebra>
+AdaptiveBDFIntegrator<TDomain, TAlgebra>::
+AdaptiveBDFIntegrator(SmartPtr<time_disc_type> spTimeDisc,
+                      SmartPtr<IOperatorInverse<vector_type> > spSolver)
+	: m_spTimeDisc(spTimeDisc), m_spSolver(spSolver),
+	  m_spSolTimeSeries(new VectorTimeSeries<vector_type>()),
+	  m_maxOrder(2), m_relTol(1e-3), m_absTol(1e-6),
+	  m_dtStart(1e-3), m_dtMin(1e-10), m_dtMax(1e10), m_dtLast(0.0),
+	  m_safety(0.9), m_minFac(0.2), m_maxFac(5.0), m_failFac(0.5),
+	  m_kI(0.3), m_kP(0.4),
+	  m_reuseTol(0.2), m_bJacobianValid(false), m_dtJacobian(0.0), m_orderJacobian(0),
+	  m_numAccepted(0), m_numRejected(0), m_numFailed(0), m_numReuse(0)
+{
+	if(m_spTimeDisc.invalid())
+		UG_THROW("AdaptiveBDFIntegrator: Time discretization not set.");
+	if(m_spSolver.invalid())
+		UG_THROW("AdaptiveBDFIntegrator: Nonlinear solver not set.");
+
+//	the Jacobian can only be reused for the newton solver
+	m_spNewton = m_spSolver.template cast_dynamic<NewtonSolver<TAlgebra> >();
+}
+
+template <typename TDomain, typename TAlgebra>
+void AdaptiveBDFIntegrator<TDomain, TAlgebra>::
+extrapolate(vector_type& pred, number time, size_t order)
+{
+	const VectorTimeSeries<vector_type>& ts = *m_spSolTimeSeries;
+	const size_t n = order + 1;
+	UG_ASSERT(ts.size() >= n, "Not enough previous solutions for extrapolation.");
+
+//	lagrange polynomial through the n latest solutions evaluated at time
+	for(size_t j = 0; j < n; ++j)
+	{
+		number w = 1.0;
+		for(size_t i = 0; i < n; ++i)
+		{
+			if(i == j) continue;
+			w *= (time - ts.time(i)) / (ts.time(j) - ts.time(i));
+		}
+
+		if(j == 0) VecScaleAssign(pred, w, *ts.solution(j));
+		else VecScaleAdd(pred, 1.0, pred, w, *ts.solution(j));
+	}
+}
+
+template <typename TDomain, typename TAlgebra>
+bool AdaptiveBDFIntegrator<TDomain, TAlgebra>::
+solve_step(SmartPtr<grid_function_type> spU, SmartPtr<vector_type> spPred,
+           number dt, size_t order, int step)
+{
+	PROFILE_FUNC_GROUP("discretization");
+	const number t = m_spSolTimeSeries->latest_time();
+
+//	prepare time step
+	m_spTimeDisc->set_order(order);
+	try{
+		m_spTimeDisc->prepare_step_elem(m_spSolTimeSeries, dt, spU->grid_level());
+	}
+	UG_CATCH_THROW("AdaptiveBDFIntegrator: Cannot prepare time step.");
+
+//	reuse the Jacobian if the step size changed only slightly
+	bool bReuse = false;
+	if(m_spNewton.valid())
+	{
+		bReuse = m_reuseTol > 0.0 && m_bJacobianValid && order == m_orderJacobian
+				&& std::fabs(dt / m_dtJacobian - 1.0) <= m_reuseTol;
+	}
+
+	bool bSuccess = false;
+	for(int attempt = 0; attempt < 2 && !bSuccess; ++attempt)
+	{
+	//	a failed attempt with reused Jacobian is repeated with a new one
+		if(attempt > 0){
+			if(!bReuse) break;
+			UG_LOG("AdaptiveBDFIntegrator: Repeating step with new Jacobian.\n");
+			bReuse = false;
+		}
+		if(m_spNewton.valid())
+			m_spNewton->set_reuse_jacobian(bReuse);
+
+	//	start iterate is the predictor
+		spU->assign(*spPred);
+
+		this->notify_preprocess_step(spU, step, t, dt);
+		try{
+			bSuccess = m_spSolver->prepare(*spU) && m_spSolver->apply(*spU);
+		}
+		catch(UGError& err){
+			UG_LOG("AdaptiveBDFIntegrator: Nonlinear solver failed: " << err.get_msg() << "\n");
+			bSuccess = false;
+		}
+		this->notify_postprocess_step(spU, step, t + dt, dt);
+	}
+
+	if(!bSuccess){
+		m_bJacobianValid = false;
+		return false;
+	}
+
+	if(m_spNewton.valid())
+	{
+		if(bReuse) m_numReuse++;
+
+	//	remember for which step size the Jacobian has been assembled last. If
+	//	newton did not assemble in this step (reused Jacobian or start iterate
+	//	already converged), the Jacobian still belongs to an earlier step size.
+		if(m_spNewton->last_num_jacobian_assemblies() > 0){
+			m_bJacobianValid = true;
+			m_dtJacobian = dt;
+			m_orderJacobian = order;
+		}
+	}
+
+	return bSuccess;
+}
+
+template <typename TDomain, typename TAlgebra>
+bool AdaptiveBDFIntegrator<TDomain, TAlgebra>::
+apply(SmartPtr<grid_function_type> u, number t0, number tEnd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+	if(tEnd <= t0)
+		UG_THROW("AdaptiveBDFIntegrator: End time "<<tEnd<<" must be greater than start time "<<t0<<".");
+	if(m_maxOrder < 1 || m_maxOrder > 6)
+		UG_THROW("AdaptiveBDFIntegrator: Order must be in 1,...,6, but is "<<m_maxOrder<<".");
+
+	m_numAccepted = m_numRejected = m_numFailed = m_numReuse = 0;
+
+//	init solver
+	const GridLevel& gl = u->grid_level();
+	SmartPtr<AssembledOperator<TAlgebra> > spOp =
+			make_sp(new AssembledOperator<TAlgebra>(m_spTimeDisc, gl));
+	if(!m_spSolver->init(spOp))
+		UG_THROW("AdaptiveBDFIntegrator: Cannot init nonlinear solver.");
+	m_bJacobianValid = false;
+	if(m_spNewton.valid()) m_spNewton->invalidate_jacobian();
+
+//	start value
+	m_spSolTimeSeries->clear();
+	m_spSolTimeSeries->push(u->clone(), t0);
+
+//	work vectors
+	SmartPtr<grid_function_type> spU = u->clone();
+	SmartPtr<vector_type> spPred = u->clone();
+	SmartPtr<vector_type> spDiff = u->clone_without_values();
+
+//	number of unknowns for the root mean square of the error
+	spDiff->set(1.0);
+	const number sqrtNumDoF = spDiff->norm();
+
+	this->notify_start(u, 0, t0, m_dtStart);
+
+	number t = t0, dt = std::min(m_dtStart, m_dtMax), errPrev = 1.0;
+	bool bLastRejected = false;
+	int step = 1;
+	while(tEnd - t > 1e-12 * (tEnd - t0))
+	{
+	//	hit the end time, avoiding a tiny last step
+		number dtStep = dt;
+		const bool bLastStep = (t + 1.1 * dtStep >= tEnd);
+		if(bLastStep) dtStep = tEnd - t;
+
+	//	order is ramped up with the number of previous solutions, the estimate
+	//	needs one previous solution more than the BDF scheme
+		const size_t numPrev = m_spSolTimeSeries->size();
+		const size_t order = std::max((size_t)1, std::min(m_maxOrder, numPrev - 1));
+		const bool bEstimate = (numPrev > order);
+
+		UG_LOG("+++ Time step " << step << " (t = " << t << ", dt = " << dtStep
+		       << ", BDF(" << order << "))\n");
+
+		SmartPtr<grid_function_type> spLatest =
+			m_spSolTimeSeries->latest().template cast_dynamic<grid_function_type>();
+		this->notify_init_step(spLatest, step, t, dtStep);
+
+	//	predictor (or last solution, if no estimate possible)
+		extrapolate(*spPred, t + dtStep, bEstimate ? order : 0);
+
+	//	solve, reduce step size on failure
+		if(!solve_step(spU, spPred, dtStep, order, step))
+		{
+			m_numFailed++;
+			this->notify_rewind_step(spU, step, t + dtStep, dtStep);
+
+			dt = m_failFac * dtStep;
+			bLastRejected = true;
+			UG_LOG("+++ Time step " << step << " rejected (solver failed), new dt = " << dt << "\n");
+			if(dt < m_dtMin)
+				UG_THROW("AdaptiveBDFIntegrator: Step size "<<dt<<" below minimum "<<m_dtMin<<" at t = "<<t<<".");
+			continue;
+		}
+
+	//	estimate local error (root mean square weighted per unknown)
+		number err = 0.0;
+		if(bEstimate)
+		{
+			const vector_type& uNew = *spU;
+			vector_type& diff = *spDiff;
+			VecScaleAdd(diff, 1.0, uNew, -1.0, *spPred);
+			for(size_t i = 0; i < diff.size(); ++i)
+				for(size_t j = 0; j < GetSize(diff[i]); ++j)
+					BlockRef(diff[i], j) /= m_absTol + m_relTol * std::fabs(BlockRef(uNew[i], j));
+			err = diff.norm() / ((order + 2) * sqrtNumDoF);
+		}
+
+		const number q = order + 1;
+		if(err > 1.0 || !std::isfinite(err))
+		{
+			m_numRejected++;
+			this->notify_rewind_step(spU, step, t + dtStep, dtStep);
+
+			const number fac = std::isfinite(err) ? m_safety * std::pow(1.0/err, 1.0/q) : m_minFac;
+			dt = dtStep * std::max(m_minFac, fac);
+			bLastRejected = true;
+			UG_LOG("+++ Time step " << step << " rejected (error estimate " << err
+			       << "), new dt = " << dt << "\n");
+			if(dt < m_dtMin)
+				UG_THROW("AdaptiveBDFIntegrator: Step size "<<dt<<" below minimum "<<m_dtMin<<" at t = "<<t<<".");
+			continue;
+		}
+
+	//	accept step
+		t = bLastStep ? tEnd : t + dtStep;
+		m_numAccepted++;
+
+		SmartPtr<grid_function_type> spNew = spU;
+		if(m_spSolTimeSeries->size() > m_maxOrder)
+			spU = m_spSolTimeSeries->push_discard_oldest(spNew, t).template cast_dynamic<grid_function_type>();
+		else{
+			m_spSolTimeSeries->push(spNew, t);
+			spU = u->clone_without_values();
+		}
+
+		try{
+			m_spTimeDisc->finish_step_elem(m_spSolTimeSeries, gl);
+		}
+		UG_CATCH_THROW("AdaptiveBDFIntegrator: Cannot finish time step.");
+		this->notify_finalize_step(spNew, step, t, dtStep);
+
+	//	PI controller for next step size
+		number fac = 1.0;
+		if(bEstimate)
+		{
+			if(err > 0.0)
+				fac = m_safety * std::pow(1.0/err, m_kI/q) * std::pow(errPrev/err, m_kP/q);
+			else
+				fac = m_maxFac;
+			errPrev = std::max(err, 1e-4);
+		}
+		fac = std::min(m_maxFac, std::max(m_minFac, fac));
+		if(bLastRejected) fac = std::min(fac, 1.0);
+		dt = std::min(m_dtMax, fac * dtStep);
+
+		bLastRejected = false;
+		step++;
+	}
+
+//	write solution at end time
+	*u = *m_spSolTimeSeries->latest().template cast_dynamic<grid_function_type>();
+	m_dtLast = dt;
+
+	this->notify_end(u, step, t, dt);
+	print_statistics();
+	return true;
+}
+
+template <typename TDomain, typename TAlgebra>
+void AdaptiveBDFIntegrator<TDomain, TAlgebra>::
+print_statistics() const
+{
+	UG_LOG("AdaptiveBDFIntegrator: " << m_numAccepted << " accepted steps, "
+	       << m_numRejected << " rejected by error estimate, "
+	       << m_numFailed << " rejected by solver failure, "
+	       << m_numReuse << " steps with reused Jacobian.\n");
+}
+
+template <typename TDomain, typename TAlgebra>
+std::string AdaptiveBDFIntegrator<TDomain, TAlgebra>::
+config_string() const
+{
+	std::stringstream ss;
+	ss << "AdaptiveBDFIntegrator (max. order = " << m_maxOrder
+	   << ", relTol = " << m_relTol << ", absTol = " << m_absTol << ")\n";
+	ss << " Step size: start = " << m_dtStart << ", min = " << m_dtMin
+	   << ", max = " << m_dtMax << "\n";
+	ss << " PI controller: kI = " << m_kI << ", kP = " << m_kP
+	   << ", safety = " << m_safety << ", factors = [" << m_minFac << ", " << m_maxFac << "]\n";
+	ss << " Jacobian reuse tolerance: " << m_reuseTol
+	   << (m_spNewton.valid() ? "" : " (not used, no NewtonSolver)") << "\n";
+	ss << " Solver: " << ConfigShift(m_spSolver->config_string());
+	return ss.str();
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__TIME_DISC__ADAPTIVE_BDF_INTEGRATOR_IMPL__ */
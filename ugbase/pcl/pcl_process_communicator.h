@@ -288,6 +288,13 @@ class ProcessCommunicator
 		void allreduce(const void* sendBuf, void* recBuf, int count,
 					   DataType type, ReduceOperation op) const;
 
+	///	starts a non-blocking MPI_Iallreduce on the processes of the communicator.
+	/**	The buffers must not be accessed until the request has been completed,
+	 * e.g. by MPI_Wait. For MPI versions prior to 3 a blocking MPI_Allreduce
+	 * is performed and req is set to MPI_REQUEST_NULL.*/
+		void iallreduce(const void* sendBuf, void* recBuf, int count,
+						DataType type, ReduceOperation op, MPI_Request& req) const;
+
 	/** simplified allreduce for size=1. calls allreduce for parameter t,
 	 * and then returns the result.
 	 * \param t the input parameter